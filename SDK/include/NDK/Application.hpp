@@ -49,7 +49,14 @@ namespace Ndk
 			#ifndef NDK_SERVER
 			inline void EnableConsole(bool enable);
 			inline void EnableFPSCounter(bool enable);
+			#endif
+			inline void EnableFixedUpdateWait(bool enable, float spinDuration = 0.002f);
+
+			inline float GetFixedUpdateRate() const;
+			inline float GetInterpolationFactor() const;
+			inline unsigned int GetMaxFixedUpdates() const;
 
+			#ifndef NDK_SERVER
 			inline ConsoleOverlay& GetConsoleOverlay(std::size_t windowIndex = 0U);
 			inline FPSCounterOverlay& GetFPSCounterOverlay(std::size_t windowIndex = 0U);
 			#endif
@@ -66,6 +73,7 @@ namespace Ndk
 			inline bool IsConsoleEnabled() const;
 			inline bool IsFPSCounterEnabled() const;
 			#endif
+			inline bool IsFixedUpdateWaitEnabled() const;
 
 			bool Run();
 
@@ -75,6 +83,9 @@ namespace Ndk
 
 			inline void Quit();
 
+			inline void SetFixedUpdateRate(float updatePerSecond);
+			inline void SetMaxFixedUpdates(unsigned int maxFixedUpdates);
+
 			Application& operator=(const Application&) = delete;
 			Application& operator=(Application&&) = delete;
 
@@ -130,17 +141,26 @@ namespace Ndk
 			std::vector<WindowInfo> m_windows;
 			#endif
 
+			void WaitForFixedUpdate() const;
+
 			std::map<Nz::String, Nz::String> m_parameters;
 			std::set<Nz::String> m_options;
 			std::list<World> m_worlds;
 			Nz::Clock m_updateClock;
+			Nz::UInt64 m_fixedUpdateAccumulator;
+			Nz::UInt64 m_fixedUpdateSpinDuration;
+			Nz::UInt64 m_fixedUpdateStep;
+			Nz::UInt64 m_lastUpdateTime;
 
 			#ifndef NDK_SERVER
 			Nz::UInt32 m_overlayFlags;
 			bool m_exitOnClosedWindows;
 			#endif
+			bool m_fixedUpdateWait;
 			bool m_shouldQuit;
+			float m_interpolationFactor;
 			float m_updateTime;
+			unsigned int m_maxFixedUpdates;
 
 			static Application* s_application;
 	};
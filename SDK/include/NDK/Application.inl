@@ -4,6 +4,7 @@
 
 #include <NDK/Application.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <algorithm>
 #include <type_traits>
 #include <NDK/Sdk.hpp>
 
@@ -17,12 +18,19 @@ namespace Ndk
 	* \remark Only one Application instance can exist at a time
 	*/
 	inline Application::Application() :
+	m_fixedUpdateAccumulator(0),
+	m_fixedUpdateSpinDuration(2000),
+	m_fixedUpdateStep(0),
+	m_lastUpdateTime(0),
 	#ifndef NDK_SERVER
 	m_overlayFlags(0U),
 	m_exitOnClosedWindows(true),
 	#endif
+	m_fixedUpdateWait(false),
 	m_shouldQuit(false),
-	m_updateTime(0.f)
+	m_interpolationFactor(1.f),
+	m_updateTime(0.f),
+	m_maxFixedUpdates(5)
 	{
 		NazaraAssert(s_application == nullptr, "You can create only one application instance per program");
 		s_application = this;
@@ -175,6 +183,26 @@ namespace Ndk
 	}
 	#endif
 
+	/*!
+	* \brief Enable/disable waiting for the next fixed update
+	*
+	* \param enable Should Run wait until the next tick is due instead of returning right away
+	* \param spinDuration Duration (in seconds) of the busy-wait ending the wait
+	*
+	* The application sleeps until the next tick minus the spin duration, then busy-waits the remaining time,
+	* which keeps ticks precise (sleeping is only precise to the scheduler resolution) at a low CPU usage.
+	* This is meant for headless servers, or clients wanting to cap their frame rate to the update rate.
+	*
+	* \remark This has no effect if fixed updates are disabled
+	*
+	* \see SetFixedUpdateRate
+	*/
+	inline void Application::EnableFixedUpdateWait(bool enable, float spinDuration)
+	{
+		m_fixedUpdateSpinDuration = static_cast<Nz::UInt64>(std::max(spinDuration, 0.f) * 1000000.f);
+		m_fixedUpdateWait = enable;
+	}
+
 	/*!
 	* \brief Gets the console overlay for a specific window
 	*
@@ -217,6 +245,39 @@ namespace Ndk
 	}
 	#endif
 
+	/*!
+	* \brief Gets the fixed update rate of the application
+	* \return Number of ticks per second, 0 if fixed updates are disabled
+	*
+	* \see SetFixedUpdateRate
+	*/
+	inline float Application::GetFixedUpdateRate() const
+	{
+		return (m_fixedUpdateStep > 0) ? 1000000.f / m_fixedUpdateStep : 0.f;
+	}
+
+	/*!
+	* \brief Gets the interpolation factor of the last frame
+	* \return How far between the last two ticks the last frame was, in the [0;1[ range (1 if fixed updates are disabled)
+	*
+	* \see World::GetInterpolationFactor
+	*/
+	inline float Application::GetInterpolationFactor() const
+	{
+		return m_interpolationFactor;
+	}
+
+	/*!
+	* \brief Gets the maximum number of fixed updates a frame can run to catch up
+	* \return Maximum number of ticks per frame
+	*
+	* \see SetMaxFixedUpdates
+	*/
+	inline unsigned int Application::GetMaxFixedUpdates() const
+	{
+		return m_maxFixedUpdates;
+	}
+
 	/*!
 	* \brief Gets the options used to start the application
 	*
@@ -243,7 +304,7 @@ namespace Ndk
 
 	/*!
 	* \brief Gets the update time of the application
-	* \return Update rate
+	* \return Time elapsed since the previous frame, in seconds
 	*/
 	inline float Application::GetUpdateTime() const
 	{
@@ -319,6 +380,17 @@ namespace Ndk
 	}
 	#endif
 
+	/*!
+	* \brief Checks if the application waits for the next fixed update
+	* \return True if Run waits until the next tick is due
+	*
+	* \see EnableFixedUpdateWait
+	*/
+	inline bool Application::IsFixedUpdateWaitEnabled() const
+	{
+		return m_fixedUpdateWait;
+	}
+
 	/*!
 	* \brief Makes the application exit when there's no more open window
 	*
@@ -340,6 +412,40 @@ namespace Ndk
 		m_shouldQuit = true;
 	}
 
+	/*!
+	* \brief Sets the fixed update rate of the application
+	*
+	* \param updatePerSecond Number of ticks per second, 0 to update worlds once per frame with the elapsed time (default)
+	*
+	* When enabled, each Run advances the simulation of every world by as many fixed steps as the elapsed time allows (see World::FixedUpdate),
+	* keeping the remaining time for the next frame, and then updates the systems presenting them once (see World::FrameUpdate),
+	* with an interpolation factor telling how far between the last two ticks the frame is.
+	*
+	* \see EnableFixedUpdateWait
+	* \see SetMaxFixedUpdates
+	*/
+	inline void Application::SetFixedUpdateRate(float updatePerSecond)
+	{
+		m_fixedUpdateAccumulator = 0;
+		m_fixedUpdateStep = (updatePerSecond > 0.f) ? static_cast<Nz::UInt64>(1000000.f / updatePerSecond + 0.5f) : 0;
+		m_interpolationFactor = (m_fixedUpdateStep > 0) ? 0.f : 1.f;
+	}
+
+	/*!
+	* \brief Sets the maximum number of fixed updates a frame can run to catch up
+	*
+	* \param maxFixedUpdates Maximum number of ticks per frame, must be positive
+	*
+	* If the simulation falls behind more than this (because a tick takes longer than its step, or the application got suspended),
+	* the extra time is dropped and the simulation slows down instead of spiraling into longer and longer frames.
+	*/
+	inline void Application::SetMaxFixedUpdates(unsigned int maxFixedUpdates)
+	{
+		NazaraAssert(maxFixedUpdates > 0, "Max fixed updates must be positive");
+
+		m_maxFixedUpdates = maxFixedUpdates;
+	}
+
 	/*!
 	* \brief Gets the singleton instance of the application
 	* \return Singleton application
@@ -7,6 +7,7 @@
 #ifndef NDK_BASECOMPONENT_HPP
 #define NDK_BASECOMPONENT_HPP
 
+#include <Nazara/Core/SerializationContext.hpp>
 #include <NDK/Entity.hpp>
 #include <functional>
 #include <unordered_map>
@@ -17,7 +18,9 @@ namespace Ndk
 	class NDK_API BaseComponent
 	{
 		friend Entity;
+		friend class ReplicationSystem;
 		friend class Sdk;
+		friend class WorldSnapshot;
 
 		public:
 			using Factory = std::function<BaseComponent*()>;
@@ -31,6 +34,9 @@ namespace Ndk
 			inline const EntityHandle& GetEntity() const;
 			ComponentIndex GetIndex() const;
 
+			virtual bool Serialize(Nz::SerializationContext& context) const;
+			virtual bool Unserialize(Nz::SerializationContext& context);
+
 			inline static ComponentIndex GetMaxComponentIndex();
 
 			BaseComponent& operator=(const BaseComponent&) = delete;
@@ -29,19 +29,25 @@ namespace Ndk
 			virtual ~BaseSystem();
 
 			inline void Enable(bool enable = true);
+			inline void EnableFixedUpdate(bool fixedUpdate = true);
 
 			virtual std::unique_ptr<BaseSystem> Clone() const = 0;
 
+			bool ConflictsWith(const BaseSystem& system) const;
+
 			bool Filters(const Entity* entity) const;
 
 			inline const EntityList& GetEntities() const;
 			inline SystemIndex GetIndex() const;
+			virtual const char* GetName() const;
 			inline int GetUpdateOrder() const;
 			inline float GetUpdateRate() const;
 			inline World& GetWorld() const;
 
 			inline bool IsEnabled() const;
+			inline bool IsFixedUpdateEnabled() const;
 
+			inline bool HasComponentAccess() const;
 			inline bool HasEntity(const Entity* entity) const;
 
 			void SetUpdateOrder(int updateOrder);
@@ -59,6 +65,13 @@ namespace Ndk
 
 			static SystemIndex GetNextIndex();
 
+			template<typename F> void ParallelForEach(const EntityList& entities, F&& function, std::size_t grainSize = 256) const;
+			template<typename F> void ParallelForEachEntity(F&& function, std::size_t grainSize = 256) const;
+
+			template<typename ComponentType> void Reads();
+			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Reads();
+			inline void ReadsComponent(ComponentIndex index);
+
 			template<typename ComponentType> void Requires();
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Requires();
 			inline void RequiresComponent(ComponentIndex index);
@@ -67,6 +80,10 @@ namespace Ndk
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void RequiresAny();
 			inline void RequiresAnyComponent(ComponentIndex index);
 
+			template<typename ComponentType> void Writes();
+			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Writes();
+			inline void WritesComponent(ComponentIndex index);
+
 			virtual void OnUpdate(float elapsedTime) = 0;
 
 		private:
@@ -87,11 +104,14 @@ namespace Ndk
 
 			Nz::Bitset<> m_excludedComponents;
 			mutable Nz::Bitset<> m_filterResult;
+			Nz::Bitset<> m_readComponents;
 			Nz::Bitset<> m_requiredAnyComponents;
 			Nz::Bitset<> m_requiredComponents;
+			Nz::Bitset<> m_writtenComponents;
 			EntityList m_entities;
 			SystemIndex m_systemIndex;
 			World* m_world;
+			bool m_fixedUpdate;
 			bool m_updateEnabled;
 			float m_updateCounter;
 			float m_updateRate;
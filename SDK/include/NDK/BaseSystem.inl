@@ -4,6 +4,8 @@
 
 #include <NDK/BaseSystem.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <type_traits>
 
 namespace Ndk
@@ -17,6 +19,7 @@ namespace Ndk
 	inline BaseSystem::BaseSystem(SystemIndex systemId) :
 	m_systemIndex(systemId),
 	m_world(nullptr),
+	m_fixedUpdate(true),
 	m_updateEnabled(true),
 	m_updateOrder(0)
 	{
@@ -31,8 +34,11 @@ namespace Ndk
 
 	inline BaseSystem::BaseSystem(const BaseSystem& system) :
 	m_excludedComponents(system.m_excludedComponents),
+	m_readComponents(system.m_readComponents),
 	m_requiredComponents(system.m_requiredComponents),
+	m_writtenComponents(system.m_writtenComponents),
 	m_systemIndex(system.m_systemIndex),
+	m_fixedUpdate(system.m_fixedUpdate),
 	m_updateEnabled(system.m_updateEnabled),
 	m_updateCounter(0.f),
 	m_updateRate(system.m_updateRate),
@@ -51,6 +57,21 @@ namespace Ndk
 		m_updateEnabled = enable;
 	}
 
+	/*!
+	* \brief Sets whether the system is part of the fixed-step simulation
+	*
+	* \param fixedUpdate Should the system be updated by World::FixedUpdate instead of World::FrameUpdate
+	*
+	* Systems are part of the simulation by default, systems presenting its state (as the RenderSystem) should be updated once per frame instead.
+	*
+	* \remark World::Update(float) updates every system regardless of this setting
+	*/
+
+	inline void BaseSystem::EnableFixedUpdate(bool fixedUpdate)
+	{
+		m_fixedUpdate = fixedUpdate;
+	}
+
 	/*!
 	* \brief Gets every entities that system handle
 	* \return A constant reference to the list of entities
@@ -112,6 +133,30 @@ namespace Ndk
 		return m_updateEnabled;
 	}
 
+	/*!
+	* \brief Checks whether or not the system is part of the fixed-step simulation
+	* \return true If it is updated by World::FixedUpdate
+	*
+	* \see EnableFixedUpdate
+	*/
+
+	inline bool BaseSystem::IsFixedUpdateEnabled() const
+	{
+		return m_fixedUpdate;
+	}
+
+	/*!
+	* \brief Checks whether or not the system declared which components it reads and writes
+	* \return true If it is the case
+	*
+	* \see Reads, Writes
+	*/
+
+	inline bool BaseSystem::HasComponentAccess() const
+	{
+		return m_readComponents.TestAny() || m_writtenComponents.TestAny();
+	}
+
 	/*!
 	* \brief Checks whether or not the system has the entity
 	* \return true If it is the case
@@ -147,6 +192,11 @@ namespace Ndk
 		if (!IsEnabled())
 			return;
 
+		#if NAZARA_CORE_PROFILER
+		// Only fetch the name when the zone is going to be recorded
+		NazaraProfileZone((Nz::Profiler::IsEnabled()) ? GetName() : nullptr);
+		#endif
+
 		if (m_updateRate > 0.f)
 		{
 			m_updateCounter += elapsedTime;
@@ -205,6 +255,82 @@ namespace Ndk
 		return s_nextIndex++;
 	}
 
+	/*!
+	* \brief Calls a function for every entity of a list, splitting the work between the threads of the task scheduler
+	*
+	* The identifier range of the list is cut into chunks of grainSize identifiers, each chunk being processed by a single thread.
+	* The function may run concurrently for different entities and must only touch the state of the entity it receives.
+	*
+	* \param entities List of entities to process
+	* \param function Function called with a constant reference to the handle of each entity
+	* \param grainSize Number of identifiers per chunk, a multiple of 64 avoids splitting the blocks of the list
+	*
+	* \remark Entities must not be added to nor removed from the list during the call
+	*
+	* \see ParallelForEachEntity
+	*/
+
+	template<typename F>
+	void BaseSystem::ParallelForEach(const EntityList& entities, F&& function, std::size_t grainSize) const
+	{
+		Nz::ParallelFor(0, entities.GetIdBound(), grainSize, [&entities, &function](std::size_t first, std::size_t last)
+		{
+			entities.ForEach(static_cast<EntityId>(first), static_cast<EntityId>(last), function);
+		});
+	}
+
+	/*!
+	* \brief Calls a function for every entity of the system, splitting the work between the threads of the task scheduler
+	*
+	* \param function Function called with a constant reference to the handle of each entity
+	* \param grainSize Number of identifiers per chunk
+	*
+	* \see ParallelForEach
+	*/
+
+	template<typename F>
+	void BaseSystem::ParallelForEachEntity(F&& function, std::size_t grainSize) const
+	{
+		ParallelForEach(m_entities, std::forward<F>(function), grainSize);
+	}
+
+	/*!
+	* \brief Declares that the system reads some component during its update
+	*
+	* \remark Reading a component means only using its const interface, which systems updated at the same time may use as well
+	* \see ConflictsWith
+	*/
+
+	template<typename ComponentType>
+	void BaseSystem::Reads()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		ReadsComponent(GetComponentIndex<ComponentType>());
+	}
+
+	/*!
+	* \brief Declares that the system reads some components during its update
+	*/
+
+	template<typename ComponentType1, typename ComponentType2, typename... Rest>
+	void BaseSystem::Reads()
+	{
+		Reads<ComponentType1>();
+		Reads<ComponentType2, Rest...>();
+	}
+
+	/*!
+	* \brief Declares that the system reads some component during its update by index
+	*
+	* \param index Index of the component
+	*/
+
+	inline void BaseSystem::ReadsComponent(ComponentIndex index)
+	{
+		m_readComponents.UnboundedSet(index);
+	}
+
 	/*!
 	* \brief Requires some component from the system
 	*/
@@ -273,6 +399,42 @@ namespace Ndk
 		m_requiredAnyComponents.UnboundedSet(index);
 	}
 
+	/*!
+	* \brief Declares that the system writes some component during its update
+	*
+	* \see ConflictsWith
+	*/
+
+	template<typename ComponentType>
+	void BaseSystem::Writes()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		WritesComponent(GetComponentIndex<ComponentType>());
+	}
+
+	/*!
+	* \brief Declares that the system writes some components during its update
+	*/
+
+	template<typename ComponentType1, typename ComponentType2, typename... Rest>
+	void BaseSystem::Writes()
+	{
+		Writes<ComponentType1>();
+		Writes<ComponentType2, Rest...>();
+	}
+
+	/*!
+	* \brief Declares that the system writes some component during its update by index
+	*
+	* \param index Index of the component
+	*/
+
+	inline void BaseSystem::WritesComponent(ComponentIndex index)
+	{
+		m_writtenComponents.UnboundedSet(index);
+	}
+
 	/*!
 	* \brief Adds an entity to a system
 	*
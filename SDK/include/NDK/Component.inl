@@ -7,6 +7,21 @@
 
 namespace Ndk
 {
+	namespace Detail
+	{
+		template<typename ComponentType>
+		std::enable_if_t<std::is_default_constructible<ComponentType>::value, BaseComponent*> CreateComponent()
+		{
+			return new ComponentType;
+		}
+
+		template<typename ComponentType>
+		std::enable_if_t<!std::is_default_constructible<ComponentType>::value, BaseComponent*> CreateComponent()
+		{
+			return nullptr; //< Components without default constructor cannot be built by the factory
+		}
+	}
+
 	/*!
 	* \ingroup NDK
 	* \class Ndk::Component<ComponentType>
@@ -51,14 +66,7 @@ namespace Ndk
 	template<typename ComponentType>
 	ComponentIndex Component<ComponentType>::RegisterComponent(ComponentId id)
 	{
-		//We use the lambda to create a factory function
-		auto factory = []() -> BaseComponent*
-		{
-			return nullptr; //< Temporary workaround to allow non-default-constructed components, will be updated for serialization
-			//return new ComponentType;
-		};
-
-		return BaseComponent::RegisterComponent(id, factory);
+		return BaseComponent::RegisterComponent(id, &Detail::CreateComponent<ComponentType>);
 	}
 
 	/*!
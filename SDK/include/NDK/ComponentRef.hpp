@@ -0,0 +1,45 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_COMPONENTREF_HPP
+#define NDK_COMPONENTREF_HPP
+
+#include <NDK/EntityRef.hpp>
+
+namespace Ndk
+{
+	template<typename ComponentType>
+	class ComponentRef
+	{
+		public:
+			ComponentRef();
+			ComponentRef(const ComponentType& component);
+			explicit ComponentRef(const EntityRef& entity);
+			ComponentRef(const ComponentRef&) = default;
+			~ComponentRef() = default;
+
+			ComponentType* GetComponent() const;
+			const EntityRef& GetEntity() const;
+
+			bool IsValid() const;
+
+			explicit operator bool() const;
+			ComponentType* operator->() const;
+
+			ComponentRef& operator=(const ComponentRef&) = default;
+
+			bool operator==(const ComponentRef& ref) const;
+			bool operator!=(const ComponentRef& ref) const;
+
+		private:
+			EntityRef m_entity;
+			Nz::UInt32 m_generation;
+	};
+}
+
+#include <NDK/ComponentRef.inl>
+
+#endif // NDK_COMPONENTREF_HPP
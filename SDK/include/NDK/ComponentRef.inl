@@ -0,0 +1,158 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/ComponentRef.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <NDK/BaseComponent.hpp>
+#include <type_traits>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ComponentRef<ComponentType>
+	* \brief NDK class that represents a weak reference to the component of a type owned by an entity
+	*
+	* The component is found back through an EntityRef, in constant time and without registering anything to the component.
+	*
+	* The entity keeps a generation per component type, so a reference to a removed (or replaced) component does not resolve to the one added after it.
+	*
+	* \see EntityRef
+	*/
+
+	/*!
+	* \brief Constructs a ComponentRef object referencing nothing
+	*/
+
+	template<typename ComponentType>
+	ComponentRef<ComponentType>::ComponentRef() :
+	m_generation(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ComponentRef object referencing a component
+	*
+	* \param component Component to reference, must be attached to an entity
+	*/
+
+	template<typename ComponentType>
+	ComponentRef<ComponentType>::ComponentRef(const ComponentType& component) :
+	m_entity(component.GetEntity()),
+	m_generation(component.GetEntity()->GetComponentGeneration(GetComponentIndex<ComponentType>()))
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+	}
+
+	/*!
+	* \brief Constructs a ComponentRef object referencing the component of an entity
+	*
+	* \param entity Reference to the entity owning the component
+	*
+	* \remark The component may be added to the entity after the reference was made, as long as the entity did not lose one of this type in the meantime
+	*/
+
+	template<typename ComponentType>
+	ComponentRef<ComponentType>::ComponentRef(const EntityRef& entity) :
+	m_entity(entity),
+	m_generation((entity) ? entity->GetComponentGeneration(GetComponentIndex<ComponentType>()) : 0)
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+	}
+
+	/*!
+	* \brief Resolves the reference
+	* \return Pointer to the component, nullptr if its entity has been destroyed or if the component has been removed
+	*/
+
+	template<typename ComponentType>
+	ComponentType* ComponentRef<ComponentType>::GetComponent() const
+	{
+		Entity* entity = m_entity.GetEntity();
+		if (!entity || !entity->HasComponent<ComponentType>())
+			return nullptr;
+
+		if (entity->GetComponentGeneration(GetComponentIndex<ComponentType>()) != m_generation)
+			return nullptr;
+
+		return &entity->GetComponent<ComponentType>();
+	}
+
+	/*!
+	* \brief Gets the reference to the entity owning the component
+	* \return Reference to the entity
+	*/
+
+	template<typename ComponentType>
+	const EntityRef& ComponentRef<ComponentType>::GetEntity() const
+	{
+		return m_entity;
+	}
+
+	/*!
+	* \brief Checks whether the referenced component still exists
+	* \return true If it is the case
+	*/
+
+	template<typename ComponentType>
+	bool ComponentRef<ComponentType>::IsValid() const
+	{
+		return GetComponent() != nullptr;
+	}
+
+	/*!
+	* \brief Checks whether the referenced component still exists
+	* \return true If it is the case
+	*
+	* \see IsValid
+	*/
+
+	template<typename ComponentType>
+	ComponentRef<ComponentType>::operator bool() const
+	{
+		return IsValid();
+	}
+
+	/*!
+	* \brief Dereferences the reference
+	* \return Pointer to the component
+	*
+	* \remark Produces a NazaraAssert if the component does not exist anymore
+	*/
+
+	template<typename ComponentType>
+	ComponentType* ComponentRef<ComponentType>::operator->() const
+	{
+		ComponentType* component = GetComponent();
+		NazaraAssert(component, "Invalid component reference");
+
+		return component;
+	}
+
+	/*!
+	* \brief Checks whether two references are referencing the same component
+	* \return true If it is the case
+	*
+	* \param ref Other reference to compare with
+	*/
+
+	template<typename ComponentType>
+	bool ComponentRef<ComponentType>::operator==(const ComponentRef& ref) const
+	{
+		return m_entity == ref.m_entity && m_generation == ref.m_generation;
+	}
+
+	/*!
+	* \brief Checks whether two references are referencing different components
+	* \return false If it is the case
+	*
+	* \param ref Other reference to compare with
+	*/
+
+	template<typename ComponentType>
+	bool ComponentRef<ComponentType>::operator!=(const ComponentRef& ref) const
+	{
+		return !operator==(ref);
+	}
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_COMPONENTSTORAGE_HPP
+#define NDK_COMPONENTSTORAGE_HPP
+
+#include <NDK/Prerequesites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <memory>
+#include <vector>
+
+namespace Ndk
+{
+	class BaseComponent;
+	class BaseComponentStorage;
+
+	struct NDK_API ComponentDeleter
+	{
+		ComponentDeleter() = default;
+		inline ComponentDeleter(BaseComponentStorage* componentStorage, std::size_t componentSlot);
+
+		void operator()(BaseComponent* component) const;
+
+		BaseComponentStorage* storage = nullptr; //< nullptr for heap-allocated components
+		std::size_t slot = 0;
+	};
+
+	using ComponentPtr = std::unique_ptr<BaseComponent, ComponentDeleter>;
+
+	class NDK_API BaseComponentStorage
+	{
+		friend ComponentDeleter;
+
+		public:
+			BaseComponentStorage(ComponentIndex componentIndex, std::size_t componentSize, std::size_t componentAlignment, std::size_t componentsPerChunk);
+			BaseComponentStorage(const BaseComponentStorage&) = delete;
+			BaseComponentStorage(BaseComponentStorage&&) = delete;
+			virtual ~BaseComponentStorage();
+
+			virtual ComponentPtr Clone(EntityId owner, const BaseComponent& component) = 0;
+
+			inline std::size_t GetChunkCount() const;
+			inline std::size_t GetComponentCount() const;
+			inline ComponentIndex GetComponentIndex() const;
+			inline std::size_t GetComponentsPerChunk() const;
+
+			BaseComponentStorage& operator=(const BaseComponentStorage&) = delete;
+			BaseComponentStorage& operator=(BaseComponentStorage&&) = delete;
+
+		protected:
+			struct Chunk
+			{
+				std::unique_ptr<Nz::UInt8[]> memory;
+				std::unique_ptr<EntityId[]> owners;
+				Nz::Bitset<Nz::UInt64> usedSlots;
+				Nz::UInt8* components;
+			};
+
+			std::size_t AllocateSlot(EntityId owner);
+			void FreeSlot(std::size_t slot);
+
+			inline void* GetSlotPointer(std::size_t slot) const;
+
+			std::vector<Chunk> m_chunks;
+
+		private:
+			virtual void Destroy(BaseComponent* component) = 0;
+
+			std::vector<std::size_t> m_freeSlots;
+			std::size_t m_componentAlignment;
+			std::size_t m_componentCount;
+			std::size_t m_componentSize;
+			std::size_t m_componentsPerChunk;
+			ComponentIndex m_componentIndex;
+	};
+
+	template<typename ComponentType>
+	class ComponentStorage final : public BaseComponentStorage
+	{
+		public:
+			ComponentStorage(std::size_t componentsPerChunk = 0);
+			~ComponentStorage() = default;
+
+			ComponentPtr Clone(EntityId owner, const BaseComponent& component) override;
+
+			template<typename F> void ForEach(F&& func);
+
+			template<typename... Args> ComponentPtr New(EntityId owner, Args&&... args);
+
+		private:
+			void Destroy(BaseComponent* component) override;
+
+			static std::size_t ComputeComponentsPerChunk(std::size_t componentsPerChunk);
+	};
+}
+
+#include <NDK/ComponentStorage.inl>
+
+#endif // NDK_COMPONENTSTORAGE_HPP
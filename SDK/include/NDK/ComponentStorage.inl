@@ -0,0 +1,164 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/ComponentStorage.hpp>
+#include <NDK/Algorithm.hpp>
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Ndk
+{
+	/*!
+	* \brief Constructs a ComponentDeleter for a component living in a storage
+	*
+	* \param componentStorage Storage owning the component memory
+	* \param componentSlot Slot of the component in the storage
+	*/
+
+	inline ComponentDeleter::ComponentDeleter(BaseComponentStorage* componentStorage, std::size_t componentSlot) :
+	storage(componentStorage),
+	slot(componentSlot)
+	{
+	}
+
+	/*!
+	* \brief Gets the number of chunks allocated by the storage
+	* \return Chunk count
+	*/
+
+	inline std::size_t BaseComponentStorage::GetChunkCount() const
+	{
+		return m_chunks.size();
+	}
+
+	/*!
+	* \brief Gets the number of components living in the storage
+	* \return Component count
+	*/
+
+	inline std::size_t BaseComponentStorage::GetComponentCount() const
+	{
+		return m_componentCount;
+	}
+
+	/*!
+	* \brief Gets the index of the component type stored
+	* \return Component index
+	*/
+
+	inline ComponentIndex BaseComponentStorage::GetComponentIndex() const
+	{
+		return m_componentIndex;
+	}
+
+	/*!
+	* \brief Gets the number of components each chunk can hold
+	* \return Components per chunk
+	*/
+
+	inline std::size_t BaseComponentStorage::GetComponentsPerChunk() const
+	{
+		return m_componentsPerChunk;
+	}
+
+	inline void* BaseComponentStorage::GetSlotPointer(std::size_t slot) const
+	{
+		const Chunk& chunk = m_chunks[slot / m_componentsPerChunk];
+		return chunk.components + (slot % m_componentsPerChunk) * m_componentSize;
+	}
+
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ComponentStorage<ComponentType>
+	* \brief NDK class that stores components of the same type contiguously, in chunks
+	*
+	* Components never move once constructed (references and handles to them stay valid), freed slots get reused by the next components.
+	*
+	* \see World::EnableComponentStorage
+	*/
+
+	/*!
+	* \brief Constructs a ComponentStorage object
+	*
+	* \param componentsPerChunk Number of components per chunk, zero to fit them in chunks of 16 KiB
+	*/
+
+	template<typename ComponentType>
+	ComponentStorage<ComponentType>::ComponentStorage(std::size_t componentsPerChunk) :
+	BaseComponentStorage(Ndk::GetComponentIndex<ComponentType>(), sizeof(ComponentType), alignof(ComponentType), ComputeComponentsPerChunk(componentsPerChunk))
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+	}
+
+	/*!
+	* \brief Constructs a copy of a component in the storage
+	* \return The clone newly created
+	*
+	* \param owner Identifier of the entity which will own the clone
+	* \param component Component to clone, must be a ComponentType
+	*/
+
+	template<typename ComponentType>
+	ComponentPtr ComponentStorage<ComponentType>::Clone(EntityId owner, const BaseComponent& component)
+	{
+		return New(owner, static_cast<const ComponentType&>(component));
+	}
+
+	/*!
+	* \brief Calls a function for every component of the storage, in memory order
+	*
+	* \param func Function called with the identifier of the owning entity and a reference to the component
+	*
+	* \remark Components must not be created nor destroyed from the function
+	*/
+
+	template<typename ComponentType>
+	template<typename F>
+	void ComponentStorage<ComponentType>::ForEach(F&& func)
+	{
+		for (Chunk& chunk : m_chunks)
+		{
+			ComponentType* components = reinterpret_cast<ComponentType*>(chunk.components);
+			for (std::size_t i = chunk.usedSlots.FindFirst(); i != chunk.usedSlots.npos; i = chunk.usedSlots.FindNext(i))
+				func(chunk.owners[i], components[i]);
+		}
+	}
+
+	/*!
+	* \brief Constructs a component in the storage
+	* \return Pointer owning the new component, giving its slot back to the storage on destruction
+	*
+	* \param owner Identifier of the entity which will own the component
+	* \param args Arguments of the component constructor
+	*/
+
+	template<typename ComponentType>
+	template<typename... Args>
+	ComponentPtr ComponentStorage<ComponentType>::New(EntityId owner, Args&&... args)
+	{
+		std::size_t slot = AllocateSlot(owner);
+		ComponentType* component = new (GetSlotPointer(slot)) ComponentType(std::forward<Args>(args)...);
+
+		return ComponentPtr(component, ComponentDeleter(this, slot));
+	}
+
+	template<typename ComponentType>
+	void ComponentStorage<ComponentType>::Destroy(BaseComponent* component)
+	{
+		static_cast<ComponentType*>(component)->~ComponentType();
+	}
+
+	template<typename ComponentType>
+	std::size_t ComponentStorage<ComponentType>::ComputeComponentsPerChunk(std::size_t componentsPerChunk)
+	{
+		constexpr std::size_t DefaultChunkSize = 16 * 1024;
+
+		if (componentsPerChunk == 0)
+			componentsPerChunk = std::max<std::size_t>(DefaultChunkSize / sizeof(ComponentType), 1);
+
+		return componentsPerChunk;
+	}
+}
@@ -16,6 +16,7 @@
 #include <NDK/Components/ParticleGroupComponent.hpp>
 #include <NDK/Components/PhysicsComponent2D.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
+#include <NDK/Components/ReplicationComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
 
 #endif // NDK_COMPONENTS_GLOBAL_HPP
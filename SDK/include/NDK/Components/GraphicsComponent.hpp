@@ -27,7 +27,7 @@ namespace Ndk
 		public:
 			using RenderableList = std::vector<Nz::InstancedRenderableRef>;
 
-			GraphicsComponent() = default;
+			inline GraphicsComponent();
 			inline GraphicsComponent(const GraphicsComponent& graphicsComponent);
 			~GraphicsComponent() = default;
 
@@ -57,6 +57,7 @@ namespace Ndk
 			static ComponentIndex componentIndex;
 
 		private:
+			void Interpolate(Nz::UInt64 tickCount, float interpolationFactor);
 			inline void InvalidateBoundingVolume() const;
 			void InvalidateRenderableData(const Nz::InstancedRenderable* renderable, Nz::UInt32 flags, std::size_t index);
 			inline void InvalidateRenderables();
@@ -68,6 +69,8 @@ namespace Ndk
 			void OnDetached() override;
 			void OnNodeInvalidated(const Nz::Node* node);
 
+			inline void StopInterpolation();
+
 			void UpdateBoundingVolume() const;
 			void UpdateTransformMatrix() const;
 
@@ -118,6 +121,13 @@ namespace Ndk
 				mutable bool dataUpdated;
 			};
 
+			struct TickState
+			{
+				Nz::Quaternionf rotation;
+				Nz::Vector3f position;
+				Nz::Vector3f scale;
+			};
+
 			using VolumeCullingListEntry = GraphicsComponentCullingList::VolumeEntry;
 
 			struct VolumeCullingEntry
@@ -131,7 +141,14 @@ namespace Ndk
 			std::vector<Renderable> m_renderables;
 			mutable Nz::BoundingVolumef m_boundingVolume;
 			mutable Nz::Matrix4f m_transformMatrix;
+			Nz::UInt64 m_interpolationTick;
+			TickState m_currentTickState;
+			TickState m_previousTickState;
+			float m_interpolationFactor;
 			mutable bool m_boundingVolumeUpdated;
+			bool m_interpolated;
+			bool m_interpolating;
+			bool m_nodeMoved;
 			mutable bool m_transformMatrixUpdated;
 	};
 }
@@ -9,6 +9,19 @@
 
 namespace Ndk
 {
+	/*!
+	* \brief Constructs a GraphicsComponent object by default
+	*/
+
+	inline GraphicsComponent::GraphicsComponent() :
+	m_boundingVolumeUpdated(false),
+	m_interpolated(false),
+	m_interpolating(false),
+	m_nodeMoved(false),
+	m_transformMatrixUpdated(false)
+	{
+	}
+
 	/*!
 	* \brief Constructs a GraphicsComponent object by copy semantic
 	*
@@ -21,6 +34,9 @@ namespace Ndk
 	m_boundingVolume(graphicsComponent.m_boundingVolume),
 	m_transformMatrix(graphicsComponent.m_transformMatrix),
 	m_boundingVolumeUpdated(graphicsComponent.m_boundingVolumeUpdated),
+	m_interpolated(false),
+	m_interpolating(false),
+	m_nodeMoved(false),
 	m_transformMatrixUpdated(graphicsComponent.m_transformMatrixUpdated)
 	{
 		m_renderables.reserve(graphicsComponent.m_renderables.size());
@@ -198,4 +214,19 @@ namespace Ndk
 		InvalidateBoundingVolume();
 		InvalidateRenderables();
 	}
+
+	/*!
+	* \brief Goes back to the transformation of the node, without interpolation
+	*/
+
+	inline void GraphicsComponent::StopInterpolation()
+	{
+		if (m_interpolated)
+		{
+			m_interpolated = false;
+			m_interpolating = false;
+
+			OnNodeInvalidated(nullptr);
+		}
+	}
 }
\ No newline at end of file
@@ -14,19 +14,40 @@ namespace Ndk
 {
 	class Entity;
 	class NodeComponent;
+	class TransformSystem;
 
 	using NodeComponentHandle = Nz::ObjectHandle<NodeComponent>;
 
 	class NDK_API NodeComponent : public Component<NodeComponent>, public Nz::Node, public Nz::HandledObject<NodeComponent>
 	{
+		friend class TransformSystem;
+
 		public:
-			NodeComponent() = default;
+			inline NodeComponent();
+			inline NodeComponent(const NodeComponent& node);
 			~NodeComponent() = default;
 
+			inline bool IsInvalidationDeferred() const;
+
+			bool Serialize(Nz::SerializationContext& context) const override;
+
 			void SetParent(Entity* entity, bool keepDerived = false);
 			using Nz::Node::SetParent;
 
+			bool Unserialize(Nz::SerializationContext& context) override;
+
 			static ComponentIndex componentIndex;
+
+		private:
+			inline void DispatchInvalidation();
+
+			void OnInvalidation() override;
+			void OnParenting(const Nz::Node* parent) override;
+
+			void SetTransformSystem(TransformSystem* system);
+
+			TransformSystem* m_transformSystem;
+			bool m_invalidationPending;
 	};
 }
 
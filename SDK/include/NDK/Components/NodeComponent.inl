@@ -7,6 +7,43 @@
 
 namespace Ndk
 {
+	/*!
+	* \brief Constructs a NodeComponent object by default
+	*/
+
+	inline NodeComponent::NodeComponent() :
+	m_transformSystem(nullptr),
+	m_invalidationPending(false)
+	{
+	}
+
+	/*!
+	* \brief Constructs a NodeComponent object by copy semantic
+	*
+	* \param node NodeComponent to copy
+	*
+	* \remark The copy is not handled by the TransformSystem of the original one until its entity joins it
+	*/
+
+	inline NodeComponent::NodeComponent(const NodeComponent& node) :
+	Component(node),
+	Nz::Node(node),
+	HandledObject(node),
+	m_transformSystem(nullptr),
+	m_invalidationPending(false)
+	{
+	}
+
+	/*!
+	* \brief Checks whether the OnNodeInvalidation signal is deferred to the next update of a TransformSystem
+	* \return true If the entity is handled by a TransformSystem
+	*/
+
+	inline bool NodeComponent::IsInvalidationDeferred() const
+	{
+		return m_transformSystem != nullptr;
+	}
+
 	/*!
 	* \brief Sets the parent node of the entity
 	*
@@ -27,4 +64,17 @@ namespace Ndk
 		else
 			Nz::Node::SetParent(nullptr, keepDerived);
 	}
+
+	/*!
+	* \brief Signals an invalidation deferred by the TransformSystem, if any
+	*/
+
+	inline void NodeComponent::DispatchInvalidation()
+	{
+		if (m_invalidationPending)
+		{
+			m_invalidationPending = false;
+			Nz::Node::OnInvalidation();
+		}
+	}
 }
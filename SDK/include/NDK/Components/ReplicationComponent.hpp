@@ -0,0 +1,43 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_COMPONENTS_REPLICATIONCOMPONENT_HPP
+#define NDK_COMPONENTS_REPLICATIONCOMPONENT_HPP
+
+#include <NDK/Component.hpp>
+
+namespace Ndk
+{
+	class ReplicationComponent;
+
+	using ReplicationComponentHandle = Nz::ObjectHandle<ReplicationComponent>;
+
+	class NDK_API ReplicationComponent : public Component<ReplicationComponent>, public Nz::HandledObject<ReplicationComponent>
+	{
+		public:
+			inline ReplicationComponent(float priority = 1.f);
+			ReplicationComponent(const ReplicationComponent&) = default;
+			~ReplicationComponent() = default;
+
+			inline void EnableAlwaysRelevant(bool alwaysRelevant = true);
+
+			inline float GetPriority() const;
+
+			inline bool IsAlwaysRelevant() const;
+
+			inline void SetPriority(float priority);
+
+			static ComponentIndex componentIndex;
+
+		private:
+			float m_priority;
+			bool m_alwaysRelevant;
+	};
+}
+
+#include <NDK/Components/ReplicationComponent.inl>
+
+#endif // NDK_COMPONENTS_REPLICATIONCOMPONENT_HPP
@@ -0,0 +1,75 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ReplicationComponent
+	* \brief NDK class that marks an entity to be replicated by a ReplicationSystem
+	*
+	* \see ReplicationSystem
+	*/
+
+	/*!
+	* \brief Constructs a ReplicationComponent object with a priority
+	*
+	* \param priority Priority of the entity, relative to the other replicated entities
+	*/
+
+	inline ReplicationComponent::ReplicationComponent(float priority) :
+	m_priority(priority),
+	m_alwaysRelevant(false)
+	{
+		NazaraAssert(priority >= 0.f, "Priority must be positive");
+	}
+
+	/*!
+	* \brief Enables or disables the relevance of the entity to every peer, regardless of their viewer
+	*
+	* \param alwaysRelevant Should the entity be replicated to every peer
+	*
+	* \remark Entities without NodeComponent are always relevant
+	*/
+
+	inline void ReplicationComponent::EnableAlwaysRelevant(bool alwaysRelevant)
+	{
+		m_alwaysRelevant = alwaysRelevant;
+	}
+
+	/*!
+	* \brief Gets the priority of the entity
+	* \return Priority of the entity
+	*/
+
+	inline float ReplicationComponent::GetPriority() const
+	{
+		return m_priority;
+	}
+
+	/*!
+	* \brief Checks whether the entity is relevant to every peer
+	* \return true If the entity is replicated regardless of the viewers
+	*/
+
+	inline bool ReplicationComponent::IsAlwaysRelevant() const
+	{
+		return m_alwaysRelevant;
+	}
+
+	/*!
+	* \brief Sets the priority of the entity
+	*
+	* \param priority Priority of the entity, an entity twice as prioritary as another gets sent twice as often when the bandwidth is limited
+	*/
+
+	inline void ReplicationComponent::SetPriority(float priority)
+	{
+		NazaraAssert(priority >= 0.f, "Priority must be positive");
+
+		m_priority = priority;
+	}
+}
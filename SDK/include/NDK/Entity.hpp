@@ -11,6 +11,7 @@
 #include <Nazara/Core/HandledObject.hpp>
 #include <Nazara/Core/Signal.hpp>
 #include <NDK/Algorithm.hpp>
+#include <NDK/ComponentStorage.hpp>
 #include <memory>
 #include <vector>
 
@@ -29,6 +30,7 @@ namespace Ndk
 		friend BaseSystem;
 		friend EntityList;
 		friend World;
+		friend class WorldSnapshot;
 
 		public:
 			Entity(const Entity&) = delete;
@@ -47,6 +49,7 @@ namespace Ndk
 			inline const BaseComponent& GetComponent(ComponentIndex index) const;
 			template<typename ComponentType> const ComponentType& GetComponent() const;
 			inline const Nz::Bitset<>& GetComponentBits() const;
+			inline Nz::UInt32 GetComponentGeneration(ComponentIndex index) const;
 			inline EntityId GetId() const;
 			inline const Nz::Bitset<>& GetSystemBits() const;
 			inline World* GetWorld() const;
@@ -74,11 +77,16 @@ namespace Ndk
 		private:
 			Entity(World* world, EntityId id);
 
+			BaseComponent& AttachComponent(ComponentPtr&& component);
+
 			void Create();
 			void Destroy();
 
 			void DestroyComponent(ComponentIndex index);
 
+			inline void IncrementComponentGeneration(ComponentIndex index);
+
+			BaseComponentStorage* GetComponentStorage(ComponentIndex index) const;
 			inline Nz::Bitset<>& GetRemovedComponentBits();
 
 			inline void RegisterEntityList(EntityList* list);
@@ -89,7 +97,8 @@ namespace Ndk
 			inline void UnregisterEntityList(EntityList* list);
 			inline void UnregisterSystem(SystemIndex index);
 
-			std::vector<std::unique_ptr<BaseComponent>> m_components;
+			std::vector<ComponentPtr> m_components;
+			std::vector<Nz::UInt32> m_componentGenerations;
 			std::vector<EntityList*> m_containedInLists;
 			Nz::Bitset<> m_componentBits;
 			Nz::Bitset<> m_removedComponentBits;
@@ -24,6 +24,13 @@ namespace Ndk
 	{
 		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
 
+		// Construct the component in the world storage if the world uses one for this type
+		if (BaseComponentStorage* storage = GetComponentStorage(GetComponentIndex<ComponentType>()))
+		{
+			ComponentStorage<ComponentType>& componentStorage = static_cast<ComponentStorage<ComponentType>&>(*storage);
+			return static_cast<ComponentType&>(AttachComponent(componentStorage.New(m_id, std::forward<Args>(args)...)));
+		}
+
 		// Affectation and return of the component
 		std::unique_ptr<ComponentType> ptr(new ComponentType(std::forward<Args>(args)...));
 		return static_cast<ComponentType&>(AddComponent(std::move(ptr)));
@@ -124,6 +131,20 @@ namespace Ndk
 		return m_componentBits;
 	}
 
+	/*!
+	* \brief Gets the generation of a component slot of the entity
+	* \return Generation of the slot, incremented every time a component of this type is destroyed or replaced
+	*
+	* \param index Index of the component
+	*
+	* \see ComponentRef
+	*/
+
+	inline Nz::UInt32 Entity::GetComponentGeneration(ComponentIndex index) const
+	{
+		return (index < m_componentGenerations.size()) ? m_componentGenerations[index] : 0;
+	}
+
 	/*!
 	* \brief Gets the identifier of the entity
 	* \return Identifier of the entity
@@ -258,6 +279,14 @@ namespace Ndk
 		return m_removedComponentBits;
 	}
 
+	inline void Entity::IncrementComponentGeneration(ComponentIndex index)
+	{
+		if (index >= m_componentGenerations.size())
+			m_componentGenerations.resize(index + 1, 0);
+
+		m_componentGenerations[index]++;
+	}
+
 	inline void Entity::RegisterEntityList(EntityList* list)
 	{
 		m_containedInLists.push_back(list);
@@ -29,6 +29,11 @@ namespace Ndk
 
 			inline void Clear();
 
+			template<typename F> void ForEach(F&& function) const;
+			template<typename F> void ForEach(EntityId first, EntityId last, F&& function) const;
+
+			inline EntityId GetIdBound() const;
+
 			inline bool Has(const Entity* entity) const;
 			inline bool Has(EntityId entity) const;
 
@@ -47,6 +52,7 @@ namespace Ndk
 
 		private:
 			inline std::size_t FindNext(std::size_t currentId) const;
+			const EntityHandle& GetEntity(EntityId id) const;
 			inline World* GetWorld() const;
 			inline void NotifyEntityDestruction(const Entity* entity);
 
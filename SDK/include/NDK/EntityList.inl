@@ -4,6 +4,7 @@
 
 #include <NDK/EntityList.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <algorithm>
 
 namespace Ndk
@@ -68,6 +69,69 @@ namespace Ndk
 		m_world = nullptr;
 	}
 
+	/*!
+	* \brief Calls a function for every entity of the list, by increasing identifier
+	*
+	* \param function Function called with a constant reference to the handle of each entity
+	*/
+	template<typename F>
+	void EntityList::ForEach(F&& function) const
+	{
+		ForEach(0, GetIdBound(), std::forward<F>(function));
+	}
+
+	/*!
+	* \brief Calls a function for every entity of the list whose identifier is in a range, by increasing identifier
+	*
+	* Lists can be processed in parallel by splitting [0, GetIdBound()[ into ranges, as different ranges never share an entity.
+	*
+	* \param first First identifier of the range
+	* \param last Identifier past the end of the range
+	* \param function Function called with a constant reference to the handle of each entity
+	*
+	* \remark Entities must not be inserted or removed from the list while iterating
+	*/
+	template<typename F>
+	void EntityList::ForEach(EntityId first, EntityId last, F&& function) const
+	{
+		using Block = Nz::UInt64;
+		constexpr std::size_t BitsPerBlock = Nz::Bitset<Block>::bitsPerBlock;
+
+		std::size_t end = std::min<std::size_t>(last, m_entityBits.GetSize());
+		if (first >= end)
+			return;
+
+		std::size_t firstBlock = first / BitsPerBlock;
+		std::size_t lastBlock = (end - 1) / BitsPerBlock;
+		for (std::size_t blockIndex = firstBlock; blockIndex <= lastBlock; ++blockIndex)
+		{
+			// Scan the bits of a whole block at once instead of searching for every entity
+			Block block = m_entityBits.GetBlock(blockIndex);
+			if (blockIndex == firstBlock)
+				block &= Nz::Bitset<Block>::fullBitMask << (first % BitsPerBlock);
+
+			if (blockIndex == lastBlock && end % BitsPerBlock != 0)
+				block &= Nz::Bitset<Block>::fullBitMask >> (BitsPerBlock - end % BitsPerBlock);
+
+			while (block)
+			{
+				std::size_t bit = Nz::IntegralLog2Pot(block & -block);
+				function(GetEntity(static_cast<EntityId>(blockIndex * BitsPerBlock + bit)));
+
+				block &= block - 1;
+			}
+		}
+	}
+
+	/*!
+	* \brief Gets the identifier past the highest one the list may contain
+	* \return Upper bound of the identifiers of the list entities
+	*/
+	inline EntityId EntityList::GetIdBound() const
+	{
+		return static_cast<EntityId>(m_entityBits.GetSize());
+	}
+
 	/*!
 	* \brief Checks whether or not the EntityList contains the entity
 	* \return true If it is the case
@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_ENTITYPREFAB_HPP
+#define NDK_ENTITYPREFAB_HPP
+
+#include <Nazara/Core/Bitset.hpp>
+#include <NDK/Algorithm.hpp>
+#include <memory>
+#include <vector>
+
+namespace Ndk
+{
+	class BaseComponent;
+	class Entity;
+
+	class NDK_API EntityPrefab
+	{
+		public:
+			EntityPrefab() = default;
+			explicit EntityPrefab(const Entity& entity);
+			EntityPrefab(const EntityPrefab&) = delete;
+			EntityPrefab(EntityPrefab&&) = default;
+			~EntityPrefab() = default;
+
+			BaseComponent& AddComponent(std::unique_ptr<BaseComponent>&& component);
+			template<typename ComponentType, typename... Args> ComponentType& AddComponent(Args&&... args);
+
+			inline BaseComponent& GetComponent(ComponentIndex index);
+			template<typename ComponentType> ComponentType& GetComponent();
+			inline const BaseComponent& GetComponent(ComponentIndex index) const;
+			template<typename ComponentType> const ComponentType& GetComponent() const;
+			inline const Nz::Bitset<>& GetComponentBits() const;
+
+			inline bool HasComponent(ComponentIndex index) const;
+			template<typename ComponentType> bool HasComponent() const;
+
+			void RemoveComponent(ComponentIndex index);
+			template<typename ComponentType> void RemoveComponent();
+
+			EntityPrefab& operator=(const EntityPrefab&) = delete;
+			EntityPrefab& operator=(EntityPrefab&&) = default;
+
+		private:
+			std::vector<std::unique_ptr<BaseComponent>> m_components;
+			Nz::Bitset<> m_componentBits;
+	};
+}
+
+#include <NDK/EntityPrefab.inl>
+
+#endif // NDK_ENTITYPREFAB_HPP
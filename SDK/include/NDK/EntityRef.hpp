@@ -0,0 +1,50 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_ENTITYREF_HPP
+#define NDK_ENTITYREF_HPP
+
+#include <NDK/Entity.hpp>
+
+namespace Ndk
+{
+	class World;
+
+	class EntityRef
+	{
+		public:
+			inline EntityRef();
+			inline EntityRef(const Entity* entity);
+			EntityRef(const EntityRef&) = default;
+			~EntityRef() = default;
+
+			inline Entity* GetEntity() const;
+			inline Nz::UInt32 GetGeneration() const;
+			inline EntityId GetId() const;
+			inline World* GetWorld() const;
+
+			inline bool IsValid() const;
+
+			inline void Reset(const Entity* entity = nullptr);
+
+			inline explicit operator bool() const;
+			inline Entity* operator->() const;
+
+			EntityRef& operator=(const EntityRef&) = default;
+
+			inline bool operator==(const EntityRef& ref) const;
+			inline bool operator!=(const EntityRef& ref) const;
+
+		private:
+			World* m_world;
+			EntityId m_id;
+			Nz::UInt32 m_generation;
+	};
+}
+
+#include <NDK/EntityRef.inl>
+
+#endif // NDK_ENTITYREF_HPP
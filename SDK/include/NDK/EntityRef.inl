@@ -0,0 +1,174 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/EntityRef.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <NDK/World.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::EntityRef
+	* \brief NDK class that represents a weak reference to an entity, by identifier and generation
+	*
+	* Unlike EntityHandle, an EntityRef is not registered to the entity: it is trivially copyable and does not cost anything to the entity when it is moved or destroyed.
+	* Its validity is instead checked in constant time when resolving it, by comparing its generation to the one of the identifier in the world.
+	*
+	* \remark The world of the entity must outlive the reference
+	*/
+
+	/*!
+	* \brief Constructs an invalid EntityRef object
+	*/
+
+	inline EntityRef::EntityRef() :
+	m_world(nullptr),
+	m_id(0),
+	m_generation(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs an EntityRef object referencing an entity
+	*
+	* \param entity Entity to reference, may be nullptr
+	*/
+
+	inline EntityRef::EntityRef(const Entity* entity) :
+	EntityRef()
+	{
+		Reset(entity);
+	}
+
+	/*!
+	* \brief Resolves the reference
+	* \return Pointer to the entity, nullptr if it has been destroyed (or the reference is invalid)
+	*/
+
+	inline Entity* EntityRef::GetEntity() const
+	{
+		if (!m_world || !m_world->IsEntityIdValid(m_id) || m_world->GetEntityGeneration(m_id) != m_generation)
+			return nullptr;
+
+		return m_world->GetEntity(m_id);
+	}
+
+	/*!
+	* \brief Gets the generation of the identifier of the referenced entity
+	* \return Generation of the identifier when the reference was made
+	*/
+
+	inline Nz::UInt32 EntityRef::GetGeneration() const
+	{
+		return m_generation;
+	}
+
+	/*!
+	* \brief Gets the identifier of the referenced entity
+	* \return Identifier of the entity
+	*/
+
+	inline EntityId EntityRef::GetId() const
+	{
+		return m_id;
+	}
+
+	/*!
+	* \brief Gets the world of the referenced entity
+	* \return Pointer to the world, nullptr if the reference was made from no entity
+	*/
+
+	inline World* EntityRef::GetWorld() const
+	{
+		return m_world;
+	}
+
+	/*!
+	* \brief Checks whether the referenced entity is still alive
+	* \return true If it is the case
+	*/
+
+	inline bool EntityRef::IsValid() const
+	{
+		return GetEntity() != nullptr;
+	}
+
+	/*!
+	* \brief Makes the reference point to another entity
+	*
+	* \param entity Entity to reference, nullptr to make the reference invalid
+	*
+	* \remark Produces a NazaraAssert if entity is not valid
+	*/
+
+	inline void EntityRef::Reset(const Entity* entity)
+	{
+		if (entity)
+		{
+			NazaraAssert(entity->IsValid(), "Invalid entity");
+
+			m_world = entity->GetWorld();
+			m_id = entity->GetId();
+			m_generation = m_world->GetEntityGeneration(m_id);
+		}
+		else
+		{
+			m_world = nullptr;
+			m_id = 0;
+			m_generation = 0;
+		}
+	}
+
+	/*!
+	* \brief Checks whether the referenced entity is still alive
+	* \return true If it is the case
+	*
+	* \see IsValid
+	*/
+
+	inline EntityRef::operator bool() const
+	{
+		return IsValid();
+	}
+
+	/*!
+	* \brief Dereferences the reference
+	* \return Pointer to the entity
+	*
+	* \remark Produces a NazaraAssert if the entity is not alive anymore
+	*/
+
+	inline Entity* EntityRef::operator->() const
+	{
+		Entity* entity = GetEntity();
+		NazaraAssert(entity, "Invalid entity reference");
+
+		return entity;
+	}
+
+	/*!
+	* \brief Checks whether two references are referencing the same entity
+	* \return true If it is the case
+	*
+	* \param ref Other reference to compare with
+	*/
+
+	inline bool EntityRef::operator==(const EntityRef& ref) const
+	{
+		return m_world == ref.m_world && m_id == ref.m_id && m_generation == ref.m_generation;
+	}
+
+	/*!
+	* \brief Checks whether two references are referencing different entities
+	* \return false If it is the case
+	*
+	* \param ref Other reference to compare with
+	*/
+
+	inline bool EntityRef::operator!=(const EntityRef& ref) const
+	{
+		return !operator==(ref);
+	}
+}
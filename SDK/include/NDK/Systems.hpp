@@ -10,6 +10,8 @@
 #include <NDK/Systems/PhysicsSystem2D.hpp>
 #include <NDK/Systems/PhysicsSystem3D.hpp>
 #include <NDK/Systems/RenderSystem.hpp>
+#include <NDK/Systems/ReplicationSystem.hpp>
+#include <NDK/Systems/TransformSystem.hpp>
 #include <NDK/Systems/VelocitySystem.hpp>
 
 #endif // NDK_SYSTEMS_GLOBAL_HPP
@@ -18,6 +18,8 @@ namespace Ndk
 			ListenerSystem();
 			~ListenerSystem() = default;
 
+			const char* GetName() const override;
+
 			static SystemIndex systemIndex;
 
 		private:
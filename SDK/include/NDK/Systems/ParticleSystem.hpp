@@ -18,6 +18,8 @@ namespace Ndk
 			ParticleSystem();
 			~ParticleSystem() = default;
 
+			const char* GetName() const override;
+
 			static SystemIndex systemIndex;
 
 		private:
@@ -21,6 +21,7 @@ namespace Ndk
 			PhysicsSystem2D(const PhysicsSystem2D& system);
 			~PhysicsSystem2D() = default;
 
+			const char* GetName() const override;
 			Nz::PhysWorld2D& GetWorld();
 			const Nz::PhysWorld2D& GetWorld() const;
 
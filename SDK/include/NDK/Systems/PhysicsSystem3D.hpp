@@ -21,6 +21,7 @@ namespace Ndk
 			PhysicsSystem3D(const PhysicsSystem3D& system);
 			~PhysicsSystem3D() = default;
 
+			const char* GetName() const override;
 			Nz::PhysWorld3D& GetWorld();
 			const Nz::PhysWorld3D& GetWorld() const;
 
@@ -31,13 +31,18 @@ namespace Ndk
 			template<typename T> T& ChangeRenderTechnique();
 			inline Nz::AbstractRenderTechnique& ChangeRenderTechnique(std::unique_ptr<Nz::AbstractRenderTechnique>&& renderTechnique);
 
+			void EnableInterpolation(bool enable = true);
+
 			inline const Nz::BackgroundRef& GetDefaultBackground() const;
 			inline const Nz::Matrix4f& GetCoordinateSystemMatrix() const;
 			inline Nz::Vector3f GetGlobalForward() const;
 			inline Nz::Vector3f GetGlobalRight() const;
 			inline Nz::Vector3f GetGlobalUp() const;
+			const char* GetName() const override;
 			inline Nz::AbstractRenderTechnique& GetRenderTechnique() const;
 
+			inline bool IsInterpolationEnabled() const;
+
 			inline void SetDefaultBackground(Nz::BackgroundRef background);
 			inline void SetGlobalForward(const Nz::Vector3f& direction);
 			inline void SetGlobalRight(const Nz::Vector3f& direction);
@@ -70,6 +75,7 @@ namespace Ndk
 			Nz::RenderTexture m_shadowRT;
 			bool m_coordinateSystemInvalidated;
 			bool m_forceRenderQueueInvalidation;
+			bool m_interpolationEnabled;
 	};
 }
 
@@ -11,7 +11,8 @@ namespace Ndk
 	*/
 
 	inline RenderSystem::RenderSystem(const RenderSystem& renderSystem) :
-	System(renderSystem)
+	System(renderSystem),
+	m_interpolationEnabled(renderSystem.m_interpolationEnabled)
 	{
 	}
 
@@ -100,6 +101,18 @@ namespace Ndk
 		return *m_renderTechnique.get();
 	}
 
+	/*!
+	* \brief Checks whether drawables are interpolated between the last two ticks of the world
+	* \return true If it is the case
+	*
+	* \see EnableInterpolation
+	*/
+
+	inline bool RenderSystem::IsInterpolationEnabled() const
+	{
+		return m_interpolationEnabled;
+	}
+
 	/*!
 	* \brief Sets the background used for rendering
 	*
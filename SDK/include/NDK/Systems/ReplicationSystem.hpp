@@ -0,0 +1,124 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_SYSTEMS_REPLICATIONSYSTEM_HPP
+#define NDK_SYSTEMS_REPLICATIONSYSTEM_HPP
+
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <NDK/System.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class ENetPeer;
+	class NetPacket;
+}
+
+namespace Ndk
+{
+	class NDK_API ReplicationSystem : public System<ReplicationSystem>
+	{
+		public:
+			ReplicationSystem();
+			ReplicationSystem(const ReplicationSystem& system);
+			~ReplicationSystem() = default;
+
+			void AddPeer(Nz::ENetPeer* peer, Nz::UInt32 bandwidth = DefaultBandwidth);
+
+			inline float GetCellSize() const;
+			inline Nz::UInt8 GetChannel() const;
+			const char* GetName() const override;
+			inline std::size_t GetPeerCount() const;
+			const EntityHandle& GetRemoteEntity(EntityId remoteId) const;
+
+			bool HandlePacket(const Nz::NetPacket& packet);
+			inline bool HasPeer(Nz::ENetPeer* peer) const;
+
+			void RemovePeer(Nz::ENetPeer* peer);
+
+			void SetCellSize(float cellSize);
+			inline void SetChannel(Nz::UInt8 channelId);
+			void SetPeerBandwidth(Nz::ENetPeer* peer, Nz::UInt32 bandwidth);
+			void SetPeerViewer(Nz::ENetPeer* peer, const Nz::Vector3f& position, float radius);
+
+			static constexpr Nz::UInt32 DefaultBandwidth = 32 * 1024;
+
+			static SystemIndex systemIndex;
+
+		private:
+			struct PeerState;
+
+			void BuildCache();
+			void OnUpdate(float elapsedTime) override;
+			void ReplicateTo(PeerState& peer, float elapsedTime);
+
+			template<typename F> void QueryGrid(const Nz::Vector3f& position, float radius, F&& callback) const;
+
+			struct CachedComponent
+			{
+				ComponentId id;
+				ComponentIndex index;
+				Nz::UInt64 hash;
+				std::size_t offset;
+				std::size_t size;
+			};
+
+			struct CachedEntity
+			{
+				EntityId id;
+				Nz::UInt32 generation;
+				Nz::Vector3f position;
+				std::size_t componentCount;
+				std::size_t firstComponent;
+				float priority;
+				bool alwaysRelevant;
+			};
+
+			struct PeerEntity
+			{
+				std::vector<std::pair<ComponentIndex, Nz::UInt64>> sentHashes;
+				Nz::UInt32 generation;
+				Nz::UInt64 lastRelevantTick;
+				float priority;
+				bool known;
+			};
+
+			struct PeerState
+			{
+				std::unordered_map<EntityId, PeerEntity> entities;
+				std::vector<std::pair<PeerEntity*, std::size_t>> candidates;
+				Nz::ENetPeer* peer;
+				Nz::UInt32 bandwidth;
+				Nz::Vector3f viewerPosition;
+				float budget;
+				float viewerRadius;
+				bool hasViewer;
+			};
+
+			struct RemoteEntity
+			{
+				EntityHandle entity;
+				Nz::UInt32 generation;
+			};
+
+			std::unordered_map<EntityId, RemoteEntity> m_remoteEntities;
+			std::unordered_map<Nz::ENetPeer*, PeerState> m_peers;
+			std::unordered_map<Nz::UInt64, std::vector<std::size_t>> m_grid;
+			std::vector<CachedComponent> m_cachedComponents;
+			std::vector<CachedEntity> m_cachedEntities;
+			std::vector<std::size_t> m_globalEntities;
+			Nz::ByteArray m_componentData;
+			Nz::UInt64 m_tick;
+			Nz::UInt8 m_channelId;
+			float m_cellSize;
+	};
+}
+
+#include <NDK/Systems/ReplicationSystem.inl>
+
+#endif // NDK_SYSTEMS_REPLICATIONSYSTEM_HPP
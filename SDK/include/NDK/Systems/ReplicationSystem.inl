@@ -0,0 +1,59 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+namespace Ndk
+{
+	/*!
+	* \brief Gets the size of the cells of the spatial grid used for relevance filtering
+	* \return Size of a cell
+	*/
+
+	inline float ReplicationSystem::GetCellSize() const
+	{
+		return m_cellSize;
+	}
+
+	/*!
+	* \brief Gets the channel used to send replication packets
+	* \return Channel identifier
+	*/
+
+	inline Nz::UInt8 ReplicationSystem::GetChannel() const
+	{
+		return m_channelId;
+	}
+
+	/*!
+	* \brief Gets the number of peers the world is replicated to
+	* \return Number of peers
+	*/
+
+	inline std::size_t ReplicationSystem::GetPeerCount() const
+	{
+		return m_peers.size();
+	}
+
+	/*!
+	* \brief Checks whether the world is replicated to a peer
+	* \return true If the peer was added to the system
+	*
+	* \param peer Peer to check
+	*/
+
+	inline bool ReplicationSystem::HasPeer(Nz::ENetPeer* peer) const
+	{
+		return m_peers.find(peer) != m_peers.end();
+	}
+
+	/*!
+	* \brief Sets the channel used to send replication packets
+	*
+	* \param channelId Channel identifier, must be lower than the channel count of the host
+	*/
+
+	inline void ReplicationSystem::SetChannel(Nz::UInt8 channelId)
+	{
+		m_channelId = channelId;
+	}
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_SYSTEMS_TRANSFORMSYSTEM_HPP
+#define NDK_SYSTEMS_TRANSFORMSYSTEM_HPP
+
+#include <NDK/System.hpp>
+#include <vector>
+
+namespace Ndk
+{
+	class NodeComponent;
+
+	class NDK_API TransformSystem : public System<TransformSystem>
+	{
+		friend NodeComponent;
+
+		public:
+			TransformSystem();
+			TransformSystem(const TransformSystem& system);
+			~TransformSystem();
+
+			const char* GetName() const override;
+
+			static SystemIndex systemIndex;
+
+		private:
+			inline void InvalidateHierarchy();
+
+			void OnEntityRemoved(Entity* entity) override;
+			void OnEntityValidation(Entity* entity, bool justAdded) override;
+			void OnUpdate(float elapsedTime) override;
+
+			void SortNodes();
+
+			std::vector<NodeComponent*> m_sortedNodes;
+			bool m_hierarchyUpdated;
+	};
+}
+
+#include <NDK/Systems/TransformSystem.inl>
+
+#endif // NDK_SYSTEMS_TRANSFORMSYSTEM_HPP
@@ -0,0 +1,15 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+namespace Ndk
+{
+	/*!
+	* \brief Invalidates the order of the nodes, when the hierarchy has changed
+	*/
+
+	inline void TransformSystem::InvalidateHierarchy()
+	{
+		m_hierarchyUpdated = false;
+	}
+}
@@ -17,6 +17,8 @@ namespace Ndk
 			VelocitySystem();
 			~VelocitySystem() = default;
 
+			const char* GetName() const override;
+
 			static SystemIndex systemIndex;
 
 		private:
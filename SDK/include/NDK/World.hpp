@@ -9,8 +9,10 @@
 
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/HandledObject.hpp>
+#include <NDK/ComponentStorage.hpp>
 #include <NDK/Entity.hpp>
 #include <NDK/EntityList.hpp>
+#include <NDK/EntityPrefab.hpp>
 #include <NDK/System.hpp>
 #include <algorithm>
 #include <memory>
@@ -27,6 +29,7 @@ namespace Ndk
 	{
 		friend BaseSystem;
 		friend Entity;
+		friend class WorldSnapshot;
 
 		public:
 			using EntityVector = std::vector<EntityHandle>;
@@ -42,15 +45,28 @@ namespace Ndk
 			template<typename SystemType, typename... Args> SystemType& AddSystem(Args&&... args);
 
 			const EntityHandle& CreateEntity();
+			const EntityHandle& CreateEntity(const EntityPrefab& prefab);
 			inline EntityVector CreateEntities(unsigned int count);
+			EntityVector CreateEntities(const EntityPrefab& prefab, unsigned int count);
 
 			void Clear() noexcept;
 			const EntityHandle& CloneEntity(EntityId id);
 
+			template<typename ComponentType> ComponentStorage<ComponentType>& EnableComponentStorage(std::size_t componentsPerChunk = 0);
+			inline void EnableParallelUpdate(bool enable = true);
+
+			inline void FixedUpdate(float timestep);
+			inline void FrameUpdate(float elapsedTime, float interpolationFactor = 1.f);
+
+			inline BaseComponentStorage* GetComponentStorage(ComponentIndex index) const;
+			template<typename ComponentType> ComponentStorage<ComponentType>* GetComponentStorage() const;
 			inline const EntityHandle& GetEntity(EntityId id);
+			inline Nz::UInt32 GetEntityGeneration(EntityId id) const;
 			inline const EntityList& GetEntities() const;
+			inline float GetInterpolationFactor() const;
 			inline BaseSystem& GetSystem(SystemIndex index);
 			template<typename SystemType> SystemType& GetSystem();
+			inline Nz::UInt64 GetTickCount() const;
 
 			inline bool HasSystem(SystemIndex index) const;
 			template<typename SystemType> bool HasSystem() const;
@@ -60,6 +76,7 @@ namespace Ndk
 
 			inline bool IsEntityValid(const Entity* entity) const;
 			inline bool IsEntityIdValid(EntityId id) const;
+			inline bool IsParallelUpdateEnabled() const;
 
 			inline void RemoveAllSystems();
 			inline void RemoveSystem(SystemIndex index);
@@ -72,10 +89,21 @@ namespace Ndk
 			inline World& operator=(World&& world) noexcept;
 
 		private:
+			enum UpdateFlags
+			{
+				UpdateFlags_Fixed = 0x1,
+				UpdateFlags_Frame = 0x2,
+
+				UpdateFlags_All = UpdateFlags_Fixed | UpdateFlags_Frame
+			};
+
 			inline void Invalidate();
 			inline void Invalidate(EntityId id);
 			inline void InvalidateSystemOrder();
 			void ReorderSystems();
+			const EntityHandle& RestoreEntity(EntityId id, Nz::UInt32 generation);
+			inline void UpdateSystems(float elapsedTime, Nz::UInt32 updateFlags);
+			void UpdateSystemsParallel(float elapsedTime, Nz::UInt32 updateFlags);
 
 			struct EntityBlock
 			{
@@ -91,16 +119,21 @@ namespace Ndk
 				EntityHandle handle;
 			};
 
+			std::vector<std::unique_ptr<BaseComponentStorage>> m_componentStorages; //< Must outlive entities
 			std::vector<std::unique_ptr<BaseSystem>> m_systems;
 			std::vector<BaseSystem*> m_orderedSystems;
 			std::vector<EntityBlock> m_entities;
 			std::vector<EntityBlock*> m_entityBlocks;
+			std::vector<Nz::UInt32> m_entityGenerations;
 			std::vector<std::unique_ptr<EntityBlock>> m_waitingEntities;
 			std::vector<EntityId> m_freeIdList;
 			EntityList m_aliveEntities;
 			Nz::Bitset<Nz::UInt64> m_dirtyEntities;
 			Nz::Bitset<Nz::UInt64> m_killedEntities;
+			Nz::UInt64 m_tickCount;
+			float m_interpolationFactor;
 			bool m_orderedSystemsUpdated;
+			bool m_parallelUpdate;
 	};
 }
 
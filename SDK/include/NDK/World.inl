@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Prerequesites.hpp
 
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <type_traits>
 
 namespace Ndk
@@ -13,7 +14,10 @@ namespace Ndk
 	* \param addDefaultSystems Should default provided systems be used
 	*/
 
-	inline World::World(bool addDefaultSystems)
+	inline World::World(bool addDefaultSystems) :
+	m_tickCount(0),
+	m_interpolationFactor(1.f),
+	m_parallelUpdate(false)
 	{
 		if (addDefaultSystems)
 			AddDefaultSystems();
@@ -93,6 +97,125 @@ namespace Ndk
 		return list;
 	}
 
+	/*!
+	* \brief Makes the world store components of a type contiguously
+	* \return A reference to the storage
+	*
+	* \param componentsPerChunk Number of components per chunk, zero to fit them in chunks of 16 KiB
+	*
+	* Components created with Entity::AddComponent<ComponentType>(args...) (or cloned) are then constructed in chunks owned by the world,
+	* instead of being heap-allocated one by one, which keeps components accessed together close in memory.
+	* Components are never moved, references to them stay valid.
+	*
+	* \remark Existing components and those added as a std::unique_ptr are not affected
+	* \remark If the world already uses a storage for this component type, it is returned and componentsPerChunk is ignored
+	*/
+
+	template<typename ComponentType>
+	ComponentStorage<ComponentType>& World::EnableComponentStorage(std::size_t componentsPerChunk)
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		ComponentIndex index = GetComponentIndex<ComponentType>();
+		if (index >= m_componentStorages.size())
+			m_componentStorages.resize(index + 1);
+
+		if (!m_componentStorages[index])
+			m_componentStorages[index] = std::make_unique<ComponentStorage<ComponentType>>(componentsPerChunk);
+
+		return static_cast<ComponentStorage<ComponentType>&>(*m_componentStorages[index]);
+	}
+
+	/*!
+	* \brief Enables or disables the update of systems in parallel
+	*
+	* \param enable Should systems be updated in parallel
+	*
+	* When enabled, Update(float) runs systems which declared their component access (see BaseSystem::Reads and BaseSystem::Writes)
+	* as tasks of the TaskScheduler, a system only waiting for the previous systems (in update order) it conflicts with.
+	* Systems which did not declare their component access are still updated on the calling thread, after every previous system.
+	*
+	* \remark Systems updated in parallel must not create or kill entities, nor add or remove components
+	*
+	* \see BaseSystem::ConflictsWith
+	*/
+
+	inline void World::EnableParallelUpdate(bool enable)
+	{
+		m_parallelUpdate = enable;
+	}
+
+	/*!
+	* \brief Advances the simulation of the world by a fixed step
+	*
+	* \param timestep Duration of the simulation step
+	*
+	* Only updates the systems which are part of the simulation (see BaseSystem::EnableFixedUpdate) and increments the tick count.
+	* This is meant to be called zero or more times per frame by a fixed-timestep loop (as Application's one), before FrameUpdate.
+	*
+	* \see FrameUpdate
+	*/
+
+	inline void World::FixedUpdate(float timestep)
+	{
+		NazaraProfileZone("World::FixedUpdate");
+
+		Update(); //< Update entities
+
+		UpdateSystems(timestep, UpdateFlags_Fixed);
+
+		m_tickCount++;
+	}
+
+	/*!
+	* \brief Updates the systems presenting the world, once per frame
+	*
+	* \param elapsedTime Delta time since the last frame
+	* \param interpolationFactor How far between the last two ticks the frame is, in the [0;1] range
+	*
+	* Only updates the systems which are not part of the simulation (see BaseSystem::EnableFixedUpdate),
+	* they can use the interpolation factor to blend the state of the last two ticks.
+	*
+	* \see FixedUpdate
+	* \see GetInterpolationFactor
+	*/
+
+	inline void World::FrameUpdate(float elapsedTime, float interpolationFactor)
+	{
+		NazaraProfileZone("World::FrameUpdate");
+
+		m_interpolationFactor = interpolationFactor;
+
+		Update(); //< Update entities
+
+		UpdateSystems(elapsedTime, UpdateFlags_Frame);
+	}
+
+	/*!
+	* \brief Gets the storage used for a component type
+	* \return Pointer to the storage, or nullptr if components of this type are heap-allocated
+	*
+	* \param index Index of the component
+	*/
+
+	inline BaseComponentStorage* World::GetComponentStorage(ComponentIndex index) const
+	{
+		return (index < m_componentStorages.size()) ? m_componentStorages[index].get() : nullptr;
+	}
+
+	/*!
+	* \brief Gets the storage used for a component type
+	* \return Pointer to the storage, or nullptr if components of this type are heap-allocated
+	*/
+
+	template<typename ComponentType>
+	ComponentStorage<ComponentType>* World::GetComponentStorage() const
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		return static_cast<ComponentStorage<ComponentType>*>(GetComponentStorage(GetComponentIndex<ComponentType>()));
+	}
+
 	/*!
 	* \brief Gets every entities in the world
 	* \return A constant reference to the entities
@@ -103,6 +226,18 @@ namespace Ndk
 		return m_aliveEntities;
 	}
 
+	/*!
+	* \brief Gets the interpolation factor of the current frame
+	* \return How far between the last two ticks the current frame is, 1 meaning the state of the last tick should be presented as-is
+	*
+	* \see FrameUpdate
+	*/
+
+	inline float World::GetInterpolationFactor() const
+	{
+		return m_interpolationFactor;
+	}
+
 	/*!
 	* \brief Gets a system in the world by index
 	* \return A reference to the system
@@ -138,6 +273,16 @@ namespace Ndk
 		return static_cast<SystemType&>(GetSystem(index));
 	}
 
+	/*!
+	* \brief Gets the number of fixed steps the world simulated
+	* \return Number of FixedUpdate calls since the world creation
+	*/
+
+	inline Nz::UInt64 World::GetTickCount() const
+	{
+		return m_tickCount;
+	}
+
 	/*!
 	* \brief Checks whether or not a system is present in the world by index
 	* \return true If it is the case
@@ -211,6 +356,24 @@ namespace Ndk
 		}
 	}
 
+	/*!
+	* \brief Gets the generation of an entity identifier
+	* \return Number of times the identifier was given to a new entity, minus one
+	*
+	* \param id Identifier of the entity
+	*
+	* \remark Produces a NazaraAssert if the identifier was never given to an entity
+	*
+	* \see EntityRef
+	*/
+
+	inline Nz::UInt32 World::GetEntityGeneration(EntityId id) const
+	{
+		NazaraAssert(id < m_entityGenerations.size(), "Invalid ID");
+
+		return m_entityGenerations[id];
+	}
+
 	/*!
 	* \brief Checks whether or not an entity is valid
 	* \return true If it is the case
@@ -235,6 +398,18 @@ namespace Ndk
 		return id < m_entityBlocks.size() && m_entityBlocks[id]->entity.IsValid();
 	}
 
+	/*!
+	* \brief Checks whether systems are updated in parallel
+	* \return true If it is the case
+	*
+	* \see EnableParallelUpdate
+	*/
+
+	inline bool World::IsParallelUpdateEnabled() const
+	{
+		return m_parallelUpdate;
+	}
+
 	/*!
 	* \brief Removes each system from the world
 	*/
@@ -285,11 +460,12 @@ namespace Ndk
 
 	inline void World::Update(float elapsedTime)
 	{
+		NazaraProfileZone("World::Update");
+
 		Update(); //< Update entities
 
 		// And then update systems
-		for (auto& systemPtr : m_orderedSystems)
-			systemPtr->Update(elapsedTime);
+		UpdateSystems(elapsedTime, UpdateFlags_All);
 	}
 
 	/*!
@@ -302,16 +478,23 @@ namespace Ndk
 		m_aliveEntities         = std::move(world.m_aliveEntities);
 		m_dirtyEntities         = std::move(world.m_dirtyEntities);
 		m_entityBlocks          = std::move(world.m_entityBlocks);
+		m_entityGenerations     = std::move(world.m_entityGenerations);
 		m_freeIdList            = std::move(world.m_freeIdList);
+		m_interpolationFactor   = world.m_interpolationFactor;
 		m_killedEntities        = std::move(world.m_killedEntities);
 		m_orderedSystems        = std::move(world.m_orderedSystems);
 		m_orderedSystemsUpdated = world.m_orderedSystemsUpdated;
+		m_parallelUpdate        = world.m_parallelUpdate;
+		m_tickCount             = world.m_tickCount;
 		m_waitingEntities       = std::move(world.m_waitingEntities);
 
 		m_entities = std::move(world.m_entities);
 		for (EntityBlock& block : m_entities)
 			block.entity.SetWorld(this);
 
+		// Components of our previous entities are destroyed, storages can be replaced
+		m_componentStorages = std::move(world.m_componentStorages);
+
 		m_systems = std::move(world.m_systems);
 		for (const auto& systemPtr : m_systems)
 			systemPtr->SetWorld(this);
@@ -334,4 +517,18 @@ namespace Ndk
 	{
 		m_orderedSystemsUpdated = false;
 	}
+
+	inline void World::UpdateSystems(float elapsedTime, Nz::UInt32 updateFlags)
+	{
+		if (m_parallelUpdate)
+			UpdateSystemsParallel(elapsedTime, updateFlags);
+		else
+		{
+			for (BaseSystem* system : m_orderedSystems)
+			{
+				if (updateFlags & ((system->IsFixedUpdateEnabled()) ? UpdateFlags_Fixed : UpdateFlags_Frame))
+					system->Update(elapsedTime);
+			}
+		}
+	}
 }
@@ -0,0 +1,53 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#pragma once
+
+#ifndef NDK_WORLDSNAPSHOT_HPP
+#define NDK_WORLDSNAPSHOT_HPP
+
+#include <Nazara/Core/ByteArray.hpp>
+#include <NDK/Prerequesites.hpp>
+
+namespace Ndk
+{
+	class World;
+
+	class NDK_API WorldSnapshot
+	{
+		public:
+			WorldSnapshot() = default;
+			inline explicit WorldSnapshot(Nz::ByteArray data);
+			WorldSnapshot(const WorldSnapshot&) = default;
+			WorldSnapshot(WorldSnapshot&&) = default;
+			~WorldSnapshot() = default;
+
+			bool ApplyDelta(const WorldSnapshot& base, const Nz::ByteArray& delta);
+
+			void Capture(const World& world);
+			inline void Clear();
+			void ComputeDelta(const WorldSnapshot& base, Nz::ByteArray* delta) const;
+
+			inline const Nz::ByteArray& GetData() const;
+			inline std::size_t GetSize() const;
+
+			inline bool IsEmpty() const;
+
+			bool Restore(World& world) const;
+
+			inline void SetData(Nz::ByteArray data);
+
+			WorldSnapshot& operator=(const WorldSnapshot&) = default;
+			WorldSnapshot& operator=(WorldSnapshot&&) = default;
+
+			static constexpr std::size_t MaxDeltaGrowth = 64 * 1024 * 1024; //< Maximum size a delta may add to its base snapshot
+
+		private:
+			Nz::ByteArray m_data;
+	};
+}
+
+#include <NDK/WorldSnapshot.inl>
+
+#endif // NDK_WORLDSNAPSHOT_HPP
@@ -0,0 +1,71 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <utility>
+
+namespace Ndk
+{
+	/*!
+	* \brief Constructs a WorldSnapshot object from serialized data
+	*
+	* \param data Data of a snapshot, as returned by GetData
+	*/
+
+	inline WorldSnapshot::WorldSnapshot(Nz::ByteArray data) :
+	m_data(std::move(data))
+	{
+	}
+
+	/*!
+	* \brief Clears the snapshot
+	*
+	* \remark The memory is kept for the next capture
+	*/
+
+	inline void WorldSnapshot::Clear()
+	{
+		m_data.Clear(true);
+	}
+
+	/*!
+	* \brief Gets the serialized data of the snapshot
+	* \return Binary representation of the snapshot, which can be sent over the network
+	*/
+
+	inline const Nz::ByteArray& WorldSnapshot::GetData() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Gets the size of the snapshot
+	* \return Size in bytes of the serialized data
+	*/
+
+	inline std::size_t WorldSnapshot::GetSize() const
+	{
+		return m_data.GetSize();
+	}
+
+	/*!
+	* \brief Checks whether the snapshot holds anything
+	* \return true if nothing was captured
+	*/
+
+	inline bool WorldSnapshot::IsEmpty() const
+	{
+		return m_data.IsEmpty();
+	}
+
+	/*!
+	* \brief Sets the serialized data of the snapshot
+	*
+	* \param data Data of a snapshot, as returned by GetData
+	*/
+
+	inline void WorldSnapshot::SetData(Nz::ByteArray data)
+	{
+		m_data = std::move(data);
+	}
+}
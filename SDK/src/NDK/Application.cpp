@@ -4,6 +4,7 @@
 
 #include <NDK/Application.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Thread.hpp>
 #include <regex>
 
 #ifndef NDK_SERVER
@@ -106,11 +107,48 @@ namespace Ndk
 		if (m_shouldQuit)
 			return false;
 
-		m_updateTime = m_updateClock.GetSeconds();
-		m_updateClock.Restart();
+		if (m_fixedUpdateStep > 0 && m_fixedUpdateWait)
+			WaitForFixedUpdate();
 
-		for (World& world : m_worlds)
-			world.Update(m_updateTime);
+		Nz::UInt64 currentTime = m_updateClock.GetMicroseconds();
+		Nz::UInt64 elapsedTime = currentTime - m_lastUpdateTime;
+		m_lastUpdateTime = currentTime;
+
+		m_updateTime = elapsedTime / 1000000.f;
+
+		if (m_fixedUpdateStep > 0)
+		{
+			float timestep = m_fixedUpdateStep / 1000000.f;
+
+			m_fixedUpdateAccumulator += elapsedTime;
+
+			unsigned int fixedUpdateCount = 0;
+			while (m_fixedUpdateAccumulator >= m_fixedUpdateStep)
+			{
+				if (fixedUpdateCount >= m_maxFixedUpdates)
+				{
+					// We can't catch up, drop the extra time instead of making the next frames even longer
+					m_fixedUpdateAccumulator %= m_fixedUpdateStep;
+					break;
+				}
+
+				for (World& world : m_worlds)
+					world.FixedUpdate(timestep);
+
+				m_fixedUpdateAccumulator -= m_fixedUpdateStep;
+				fixedUpdateCount++;
+			}
+
+			m_interpolationFactor = static_cast<float>(m_fixedUpdateAccumulator) / m_fixedUpdateStep;
+
+			for (World& world : m_worlds)
+				world.FrameUpdate(m_updateTime, m_interpolationFactor);
+		}
+		else
+		{
+			for (World& world : m_worlds)
+				world.Update(m_updateTime);
+		}
 
 		#ifndef NDK_SERVER
 		for (WindowInfo& info : m_windows)
@@ -247,5 +285,25 @@ namespace Ndk
 	}
 	#endif
 
+	/*!
+	* \brief Waits until the next fixed update is due
+	*
+	* Sleeps for most of the remaining time and busy-waits for the last moments, as sleeping is only precise to the scheduler resolution
+	*/
+	void Application::WaitForFixedUpdate() const
+	{
+		Nz::UInt64 nextUpdateTime = m_lastUpdateTime + m_fixedUpdateStep - std::min(m_fixedUpdateAccumulator, m_fixedUpdateStep);
+
+		Nz::UInt64 currentTime = m_updateClock.GetMicroseconds();
+		if (currentTime >= nextUpdateTime)
+			return;
+
+		Nz::UInt64 remainingTime = nextUpdateTime - currentTime;
+		if (remainingTime > m_fixedUpdateSpinDuration)
+			Nz::Thread::Sleep(static_cast<Nz::UInt32>((remainingTime - m_fixedUpdateSpinDuration) / 1000));
+
+		while (m_updateClock.GetMicroseconds() < nextUpdateTime);
+	}
+
 	Application* Application::s_application = nullptr;
 }
@@ -16,6 +16,40 @@ namespace Ndk
 
 	BaseComponent::~BaseComponent() = default;
 
+	/*!
+	* \brief Serializes the state of the component
+	* \return true if the component was serialized, false if it does not support serialization
+	*
+	* \param context Context of the serialization
+	*
+	* \remark Components are not serializable by default, they are skipped by WorldSnapshot
+	*
+	* \see Unserialize
+	*/
+
+	bool BaseComponent::Serialize(Nz::SerializationContext& context) const
+	{
+		NazaraUnused(context);
+
+		return false;
+	}
+
+	/*!
+	* \brief Restores the state of the component
+	* \return true if the component was unserialized successfully
+	*
+	* \param context Context of the unserialization, holding data written by Serialize
+	*
+	* \see Serialize
+	*/
+
+	bool BaseComponent::Unserialize(Nz::SerializationContext& context)
+	{
+		NazaraUnused(context);
+
+		return false;
+	}
+
 	/*!
 	* \brief Operation to perform when component is attached to an entity
 	*/
@@ -12,6 +12,11 @@ namespace Ndk
 	* \class Ndk::BaseSystem
 	* \brief NDK class that represents the common base of all systems
 	*
+	* Systems declaring which components they read and write during their update (see Reads and Writes) may be updated at the same time by the world (see World::EnableParallelUpdate).
+	* A read only uses the const interface of the component, which must then be safe to call from several threads at once:
+	* this is the case of NodeComponent, whose global getters update its derived data under a lock (see Nz::Node), so reading a node (even its global position) only requires Reads.
+	* Anything else (setters, signals) requires Writes.
+	*
 	* \remark This class is meant to be purely abstract, for type erasure
 	*/
 
@@ -25,6 +30,25 @@ namespace Ndk
 			entity->UnregisterSystem(m_systemIndex);
 	}
 
+	/*!
+	* \brief Checks whether this system and another one may not be updated at the same time
+	* \return true If one of them writes a component the other one reads or writes, or if one of them did not declare its component access
+	*
+	* \param system Other system
+	*
+	* \see Reads, Writes
+	*/
+
+	bool BaseSystem::ConflictsWith(const BaseSystem& system) const
+	{
+		if (!HasComponentAccess() || !system.HasComponentAccess())
+			return true;
+
+		return m_writtenComponents.Intersects(system.m_readComponents) ||
+		       m_writtenComponents.Intersects(system.m_writtenComponents) ||
+		       m_readComponents.Intersects(system.m_writtenComponents);
+	}
+
 	/*!
 	* \brief Checks whether the key of the entity matches the lock of the system
 	* \return true If it is the case
@@ -57,6 +81,18 @@ namespace Ndk
 		return true;
 	}
 
+	/*!
+	* \brief Gets the name of the system, used to identify it in profiler zones
+	* \return Name of the system
+	*
+	* \remark Systems should override this, every system not doing so shares the same name
+	*/
+
+	const char* BaseSystem::GetName() const
+	{
+		return "System";
+	}
+
 	/*!
 	* \brief Sets the update order of this system
 	*
@@ -66,6 +102,7 @@ namespace Ndk
 	* \param updateOrder The relative update order of the system
 	*
 	* \remark The update order is only used by World::Update(float) and does not have any effect regarding a call to BaseSystem::Update(float)
+	* \remark When the world updates systems in parallel, this guarantee only holds between conflicting systems (see ConflictsWith)
 	*
 	* \see GetUpdateOrder
 	*/
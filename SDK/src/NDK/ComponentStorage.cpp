@@ -0,0 +1,117 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/ComponentStorage.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <NDK/BaseComponent.hpp>
+#include <cstdint>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ComponentDeleter
+	* \brief NDK class that destroys a component, giving its memory back to its storage (if any)
+	*/
+
+	/*!
+	* \brief Destroys a component
+	*
+	* \param component Component to destroy
+	*/
+
+	void ComponentDeleter::operator()(BaseComponent* component) const
+	{
+		if (storage)
+		{
+			storage->Destroy(component);
+			storage->FreeSlot(slot);
+		}
+		else
+			delete component;
+	}
+
+	/*!
+	* \ingroup NDK
+	* \class Ndk::BaseComponentStorage
+	* \brief NDK class that represents the type-independent part of a ComponentStorage
+	*/
+
+	/*!
+	* \brief Constructs a BaseComponentStorage object
+	*
+	* \param componentIndex Index of the component type stored
+	* \param componentSize Size of a component, multiple of its alignment
+	* \param componentAlignment Alignment of a component
+	* \param componentsPerChunk Number of components per chunk
+	*/
+
+	BaseComponentStorage::BaseComponentStorage(ComponentIndex componentIndex, std::size_t componentSize, std::size_t componentAlignment, std::size_t componentsPerChunk) :
+	m_componentAlignment(componentAlignment),
+	m_componentCount(0),
+	m_componentSize(componentSize),
+	m_componentsPerChunk(componentsPerChunk),
+	m_componentIndex(componentIndex)
+	{
+		NazaraAssert(componentsPerChunk > 0, "Chunks must hold at least one component");
+	}
+
+	/*!
+	* \brief Destructs the object
+	*
+	* \remark Produces a NazaraAssert if components are still alive
+	*/
+
+	BaseComponentStorage::~BaseComponentStorage()
+	{
+		NazaraAssert(m_componentCount == 0, "Storage destroyed while components are still alive");
+	}
+
+	std::size_t BaseComponentStorage::AllocateSlot(EntityId owner)
+	{
+		if (m_freeSlots.empty())
+		{
+			std::size_t chunkIndex = m_chunks.size();
+
+			Chunk chunk;
+			chunk.memory.reset(new Nz::UInt8[m_componentsPerChunk * m_componentSize + m_componentAlignment - 1]);
+			chunk.owners.reset(new EntityId[m_componentsPerChunk]);
+			chunk.usedSlots.Resize(m_componentsPerChunk, false);
+
+			std::uintptr_t address = reinterpret_cast<std::uintptr_t>(chunk.memory.get());
+			chunk.components = chunk.memory.get() + (m_componentAlignment - address % m_componentAlignment) % m_componentAlignment;
+
+			m_chunks.emplace_back(std::move(chunk));
+
+			// Lowest slots first, to keep components packed at the beginning of the chunk
+			m_freeSlots.reserve(m_freeSlots.size() + m_componentsPerChunk);
+			for (std::size_t i = m_componentsPerChunk; i > 0; --i)
+				m_freeSlots.push_back(chunkIndex * m_componentsPerChunk + i - 1);
+		}
+
+		std::size_t slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+
+		Chunk& chunk = m_chunks[slot / m_componentsPerChunk];
+		chunk.owners[slot % m_componentsPerChunk] = owner;
+		chunk.usedSlots.Set(slot % m_componentsPerChunk, true);
+
+		m_componentCount++;
+
+		return slot;
+	}
+
+	void BaseComponentStorage::FreeSlot(std::size_t slot)
+	{
+		NazaraAssert(slot / m_componentsPerChunk < m_chunks.size(), "Slot out of range");
+
+		Chunk& chunk = m_chunks[slot / m_componentsPerChunk];
+		NazaraAssert(chunk.usedSlots.Test(slot % m_componentsPerChunk), "Slot is not in use");
+
+		chunk.usedSlots.Reset(slot % m_componentsPerChunk);
+		m_freeSlots.push_back(slot);
+
+		m_componentCount--;
+	}
+}
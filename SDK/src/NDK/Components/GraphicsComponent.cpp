@@ -94,6 +94,49 @@ namespace Ndk
 			entry.listEntry.ForceInvalidation();
 	}
 
+	/*!
+	* \brief Blends the transformation of the last two simulation ticks
+	*
+	* \param tickCount Tick count of the world, a new tick captures the current state of the node
+	* \param interpolationFactor How far between the previous and the current tick state the frame is
+	*
+	* \remark Entities which did not move between the last two ticks don't invalidate anything
+	* \remark If the node moved without the tick count changing (the world is updated through World::Update, or the entity has been teleported during a frame), the entity is snapped to its new state
+	*/
+
+	void GraphicsComponent::Interpolate(Nz::UInt64 tickCount, float interpolationFactor)
+	{
+		NazaraAssert(m_entity && m_entity->HasComponent<NodeComponent>(), "GraphicsComponent requires NodeComponent");
+
+		bool newTick = m_interpolated && tickCount != m_interpolationTick;
+		if (!m_interpolated || newTick || m_nodeMoved)
+		{
+			const NodeComponent& node = m_entity->GetComponent<NodeComponent>();
+
+			TickState tickState;
+			tickState.position = node.GetPosition(Nz::CoordSys_Global);
+			tickState.rotation = node.GetRotation(Nz::CoordSys_Global);
+			tickState.scale = node.GetScale(Nz::CoordSys_Global);
+
+			m_previousTickState = (newTick) ? m_currentTickState : tickState;
+			m_currentTickState = tickState;
+			m_interpolated = true;
+			m_interpolationTick = tickCount;
+			m_nodeMoved = false;
+		}
+
+		bool moving = m_previousTickState.position != m_currentTickState.position ||
+		              m_previousTickState.rotation != m_currentTickState.rotation ||
+		              m_previousTickState.scale != m_currentTickState.scale;
+
+		// Invalidate one more time once the entity stopped, to snap it to its last state
+		if (moving || m_interpolating)
+			OnNodeInvalidated(nullptr);
+
+		m_interpolating = moving;
+		m_interpolationFactor = interpolationFactor;
+	}
+
 	/*!
 	* \brief Operation to perform when component is attached to an entity
 	*/
@@ -158,7 +201,9 @@ namespace Ndk
 
 	void GraphicsComponent::OnNodeInvalidated(const Nz::Node* node)
 	{
-		NazaraUnused(node);
+		// The node itself moved (as opposed to an interpolation step), see Interpolate
+		if (node)
+			m_nodeMoved = true;
 
 		// Our view matrix depends on NodeComponent position/rotation
 		InvalidateBoundingVolume();
@@ -213,7 +258,17 @@ namespace Ndk
 	{
 		NazaraAssert(m_entity && m_entity->HasComponent<NodeComponent>(), "GraphicsComponent requires NodeComponent");
 
-		m_transformMatrix = m_entity->GetComponent<NodeComponent>().GetTransformMatrix();
+		if (m_interpolated)
+		{
+			Nz::Vector3f position = Nz::Vector3f::Lerp(m_previousTickState.position, m_currentTickState.position, m_interpolationFactor);
+			Nz::Quaternionf rotation = Nz::Quaternionf::Slerp(m_previousTickState.rotation, m_currentTickState.rotation, m_interpolationFactor);
+			Nz::Vector3f scale = Nz::Vector3f::Lerp(m_previousTickState.scale, m_currentTickState.scale, m_interpolationFactor);
+
+			m_transformMatrix = Nz::Matrix4f::Transform(position, rotation, scale);
+		}
+		else
+			m_transformMatrix = m_entity->GetComponent<NodeComponent>().GetTransformMatrix();
+
 		m_transformMatrixUpdated = true;
 	}
 
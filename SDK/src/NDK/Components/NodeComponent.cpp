@@ -3,8 +3,102 @@
 // For conditions of distribution and use, see copyright notice in Prerequesites.hpp
 
 #include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Systems/TransformSystem.hpp>
 
 namespace Ndk
 {
+	/*!
+	* \brief Serializes the local transformation of the node
+	* \return true if successful
+	*
+	* \param context Context of the serialization
+	*
+	* \remark The parent of the node is not part of the serialized data
+	*/
+
+	bool NodeComponent::Serialize(Nz::SerializationContext& context) const
+	{
+		if (!Nz::Serialize(context, GetPosition(Nz::CoordSys_Local)))
+			return false;
+
+		if (!Nz::Serialize(context, GetRotation(Nz::CoordSys_Local)))
+			return false;
+
+		if (!Nz::Serialize(context, GetScale(Nz::CoordSys_Local)))
+			return false;
+
+		return true;
+	}
+
+	/*!
+	* \brief Restores the local transformation of the node
+	* \return true if successful
+	*
+	* \param context Context of the unserialization
+	*/
+
+	bool NodeComponent::Unserialize(Nz::SerializationContext& context)
+	{
+		Nz::Vector3f position;
+		if (!Nz::Unserialize(context, &position))
+			return false;
+
+		Nz::Quaternionf rotation;
+		if (!Nz::Unserialize(context, &rotation))
+			return false;
+
+		Nz::Vector3f scale;
+		if (!Nz::Unserialize(context, &scale))
+			return false;
+
+		SetPosition(position);
+		SetRotation(rotation);
+		SetScale(scale);
+
+		return true;
+	}
+
+	/*!
+	* \brief Operation to perform when the node is invalidated
+	*
+	* If the entity is handled by a TransformSystem, the OnNodeInvalidation signal is deferred to its next update
+	*/
+
+	void NodeComponent::OnInvalidation()
+	{
+		if (m_transformSystem)
+			m_invalidationPending = true;
+		else
+			Nz::Node::OnInvalidation();
+	}
+
+	/*!
+	* \brief Operation to perform when the node gets a new parent
+	*
+	* \param parent Pointer to the new parent
+	*/
+
+	void NodeComponent::OnParenting(const Nz::Node* parent)
+	{
+		if (m_transformSystem)
+			m_transformSystem->InvalidateHierarchy();
+
+		Nz::Node::OnParenting(parent);
+	}
+
+	/*!
+	* \brief Sets the TransformSystem handling the node
+	*
+	* \param system Pointer to the system, nullptr to signal invalidations immediately again (signaling the deferred one, if any)
+	*/
+
+	void NodeComponent::SetTransformSystem(TransformSystem* system)
+	{
+		m_transformSystem = system;
+
+		if (!m_transformSystem)
+			DispatchInvalidation();
+	}
+
 	ComponentIndex NodeComponent::componentIndex;
 }
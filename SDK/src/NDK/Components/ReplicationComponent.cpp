@@ -0,0 +1,10 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/Components/ReplicationComponent.hpp>
+
+namespace Ndk
+{
+	ComponentIndex ReplicationComponent::componentIndex;
+}
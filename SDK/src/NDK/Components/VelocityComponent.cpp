@@ -6,5 +6,29 @@
 
 namespace Ndk
 {
+	/*!
+	* \brief Serializes the velocity
+	* \return true if successful
+	*
+	* \param context Context of the serialization
+	*/
+
+	bool VelocityComponent::Serialize(Nz::SerializationContext& context) const
+	{
+		return Nz::Serialize(context, linearVelocity);
+	}
+
+	/*!
+	* \brief Restores the velocity
+	* \return true if successful
+	*
+	* \param context Context of the unserialization
+	*/
+
+	bool VelocityComponent::Unserialize(Nz::SerializationContext& context)
+	{
+		return Nz::Unserialize(context, &linearVelocity);
+	}
+
 	ComponentIndex VelocityComponent::componentIndex;
 }
@@ -23,6 +23,7 @@ namespace Ndk
 	Entity::Entity(Entity&& entity) :
 	HandledObject(std::move(entity)),
 	m_components(std::move(entity.m_components)),
+	m_componentGenerations(std::move(entity.m_componentGenerations)),
 	m_containedInLists(std::move(entity.m_containedInLists)),
 	m_componentBits(std::move(entity.m_componentBits)),
 	m_removedComponentBits(std::move(entity.m_removedComponentBits)),
@@ -73,30 +74,7 @@ namespace Ndk
 	{
 		NazaraAssert(componentPtr, "Component must be valid");
 
-		ComponentIndex index = componentPtr->GetIndex();
-
-		// We ensure that the vector has enough space
-		if (index >= m_components.size())
-			m_components.resize(index + 1);
-
-		// Affectation and return of the component
-		m_components[index] = std::move(componentPtr);
-		m_componentBits.UnboundedSet(index);
-		m_removedComponentBits.UnboundedReset(index);
-
-		Invalidate();
-
-		// We get the new component and we alert other existing components of the new one
-		BaseComponent& component = *m_components[index].get();
-		component.SetEntity(this);
-
-		for (std::size_t i = m_componentBits.FindFirst(); i != m_componentBits.npos; i = m_componentBits.FindNext(i))
-		{
-			if (i != index)
-				m_components[i]->OnComponentAttached(component);
-		}
-
-		return component;
+		return AttachComponent(ComponentPtr(componentPtr.release()));
 	}
 
 	/*!
@@ -133,6 +111,49 @@ namespace Ndk
 		m_world->Invalidate(m_id);
 	}
 
+	/*!
+	* \brief Attaches a component to the entity
+	* \return A reference to the newly added component
+	*
+	* \param componentPtr Component to attach, either heap-allocated or living in a component storage
+	*
+	* \remark Produces a NazaraAssert if component is nullptr
+	*/
+
+	BaseComponent& Entity::AttachComponent(ComponentPtr&& componentPtr)
+	{
+		NazaraAssert(componentPtr, "Component must be valid");
+
+		ComponentIndex index = componentPtr->GetIndex();
+
+		// We ensure that the vector has enough space
+		if (index >= m_components.size())
+			m_components.resize(index + 1);
+
+		// A replaced component must not be resolved by references to the previous one
+		if (HasComponent(index))
+			IncrementComponentGeneration(index);
+
+		// Affectation and return of the component
+		m_components[index] = std::move(componentPtr);
+		m_componentBits.UnboundedSet(index);
+		m_removedComponentBits.UnboundedReset(index);
+
+		Invalidate();
+
+		// We get the new component and we alert other existing components of the new one
+		BaseComponent& component = *m_components[index].get();
+		component.SetEntity(this);
+
+		for (std::size_t i = m_componentBits.FindFirst(); i != m_componentBits.npos; i = m_componentBits.FindNext(i))
+		{
+			if (i != index)
+				m_components[i]->OnComponentAttached(component);
+		}
+
+		return component;
+	}
+
 	/*!
 	* \brief Creates the entity
 	*/
@@ -213,7 +234,20 @@ namespace Ndk
 
 			m_components[index].reset();
 			m_componentBits.Reset(index);
+
+			IncrementComponentGeneration(index);
 		}
 	}
 
+	/*!
+	* \brief Gets the storage used by the world for a component type
+	* \return Pointer to the storage, or nullptr if components of this type are heap-allocated
+	*
+	* \param index Index of the component
+	*/
+
+	BaseComponentStorage* Entity::GetComponentStorage(ComponentIndex index) const
+	{
+		return m_world->GetComponentStorage(index);
+	}
 }
@@ -7,8 +7,13 @@
 
 namespace Ndk
 {
+	const EntityHandle& EntityList::GetEntity(EntityId id) const
+	{
+		return m_world->GetEntity(id);
+	}
+
 	const EntityHandle& EntityList::iterator::operator*() const
 	{
-		return m_list->GetWorld()->GetEntity(static_cast<EntityId>(m_nextEntityId));
+		return m_list->GetEntity(static_cast<EntityId>(m_nextEntityId));
 	}
 }
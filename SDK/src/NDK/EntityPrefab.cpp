@@ -0,0 +1,70 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/EntityPrefab.hpp>
+#include <NDK/Entity.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::EntityPrefab
+	* \brief NDK class that represents a set of components to instantiate many entities at once
+	*
+	* Components of a prefab do not belong to any entity, each entity instantiated from the prefab gets a copy of them.
+	*
+	* \see World::CreateEntities
+	*/
+
+	/*!
+	* \brief Constructs an EntityPrefab object from the components of an entity
+	*
+	* \param entity Entity whose components are copied
+	*/
+
+	EntityPrefab::EntityPrefab(const Entity& entity)
+	{
+		const Nz::Bitset<>& componentBits = entity.GetComponentBits();
+		for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+			AddComponent(entity.GetComponent(ComponentIndex(i)).Clone());
+	}
+
+	/*!
+	* \brief Adds a component to the prefab
+	* \return A reference to the newly added component
+	*
+	* \param componentPtr Component to add to the prefab, replacing the component of the same type (if any)
+	*
+	* \remark Produces a NazaraAssert if component is nullptr
+	*/
+
+	BaseComponent& EntityPrefab::AddComponent(std::unique_ptr<BaseComponent>&& componentPtr)
+	{
+		NazaraAssert(componentPtr, "Component must be valid");
+
+		ComponentIndex index = componentPtr->GetIndex();
+		if (index >= m_components.size())
+			m_components.resize(index + 1);
+
+		m_components[index] = std::move(componentPtr);
+		m_componentBits.UnboundedSet(index);
+
+		return *m_components[index];
+	}
+
+	/*!
+	* \brief Removes a component of the prefab by index
+	*
+	* \param index Index of the component
+	*/
+
+	void EntityPrefab::RemoveComponent(ComponentIndex index)
+	{
+		if (HasComponent(index))
+		{
+			m_components[index].reset();
+			m_componentBits.Reset(index);
+		}
+	}
+}
@@ -321,8 +321,8 @@ namespace Ndk
 		state.SetGlobal("CursorPosition");
 
 		// Nz::HashType
-		static_assert(Nz::HashType_Max + 1 == 9, "Nz::HashType has been updated but change was not reflected to Lua binding");
-		state.PushTable(0, 9);
+		static_assert(Nz::HashType_Max + 1 == 10, "Nz::HashType has been updated but change was not reflected to Lua binding");
+		state.PushTable(0, 10);
 		{
 			state.PushField("CRC32", Nz::HashType_CRC32);
 			state.PushField("Fletcher16", Nz::HashType_Fletcher16);
@@ -333,6 +333,7 @@ namespace Ndk
 			state.PushField("SHA384", Nz::HashType_SHA384);
 			state.PushField("SHA512", Nz::HashType_SHA512);
 			state.PushField("Whirlpool", Nz::HashType_Whirlpool);
+			state.PushField("CRC32C", Nz::HashType_CRC32C);
 		}
 		state.SetGlobal("HashType");
 
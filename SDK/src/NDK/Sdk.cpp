@@ -8,6 +8,7 @@
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Lua/Lua.hpp>
+#include <Nazara/Network/Network.hpp>
 #include <Nazara/Noise/Noise.hpp>
 #include <Nazara/Physics2D/Physics2D.hpp>
 #include <Nazara/Physics3D/Physics3D.hpp>
@@ -19,9 +20,12 @@
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/PhysicsComponent2D.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
+#include <NDK/Components/ReplicationComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
 #include <NDK/Systems/PhysicsSystem2D.hpp>
 #include <NDK/Systems/PhysicsSystem3D.hpp>
+#include <NDK/Systems/ReplicationSystem.hpp>
+#include <NDK/Systems/TransformSystem.hpp>
 #include <NDK/Systems/VelocitySystem.hpp>
 
 #ifndef NDK_SERVER
@@ -71,6 +75,7 @@ namespace Ndk
 			#endif
 
 			Nz::Lua::Initialize();
+			Nz::Network::Initialize();
 			Nz::Noise::Initialize();
 			Nz::Physics2D::Initialize();
 			Nz::Physics3D::Initialize();
@@ -93,6 +98,7 @@ namespace Ndk
 			InitializeComponent<NodeComponent>("NdkNode");
 			InitializeComponent<PhysicsComponent2D>("NdkPhys2");
 			InitializeComponent<PhysicsComponent3D>("NdkPhys3");
+			InitializeComponent<ReplicationComponent>("NdkRepl");
 			InitializeComponent<VelocityComponent>("NdkVeloc");
 
 			#ifndef NDK_SERVER
@@ -112,6 +118,8 @@ namespace Ndk
 			// Shared systems
 			InitializeSystem<PhysicsSystem2D>();
 			InitializeSystem<PhysicsSystem3D>();
+			InitializeSystem<ReplicationSystem>();
+			InitializeSystem<TransformSystem>();
 			InitializeSystem<VelocitySystem>();
 
 			#ifndef NDK_SERVER
@@ -168,6 +176,7 @@ namespace Ndk
 
 		// Shared modules
 		Nz::Lua::Uninitialize();
+		Nz::Network::Uninitialize();
 		Nz::Noise::Uninitialize();
 		Nz::Physics2D::Uninitialize();
 		Nz::Physics3D::Uninitialize();
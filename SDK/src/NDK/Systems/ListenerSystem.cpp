@@ -25,9 +25,21 @@ namespace Ndk
 	ListenerSystem::ListenerSystem()
 	{
 		Requires<ListenerComponent, NodeComponent>();
+		Reads<ListenerComponent, NodeComponent, VelocityComponent>();
+		EnableFixedUpdate(false); //< Follow the listener every frame
 		SetUpdateOrder(100); //< Update last, after every movement is done
 	}
 
+	/*!
+	* \brief Gets the name of the system
+	* \return "ListenerSystem"
+	*/
+
+	const char* ListenerSystem::GetName() const
+	{
+		return "ListenerSystem";
+	}
+
 	/*!
 	* \brief Operation to perform when system is updated
 	*
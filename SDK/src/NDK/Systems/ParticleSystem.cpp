@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Prerequesites.hpp
 
 #include <NDK/Systems/ParticleSystem.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/ParticleEmitterComponent.hpp>
 #include <NDK/Components/ParticleGroupComponent.hpp>
 
 namespace Ndk
@@ -22,6 +24,18 @@ namespace Ndk
 	ParticleSystem::ParticleSystem()
 	{
 		Requires<ParticleGroupComponent>();
+		Reads<NodeComponent>(); //< Emitter setup functions usually place particles according to the node of their entity
+		Writes<ParticleEmitterComponent, ParticleGroupComponent>();
+	}
+
+	/*!
+	* \brief Gets the name of the system
+	* \return "ParticleSystem"
+	*/
+
+	const char* ParticleSystem::GetName() const
+	{
+		return "ParticleSystem";
 	}
 
 	/*!
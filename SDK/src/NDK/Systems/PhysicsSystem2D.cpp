@@ -43,6 +43,16 @@ namespace Ndk
 	{
 	}
 
+	/*!
+	* \brief Gets the name of the system
+	* \return "PhysicsSystem2D"
+	*/
+
+	const char* PhysicsSystem2D::GetName() const
+	{
+		return "PhysicsSystem2D";
+	}
+
 	void PhysicsSystem2D::CreatePhysWorld() const
 	{
 		NazaraAssert(!m_world, "Physics world should not be created twice");
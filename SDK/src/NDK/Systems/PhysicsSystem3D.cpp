@@ -43,6 +43,16 @@ namespace Ndk
 	{
 	}
 
+	/*!
+	* \brief Gets the name of the system
+	* \return "PhysicsSystem3D"
+	*/
+
+	const char* PhysicsSystem3D::GetName() const
+	{
+		return "PhysicsSystem3D";
+	}
+
 	void PhysicsSystem3D::CreatePhysWorld() const
 	{
 		NazaraAssert(!m_world, "Physics world should not be created twice");
@@ -87,7 +97,13 @@ namespace Ndk
 
 		m_world->Step(elapsedTime);
 
-		for (const Ndk::EntityHandle& entity : m_dynamicObjects)
+		auto IsInHierarchy = [](const Ndk::EntityHandle& entity)
+		{
+			const NodeComponent& node = entity->GetComponent<NodeComponent>();
+			return node.GetParent() || node.HasChilds();
+		};
+
+		auto UpdateDynamicObject = [](const Ndk::EntityHandle& entity)
 		{
 			NodeComponent& node = entity->GetComponent<NodeComponent>();
 			PhysicsComponent3D& phys = entity->GetComponent<PhysicsComponent3D>();
@@ -95,6 +111,19 @@ namespace Ndk
 			Nz::RigidBody3D& physObj = phys.GetRigidBody();
 			node.SetRotation(physObj.GetRotation(), Nz::CoordSys_Global);
 			node.SetPosition(physObj.GetPosition(), Nz::CoordSys_Global);
+		};
+
+		// Bodies are only read once the step is done, nodes outside of any hierarchy can be synchronized concurrently
+		ParallelForEach(m_dynamicObjects, [&IsInHierarchy, &UpdateDynamicObject](const Ndk::EntityHandle& entity)
+		{
+			if (!IsInHierarchy(entity))
+				UpdateDynamicObject(entity);
+		});
+
+		for (const Ndk::EntityHandle& entity : m_dynamicObjects)
+		{
+			if (IsInHierarchy(entity))
+				UpdateDynamicObject(entity);
 		}
 
 		float invElapsedTime = 1.f / elapsedTime;
@@ -31,14 +31,51 @@ namespace Ndk
 	RenderSystem::RenderSystem() :
 	m_coordinateSystemMatrix(Nz::Matrix4f::Identity()),
 	m_coordinateSystemInvalidated(true),
-	m_forceRenderQueueInvalidation(false)
+	m_forceRenderQueueInvalidation(false),
+	m_interpolationEnabled(false)
 	{
 		ChangeRenderTechnique<Nz::ForwardRenderTechnique>();
+		EnableFixedUpdate(false); //< Render every frame, even when the world is simulated at a fixed rate
 		SetDefaultBackground(Nz::ColorBackground::New());
 		SetUpdateOrder(100); //< Render last, after every movement is done
 		SetUpdateRate(0.f);  //< We don't want any rate limit
 	}
 
+	/*!
+	* \brief Gets the name of the system
+	* \return "RenderSystem"
+	*/
+
+	const char* RenderSystem::GetName() const
+	{
+		return "RenderSystem";
+	}
+
+	/*!
+	* \brief Enables interpolation of the drawables between the last two ticks of the world
+	*
+	* \param enable Should the drawables be interpolated
+	*
+	* When the world is simulated by World::FixedUpdate, drawables are rendered at the global position, rotation and scale
+	* blended between the last two ticks, using the interpolation factor given to World::FrameUpdate.
+	* This smooths movement when rendering at a different rate than the simulation, at the cost of a tick of latency.
+	*
+	* \remark The node components are never modified, only the transformation used for rendering is
+	*/
+
+	void RenderSystem::EnableInterpolation(bool enable)
+	{
+		if (m_interpolationEnabled == enable)
+			return;
+
+		m_interpolationEnabled = enable;
+		if (!enable)
+		{
+			for (const Ndk::EntityHandle& drawable : m_drawables)
+				drawable->GetComponent<GraphicsComponent>().StopInterpolation();
+		}
+	}
+
 	/*!
 	* \brief Operation to perform when an entity is removed
 	*
@@ -176,6 +213,20 @@ namespace Ndk
 			m_coordinateSystemInvalidated = false;
 		}
 
+		if (m_interpolationEnabled)
+		{
+			World& world = GetWorld();
+
+			Nz::UInt64 tickCount = world.GetTickCount();
+			float interpolationFactor = Nz::Clamp(world.GetInterpolationFactor(), 0.f, 1.f);
+
+			for (const Ndk::EntityHandle& drawable : m_drawables)
+			{
+				GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+				graphicsComponent.Interpolate(tickCount, interpolationFactor);
+			}
+		}
+
 		UpdatePointSpotShadowMaps();
 
 		for (const Ndk::EntityHandle& camera : m_cameras)
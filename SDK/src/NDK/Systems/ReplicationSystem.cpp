@@ -0,0 +1,741 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/Systems/ReplicationSystem.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/SerializationContext.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/ReplicationComponent.hpp>
+#include <NDK/World.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Ndk
+{
+	namespace
+	{
+		enum RecordType : Nz::UInt8
+		{
+			RecordType_Destroy,
+			RecordType_Update
+		};
+
+		constexpr float MaxBurstDuration = 0.1f; //< Unused bandwidth is only kept for this duration
+
+		Nz::Int64 GetCellCoord(float value, float cellSize)
+		{
+			return static_cast<Nz::Int64>(std::floor(value / cellSize));
+		}
+
+		Nz::UInt64 GetCellKey(Nz::Int64 x, Nz::Int64 y, Nz::Int64 z)
+		{
+			// 21 bits per axis, wrapping around in very large worlds (which only makes some far cells shared)
+			constexpr Nz::UInt64 mask = 0x1FFFFF;
+
+			return ((static_cast<Nz::UInt64>(x) & mask) << 42) | ((static_cast<Nz::UInt64>(y) & mask) << 21) | (static_cast<Nz::UInt64>(z) & mask);
+		}
+
+		Nz::UInt64 HashData(const Nz::UInt8* data, std::size_t size)
+		{
+			// FNV-1a
+			Nz::UInt64 hash = 14695981039346656037ULL;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				hash ^= data[i];
+				hash *= 1099511628211ULL;
+			}
+
+			return hash;
+		}
+
+		template<typename T>
+		void PatchValue(Nz::SerializationContext& context, Nz::UInt64 offset, T value)
+		{
+			Nz::UInt64 cursorPos = context.stream->GetCursorPos();
+
+			context.stream->SetCursorPos(offset);
+			Nz::Serialize(context, value);
+			context.stream->SetCursorPos(cursorPos);
+		}
+	}
+
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ReplicationSystem
+	* \brief NDK class that represents the replication system, sending the state of entities to remote peers
+	*
+	* On the server side, peers are registered with AddPeer. At each update, the system serializes the components of its entities (see BaseComponent::Serialize) once,
+	* and sends to every peer the entities relevant to it:
+	* - an entity is relevant when it is close enough to the viewer of the peer (see SetPeerViewer), the lookup being done through a spatial grid,
+	*   or when it has no NodeComponent or is marked as always relevant (see ReplicationComponent::EnableAlwaysRelevant).
+	* - relevant entities accumulate their priority over time, and the most prioritary ones are sent first until the bandwidth budget of the peer is exhausted.
+	* - only the components which changed since the last time they were sent to the peer are sent, and the peer is told when an entity is no longer relevant.
+	*
+	* On the client side, packets received on the replication channel are given to HandlePacket, which creates, updates and kills the local copies of the entities.
+	*
+	* \remark This system is enabled if the entity has the trait: ReplicationComponent
+	* \remark Packets are sent as reliable on the replication channel, the host should have enough channels for it (see SetChannel)
+	* \remark Peers must be removed (see RemovePeer) when they disconnect
+	*/
+
+	/*!
+	* \brief Constructs an ReplicationSystem object by default
+	*/
+
+	ReplicationSystem::ReplicationSystem() :
+	m_tick(0),
+	m_channelId(0),
+	m_cellSize(50.f)
+	{
+		Requires<ReplicationComponent>();
+		SetUpdateOrder(100); //< After every movement
+	}
+
+	/*!
+	* \brief Constructs a ReplicationSystem object by copy semantic
+	*
+	* \param system ReplicationSystem to copy
+	*
+	* \remark Only the settings are copied, peers and remote entities belong to the world of the copied system
+	*/
+
+	ReplicationSystem::ReplicationSystem(const ReplicationSystem& system) :
+	System(system),
+	m_tick(0),
+	m_channelId(system.m_channelId),
+	m_cellSize(system.m_cellSize)
+	{
+	}
+
+	/*!
+	* \brief Gets the name of the system
+	* \return "ReplicationSystem"
+	*/
+
+	const char* ReplicationSystem::GetName() const
+	{
+		return "ReplicationSystem";
+	}
+
+	/*!
+	* \brief Adds a peer to replicate the world to
+	*
+	* \param peer Peer to add, usually a newly connected one
+	* \param bandwidth Maximum number of bytes per second the system will send to this peer
+	*
+	* \remark Until SetPeerViewer is called, every entity is relevant to the peer
+	* \remark Produces a NazaraAssert if peer is invalid or was already added
+	*/
+
+	void ReplicationSystem::AddPeer(Nz::ENetPeer* peer, Nz::UInt32 bandwidth)
+	{
+		NazaraAssert(peer, "Invalid peer");
+		NazaraAssert(!HasPeer(peer), "Peer was already added");
+
+		PeerState& state = m_peers[peer];
+		state.bandwidth = bandwidth;
+		state.budget = 0.f;
+		state.hasViewer = false;
+		state.peer = peer;
+		state.viewerPosition = Nz::Vector3f::Zero();
+		state.viewerRadius = 0.f;
+	}
+
+	/*!
+	* \brief Gets the local copy of a replicated entity
+	* \return Handle to the local entity, or an invalid handle if the entity is unknown
+	*
+	* \param remoteId Identifier of the entity on the server
+	*/
+
+	const EntityHandle& ReplicationSystem::GetRemoteEntity(EntityId remoteId) const
+	{
+		auto it = m_remoteEntities.find(remoteId);
+		if (it == m_remoteEntities.end())
+			return EntityHandle::InvalidHandle;
+
+		return it->second.entity;
+	}
+
+	/*!
+	* \brief Applies a replication packet received from the server
+	* \return true if the packet was successfully applied
+	*
+	* \param packet Packet received on the replication channel
+	*
+	* \remark Produces a NazaraError if the packet is malformed or a component failed to unserialize
+	*/
+
+	bool ReplicationSystem::HandlePacket(const Nz::NetPacket& packet)
+	{
+		Nz::MemoryView stream(packet.GetConstData() + Nz::NetPacket::HeaderSize, packet.GetDataSize());
+
+		Nz::SerializationContext context;
+		context.endianness = Nz::Endianness_LittleEndian;
+		context.stream = &stream;
+
+		World& world = GetWorld();
+
+		while (!stream.EndOfStream())
+		{
+			Nz::UInt8 type;
+			Nz::UInt32 id;
+			Nz::UInt32 generation;
+			if (!Nz::Unserialize(context, &type) || !Nz::Unserialize(context, &id) || !Nz::Unserialize(context, &generation))
+			{
+				NazaraError("Malformed replication packet");
+				return false;
+			}
+
+			auto it = m_remoteEntities.find(id);
+
+			switch (type)
+			{
+				case RecordType_Destroy:
+				{
+					if (it != m_remoteEntities.end() && it->second.generation == generation)
+					{
+						if (it->second.entity)
+							it->second.entity->Kill();
+
+						m_remoteEntities.erase(it);
+					}
+					break;
+				}
+
+				case RecordType_Update:
+				{
+					// The identifier was reused by the server
+					if (it != m_remoteEntities.end() && it->second.generation != generation)
+					{
+						if (it->second.entity)
+							it->second.entity->Kill();
+
+						m_remoteEntities.erase(it);
+						it = m_remoteEntities.end();
+					}
+
+					if (it == m_remoteEntities.end())
+					{
+						RemoteEntity remoteEntity;
+						remoteEntity.entity = world.CreateEntity();
+						remoteEntity.generation = generation;
+
+						it = m_remoteEntities.emplace(id, std::move(remoteEntity)).first;
+					}
+
+					Entity* entity = it->second.entity.GetObject(); //< May be null if the local copy was killed
+
+					Nz::UInt16 componentCount;
+					if (!Nz::Unserialize(context, &componentCount))
+					{
+						NazaraError("Malformed replication packet");
+						return false;
+					}
+
+					for (Nz::UInt16 i = 0; i < componentCount; ++i)
+					{
+						ComponentId componentId;
+						Nz::UInt32 size;
+						if (!Nz::Unserialize(context, &componentId) || !Nz::Unserialize(context, &size) || size > stream.GetSize() - stream.GetCursorPos())
+						{
+							NazaraError("Malformed replication packet");
+							return false;
+						}
+
+						Nz::UInt64 dataEnd = stream.GetCursorPos() + size;
+
+						auto indexIt = BaseComponent::s_idToIndex.find(componentId);
+						if (entity && indexIt != BaseComponent::s_idToIndex.end())
+						{
+							ComponentIndex index = indexIt->second;
+
+							context.ResetBitPosition();
+
+							if (entity->HasComponent(index))
+							{
+								if (!entity->GetComponent(index).Unserialize(context))
+								{
+									NazaraError("Failed to unserialize component of entity #" + Nz::String::Number(id));
+									return false;
+								}
+							}
+							else
+							{
+								std::unique_ptr<BaseComponent> component(BaseComponent::s_entries[index].factory());
+								if (component)
+								{
+									if (!component->Unserialize(context))
+									{
+										NazaraError("Failed to unserialize component of entity #" + Nz::String::Number(id));
+										return false;
+									}
+
+									entity->AddComponent(std::move(component));
+								}
+							}
+						}
+
+						stream.SetCursorPos(dataEnd);
+					}
+
+					Nz::UInt16 removedCount;
+					if (!Nz::Unserialize(context, &removedCount))
+					{
+						NazaraError("Malformed replication packet");
+						return false;
+					}
+
+					for (Nz::UInt16 i = 0; i < removedCount; ++i)
+					{
+						ComponentId componentId;
+						if (!Nz::Unserialize(context, &componentId))
+						{
+							NazaraError("Malformed replication packet");
+							return false;
+						}
+
+						auto indexIt = BaseComponent::s_idToIndex.find(componentId);
+						if (entity && indexIt != BaseComponent::s_idToIndex.end() && entity->HasComponent(indexIt->second))
+							entity->RemoveComponent(indexIt->second);
+					}
+					break;
+				}
+
+				default:
+					NazaraError("Unknown replication record type: " + Nz::String::Number(type));
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Stops replicating the world to a peer
+	*
+	* \param peer Peer to remove
+	*/
+
+	void ReplicationSystem::RemovePeer(Nz::ENetPeer* peer)
+	{
+		m_peers.erase(peer);
+	}
+
+	/*!
+	* \brief Sets the size of the cells of the spatial grid used for relevance filtering
+	*
+	* \param cellSize Size of a cell, ideally of the order of the viewer radius
+	*
+	* \remark Produces a NazaraAssert if cellSize is not strictly positive
+	*/
+
+	void ReplicationSystem::SetCellSize(float cellSize)
+	{
+		NazaraAssert(cellSize > 0.f, "Cell size must be strictly positive");
+
+		m_cellSize = cellSize;
+		m_grid.clear();
+	}
+
+	/*!
+	* \brief Sets the bandwidth available for a peer
+	*
+	* \param peer Peer to configure
+	* \param bandwidth Maximum number of bytes per second the system will send to this peer
+	*
+	* \remark Produces a NazaraError if the peer was not added
+	*/
+
+	void ReplicationSystem::SetPeerBandwidth(Nz::ENetPeer* peer, Nz::UInt32 bandwidth)
+	{
+		auto it = m_peers.find(peer);
+		if (it == m_peers.end())
+		{
+			NazaraError("Peer was not added");
+			return;
+		}
+
+		it->second.bandwidth = bandwidth;
+	}
+
+	/*!
+	* \brief Sets the viewer of a peer, only the entities around it are relevant to the peer
+	*
+	* \param peer Peer to configure
+	* \param position Position of the viewer (usually the position of the player)
+	* \param radius Radius around the viewer in which entities are relevant
+	*
+	* \remark Produces a NazaraError if the peer was not added
+	*/
+
+	void ReplicationSystem::SetPeerViewer(Nz::ENetPeer* peer, const Nz::Vector3f& position, float radius)
+	{
+		auto it = m_peers.find(peer);
+		if (it == m_peers.end())
+		{
+			NazaraError("Peer was not added");
+			return;
+		}
+
+		PeerState& state = it->second;
+		state.hasViewer = true;
+		state.viewerPosition = position;
+		state.viewerRadius = radius;
+	}
+
+	/*!
+	* \brief Serializes the entities of the system and fills the spatial grid
+	*
+	* Entities are serialized once per update, whatever the number of peers they are sent to
+	*/
+
+	void ReplicationSystem::BuildCache()
+	{
+		m_cachedComponents.clear();
+		m_cachedEntities.clear();
+		m_componentData.Clear(true);
+		m_globalEntities.clear();
+
+		// Keep the cells (and their memory) which were used last update
+		for (auto it = m_grid.begin(); it != m_grid.end();)
+		{
+			if (it->second.empty())
+				it = m_grid.erase(it);
+			else
+			{
+				it->second.clear();
+				++it;
+			}
+		}
+
+		Nz::MemoryStream stream(&m_componentData, Nz::OpenMode_WriteOnly);
+
+		Nz::SerializationContext context;
+		context.endianness = Nz::Endianness_LittleEndian;
+		context.stream = &stream;
+
+		World& world = GetWorld();
+
+		for (const EntityHandle& entity : GetEntities())
+		{
+			const ReplicationComponent& replication = entity->GetComponent<ReplicationComponent>();
+
+			CachedEntity cachedEntity;
+			cachedEntity.alwaysRelevant = replication.IsAlwaysRelevant() || !entity->HasComponent<NodeComponent>();
+			cachedEntity.firstComponent = m_cachedComponents.size();
+			cachedEntity.generation = world.GetEntityGeneration(entity->GetId());
+			cachedEntity.id = entity->GetId();
+			cachedEntity.priority = replication.GetPriority();
+			cachedEntity.position = (entity->HasComponent<NodeComponent>()) ? entity->GetComponent<NodeComponent>().GetPosition() : Nz::Vector3f::Zero();
+
+			const Nz::Bitset<>& componentBits = entity->GetComponentBits();
+			for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+			{
+				Nz::UInt64 offset = stream.GetCursorPos();
+				if (!entity->GetComponent(static_cast<ComponentIndex>(i)).Serialize(context))
+				{
+					// This component is not serializable, discard what we wrote for it
+					context.ResetBitPosition();
+					stream.SetCursorPos(offset);
+					continue;
+				}
+
+				context.FlushBits();
+
+				CachedComponent component;
+				component.id = BaseComponent::s_entries[i].id;
+				component.index = static_cast<ComponentIndex>(i);
+				component.offset = static_cast<std::size_t>(offset);
+				component.size = static_cast<std::size_t>(stream.GetCursorPos() - offset);
+				component.hash = HashData(m_componentData.GetConstBuffer() + component.offset, component.size);
+
+				m_cachedComponents.push_back(component);
+			}
+
+			cachedEntity.componentCount = m_cachedComponents.size() - cachedEntity.firstComponent;
+
+			std::size_t cacheIndex = m_cachedEntities.size();
+			m_cachedEntities.push_back(cachedEntity);
+
+			if (cachedEntity.alwaysRelevant)
+				m_globalEntities.push_back(cacheIndex);
+			else
+			{
+				const Nz::Vector3f& position = cachedEntity.position;
+				m_grid[GetCellKey(GetCellCoord(position.x, m_cellSize), GetCellCoord(position.y, m_cellSize), GetCellCoord(position.z, m_cellSize))].push_back(cacheIndex);
+			}
+		}
+	}
+
+	/*!
+	* \brief Operation to perform when system is updated
+	*
+	* \param elapsedTime Delta time used for the update
+	*/
+
+	void ReplicationSystem::OnUpdate(float elapsedTime)
+	{
+		// Client-side systems only handle packets
+		if (m_peers.empty())
+			return;
+
+		m_tick++;
+
+		BuildCache();
+
+		for (auto& pair : m_peers)
+		{
+			PeerState& peer = pair.second;
+			if (peer.peer->IsConnected())
+				ReplicateTo(peer, elapsedTime);
+		}
+	}
+
+	/*!
+	* \brief Calls a callback for every entity of the spatial grid which may be in a sphere
+	*
+	* \param position Center of the sphere
+	* \param radius Radius of the sphere
+	* \param callback Callback taking the index of the cached entity
+	*
+	* \remark The callback is called for every entity of the cells intersecting the sphere, it has to check their distance
+	*/
+
+	template<typename F>
+	void ReplicationSystem::QueryGrid(const Nz::Vector3f& position, float radius, F&& callback) const
+	{
+		Nz::Int64 minX = GetCellCoord(position.x - radius, m_cellSize);
+		Nz::Int64 minY = GetCellCoord(position.y - radius, m_cellSize);
+		Nz::Int64 minZ = GetCellCoord(position.z - radius, m_cellSize);
+		Nz::Int64 maxX = GetCellCoord(position.x + radius, m_cellSize);
+		Nz::Int64 maxY = GetCellCoord(position.y + radius, m_cellSize);
+		Nz::Int64 maxZ = GetCellCoord(position.z + radius, m_cellSize);
+
+		// Visiting the cells which are in use is faster for large radius
+		double cellCount = (std::floor((position.x + radius) / m_cellSize) - std::floor((position.x - radius) / m_cellSize) + 1.0) *
+		                   (std::floor((position.y + radius) / m_cellSize) - std::floor((position.y - radius) / m_cellSize) + 1.0) *
+		                   (std::floor((position.z + radius) / m_cellSize) - std::floor((position.z - radius) / m_cellSize) + 1.0);
+
+		if (cellCount >= m_grid.size())
+		{
+			for (const auto& pair : m_grid)
+			{
+				for (std::size_t cacheIndex : pair.second)
+					callback(cacheIndex);
+			}
+
+			return;
+		}
+
+		for (Nz::Int64 x = minX; x <= maxX; ++x)
+		{
+			for (Nz::Int64 y = minY; y <= maxY; ++y)
+			{
+				for (Nz::Int64 z = minZ; z <= maxZ; ++z)
+				{
+					auto it = m_grid.find(GetCellKey(x, y, z));
+					if (it == m_grid.end())
+						continue;
+
+					for (std::size_t cacheIndex : it->second)
+						callback(cacheIndex);
+				}
+			}
+		}
+	}
+
+	/*!
+	* \brief Sends the relevant entities to a peer, according to their priority and the budget of the peer
+	*
+	* \param peer Peer to replicate the world to
+	* \param elapsedTime Delta time since the last update
+	*/
+
+	void ReplicationSystem::ReplicateTo(PeerState& peer, float elapsedTime)
+	{
+		float bandwidth = static_cast<float>(peer.bandwidth);
+		peer.budget = std::min(peer.budget + bandwidth * elapsedTime, bandwidth * std::max(elapsedTime, MaxBurstDuration));
+
+		// Relevant entities accumulate priority, whether they are sent or not
+		peer.candidates.clear();
+
+		auto AddCandidate = [&](std::size_t cacheIndex)
+		{
+			const CachedEntity& cachedEntity = m_cachedEntities[cacheIndex];
+
+			PeerEntity& peerEntity = peer.entities[cachedEntity.id];
+			if (peerEntity.generation != cachedEntity.generation)
+			{
+				// The identifier was reused, the peer will have to build a new entity
+				peerEntity.generation = cachedEntity.generation;
+				peerEntity.sentHashes.clear();
+			}
+
+			peerEntity.lastRelevantTick = m_tick;
+			peerEntity.priority += cachedEntity.priority * elapsedTime;
+
+			peer.candidates.emplace_back(&peerEntity, cacheIndex);
+		};
+
+		for (std::size_t cacheIndex : m_globalEntities)
+			AddCandidate(cacheIndex);
+
+		if (peer.hasViewer)
+		{
+			float squaredRadius = peer.viewerRadius * peer.viewerRadius;
+
+			QueryGrid(peer.viewerPosition, peer.viewerRadius, [&](std::size_t cacheIndex)
+			{
+				if (peer.viewerPosition.SquaredDistance(m_cachedEntities[cacheIndex].position) <= squaredRadius)
+					AddCandidate(cacheIndex);
+			});
+		}
+		else
+		{
+			for (const auto& pair : m_grid)
+			{
+				for (std::size_t cacheIndex : pair.second)
+					AddCandidate(cacheIndex);
+			}
+		}
+
+		Nz::NetPacket packet(0);
+
+		Nz::SerializationContext context;
+		context.endianness = Nz::Endianness_LittleEndian;
+		context.stream = packet.GetStream();
+
+		Nz::Stream* stream = context.stream;
+		std::size_t recordCount = 0;
+
+		// Entities which are not relevant anymore, or which left the world
+		for (auto it = peer.entities.begin(); it != peer.entities.end();)
+		{
+			const PeerEntity& peerEntity = it->second;
+			if (peerEntity.lastRelevantTick == m_tick)
+			{
+				++it;
+				continue;
+			}
+
+			if (peerEntity.known)
+			{
+				Nz::UInt64 recordStart = stream->GetCursorPos();
+
+				Nz::Serialize(context, static_cast<Nz::UInt8>(RecordType_Destroy));
+				Nz::Serialize(context, static_cast<Nz::UInt32>(it->first));
+				Nz::Serialize(context, peerEntity.generation);
+
+				peer.budget -= static_cast<float>(stream->GetCursorPos() - recordStart);
+				recordCount++;
+			}
+
+			it = peer.entities.erase(it);
+		}
+
+		std::sort(peer.candidates.begin(), peer.candidates.end(), [](const std::pair<PeerEntity*, std::size_t>& lhs, const std::pair<PeerEntity*, std::size_t>& rhs)
+		{
+			if (lhs.first->priority != rhs.first->priority)
+				return lhs.first->priority > rhs.first->priority;
+
+			return lhs.second < rhs.second;
+		});
+
+		for (const auto& candidate : peer.candidates)
+		{
+			if (peer.budget <= 0.f)
+				break;
+
+			PeerEntity& peerEntity = *candidate.first;
+			const CachedEntity& cachedEntity = m_cachedEntities[candidate.second];
+
+			Nz::UInt64 recordStart = stream->GetCursorPos();
+
+			Nz::Serialize(context, static_cast<Nz::UInt8>(RecordType_Update));
+			Nz::Serialize(context, static_cast<Nz::UInt32>(cachedEntity.id));
+			Nz::Serialize(context, cachedEntity.generation);
+
+			Nz::UInt64 componentCountPos = stream->GetCursorPos();
+			Nz::UInt16 componentCount = 0;
+			Nz::Serialize(context, componentCount);
+
+			const CachedComponent* firstComponent = &m_cachedComponents[cachedEntity.firstComponent];
+			const CachedComponent* lastComponent = firstComponent + cachedEntity.componentCount;
+
+			for (const CachedComponent* component = firstComponent; component != lastComponent; ++component)
+			{
+				auto hashIt = std::find_if(peerEntity.sentHashes.begin(), peerEntity.sentHashes.end(), [&](const std::pair<ComponentIndex, Nz::UInt64>& pair) { return pair.first == component->index; });
+				if (hashIt != peerEntity.sentHashes.end())
+				{
+					if (hashIt->second == component->hash)
+						continue; //< The peer already has this state
+
+					hashIt->second = component->hash;
+				}
+				else
+					peerEntity.sentHashes.emplace_back(component->index, component->hash);
+
+				Nz::Serialize(context, component->id);
+				Nz::Serialize(context, static_cast<Nz::UInt32>(component->size));
+				stream->Write(m_componentData.GetConstBuffer() + component->offset, component->size);
+
+				componentCount++;
+			}
+
+			Nz::UInt64 removedCountPos = stream->GetCursorPos();
+			Nz::UInt16 removedCount = 0;
+			Nz::Serialize(context, removedCount);
+
+			for (auto it = peerEntity.sentHashes.begin(); it != peerEntity.sentHashes.end();)
+			{
+				ComponentIndex index = it->first;
+				if (std::any_of(firstComponent, lastComponent, [=](const CachedComponent& component) { return component.index == index; }))
+				{
+					++it;
+					continue;
+				}
+
+				Nz::Serialize(context, BaseComponent::s_entries[index].id);
+				removedCount++;
+
+				it = peerEntity.sentHashes.erase(it);
+			}
+
+			if (componentCount == 0 && removedCount == 0 && peerEntity.known)
+			{
+				// Nothing changed since the last time this entity was sent
+				stream->SetCursorPos(recordStart);
+				peerEntity.priority = 0.f;
+				continue;
+			}
+
+			if (componentCount > 0)
+				PatchValue(context, componentCountPos, componentCount);
+
+			if (removedCount > 0)
+				PatchValue(context, removedCountPos, removedCount);
+
+			peer.budget -= static_cast<float>(stream->GetCursorPos() - recordStart);
+			peerEntity.known = true;
+			peerEntity.priority = 0.f;
+			recordCount++;
+		}
+
+		if (recordCount > 0)
+		{
+			// Skipped records may have left data past the end
+			packet.Resize(static_cast<std::size_t>(stream->GetCursorPos()));
+
+			peer.peer->Send(m_channelId, Nz::ENetPacketFlag_Reliable, std::move(packet));
+		}
+	}
+
+	SystemIndex ReplicationSystem::systemIndex;
+}
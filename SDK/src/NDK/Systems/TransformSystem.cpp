@@ -0,0 +1,150 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/Systems/TransformSystem.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::TransformSystem
+	* \brief NDK class that represents the transform system
+	*
+	* Once per update, this system computes the transform matrices of the nodes, parents first, then signals every node invalidation which happened since the last update.
+	* Moving a node many times (or moving many nodes of a same hierarchy) during a frame only signals its invalidation once.
+	*
+	* \remark This system is enabled if the entity has the trait: NodeComponent
+	* \remark This system is not part of the default systems, components listening to OnNodeInvalidation (as GraphicsComponent) are only notified of a movement after its update
+	*/
+
+	/*!
+	* \brief Constructs an TransformSystem object by default
+	*/
+
+	TransformSystem::TransformSystem() :
+	m_hierarchyUpdated(false)
+	{
+		Requires<NodeComponent>();
+		SetUpdateOrder(90); //< After every movement, before rendering
+		SetUpdateRate(0.f);
+	}
+
+	/*!
+	* \brief Constructs a TransformSystem object by copy semantic
+	*
+	* \param system TransformSystem to copy
+	*/
+
+	TransformSystem::TransformSystem(const TransformSystem& system) :
+	System(system),
+	m_hierarchyUpdated(false)
+	{
+	}
+
+	/*!
+	* \brief Destructs the object, signaling every deferred invalidation
+	*/
+
+	TransformSystem::~TransformSystem()
+	{
+		for (const Ndk::EntityHandle& entity : GetEntities())
+			entity->GetComponent<NodeComponent>().SetTransformSystem(nullptr);
+	}
+
+	/*!
+	* \brief Gets the name of the system
+	* \return "TransformSystem"
+	*/
+
+	const char* TransformSystem::GetName() const
+	{
+		return "TransformSystem";
+	}
+
+	/*!
+	* \brief Operation to perform when an entity is removed from the system
+	*
+	* \param entity Pointer to the entity
+	*/
+
+	void TransformSystem::OnEntityRemoved(Entity* entity)
+	{
+		// The node component may have been destroyed already
+		if (entity->HasComponent<NodeComponent>())
+			entity->GetComponent<NodeComponent>().SetTransformSystem(nullptr);
+
+		InvalidateHierarchy();
+	}
+
+	/*!
+	* \brief Operation to perform when entity is validated for the system
+	*
+	* \param entity Pointer to the entity
+	* \param justAdded Is the entity newly added
+	*/
+
+	void TransformSystem::OnEntityValidation(Entity* entity, bool justAdded)
+	{
+		if (justAdded)
+		{
+			entity->GetComponent<NodeComponent>().SetTransformSystem(this);
+
+			InvalidateHierarchy();
+		}
+	}
+
+	/*!
+	* \brief Operation to perform when system is updated
+	*
+	* \param elapsedTime Delta time used for the update
+	*/
+
+	void TransformSystem::OnUpdate(float elapsedTime)
+	{
+		NazaraUnused(elapsedTime);
+
+		if (!m_hierarchyUpdated)
+			SortNodes();
+
+		// Parents come first, so every node is computed from an up-to-date parent
+		for (NodeComponent* node : m_sortedNodes)
+			node->EnsureTransformMatrixUpdate();
+
+		for (NodeComponent* node : m_sortedNodes)
+			node->DispatchInvalidation();
+	}
+
+	void TransformSystem::SortNodes()
+	{
+		std::vector<std::pair<std::size_t, NodeComponent*>> nodeDepths;
+		nodeDepths.reserve(GetEntities().size());
+
+		for (const Ndk::EntityHandle& entity : GetEntities())
+		{
+			NodeComponent& node = entity->GetComponent<NodeComponent>();
+
+			std::size_t depth = 0;
+			for (const Nz::Node* parent = node.GetParent(); parent; parent = parent->GetParent())
+				depth++;
+
+			nodeDepths.emplace_back(depth, &node);
+		}
+
+		std::stable_sort(nodeDepths.begin(), nodeDepths.end(), [](const std::pair<std::size_t, NodeComponent*>& lhs, const std::pair<std::size_t, NodeComponent*>& rhs)
+		{
+			return lhs.first < rhs.first;
+		});
+
+		m_sortedNodes.clear();
+		for (const auto& pair : nodeDepths)
+			m_sortedNodes.push_back(pair.second);
+
+		m_hierarchyUpdated = true;
+	}
+
+	SystemIndex TransformSystem::systemIndex;
+}
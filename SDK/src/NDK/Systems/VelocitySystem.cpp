@@ -27,9 +27,21 @@ namespace Ndk
 	{
 		Excludes<PhysicsComponent2D, PhysicsComponent3D>();
 		Requires<NodeComponent, VelocityComponent>();
+		Reads<VelocityComponent>();
+		Writes<NodeComponent>();
 		SetUpdateOrder(10); //< Since some systems may want to stop us
 	}
 
+	/*!
+	* \brief Gets the name of the system
+	* \return "VelocitySystem"
+	*/
+
+	const char* VelocitySystem::GetName() const
+	{
+		return "VelocitySystem";
+	}
+
 	/*!
 	* \brief Operation to perform when system is updated
 	*
@@ -38,12 +50,35 @@ namespace Ndk
 
 	void VelocitySystem::OnUpdate(float elapsedTime)
 	{
-		for (const Ndk::EntityHandle& entity : GetEntities())
+		// Moving a node reads its parent and invalidates its children, and signals its invalidation to listeners (as GraphicsComponent) which aren't thread-safe
+		// Only independent nodes whose invalidation has no listener or is deferred by the TransformSystem can be moved concurrently
+		auto CanMoveConcurrently = [](const Ndk::EntityHandle& entity)
+		{
+			const NodeComponent& node = entity->GetComponent<NodeComponent>();
+			if (node.GetParent() || node.HasChilds())
+				return false;
+
+			return node.IsInvalidationDeferred() || node.OnNodeInvalidation.IsEmpty();
+		};
+
+		auto UpdateEntity = [elapsedTime](const Ndk::EntityHandle& entity)
 		{
 			NodeComponent& node = entity->GetComponent<NodeComponent>();
 			const VelocityComponent& velocity = entity->GetComponent<VelocityComponent>();
 
 			node.Move(velocity.linearVelocity * elapsedTime, Nz::CoordSys_Global);
+		};
+
+		ParallelForEachEntity([&CanMoveConcurrently, &UpdateEntity](const Ndk::EntityHandle& entity)
+		{
+			if (CanMoveConcurrently(entity))
+				UpdateEntity(entity);
+		});
+
+		for (const Ndk::EntityHandle& entity : GetEntities())
+		{
+			if (!CanMoveConcurrently(entity))
+				UpdateEntity(entity);
 		}
 	}
 
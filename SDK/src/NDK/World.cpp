@@ -4,6 +4,8 @@
 
 #include <NDK/World.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <NDK/BaseComponent.hpp>
 #include <NDK/Systems/PhysicsSystem2D.hpp>
 #include <NDK/Systems/PhysicsSystem3D.hpp>
@@ -99,6 +101,12 @@ namespace Ndk
 			m_entityBlocks[id] = entBlock;
 		}
 
+		// A new generation of the identifier begins, invalidating references to the previous entities using it (see EntityRef)
+		if (id < m_entityGenerations.size())
+			m_entityGenerations[id]++;
+		else
+			m_entityGenerations.push_back(0);
+
 		// We initialize the entity and we add it to the list of alive entities
 		entBlock->entity.Create();
 
@@ -107,6 +115,68 @@ namespace Ndk
 		return entBlock->handle;
 	}
 
+	/*!
+	* \brief Creates an entity in the world from a prefab
+	* \return The entity created
+	*
+	* \param prefab Prefab holding the components to copy into the entity
+	*/
+
+	const EntityHandle& World::CreateEntity(const EntityPrefab& prefab)
+	{
+		const EntityHandle& entity = CreateEntity();
+
+		const Nz::Bitset<>& componentBits = prefab.GetComponentBits();
+		for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+		{
+			ComponentIndex index = static_cast<ComponentIndex>(i);
+			const BaseComponent& component = prefab.GetComponent(index);
+
+			if (BaseComponentStorage* storage = GetComponentStorage(index))
+				entity->AttachComponent(storage->Clone(entity->GetId(), component));
+			else
+				entity->AddComponent(component.Clone());
+		}
+
+		return entity;
+	}
+
+	/*!
+	* \brief Creates multiple entities in the world from a prefab
+	* \return The set of entities created
+	*
+	* \param prefab Prefab holding the components to copy into each entity
+	* \param count Number of entities to create
+	*
+	* Components are created type by type (which keeps components of a same type next to each other when they are stored by the world)
+	* and systems only filter the set of components once for all the entities, during the next update.
+	*/
+
+	World::EntityVector World::CreateEntities(const EntityPrefab& prefab, unsigned int count)
+	{
+		EntityVector entities = CreateEntities(count);
+
+		const Nz::Bitset<>& componentBits = prefab.GetComponentBits();
+		for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+		{
+			ComponentIndex index = static_cast<ComponentIndex>(i);
+			const BaseComponent& component = prefab.GetComponent(index);
+
+			if (BaseComponentStorage* storage = GetComponentStorage(index))
+			{
+				for (const EntityHandle& entity : entities)
+					entity->AttachComponent(storage->Clone(entity->GetId(), component));
+			}
+			else
+			{
+				for (const EntityHandle& entity : entities)
+					entity->AddComponent(component.Clone());
+			}
+		}
+
+		return entities;
+	}
+
 	/*!
 	* \brief Clears the world from every entities
 	*
@@ -149,8 +219,12 @@ namespace Ndk
 		const Nz::Bitset<>& componentBits = original->GetComponentBits();
 		for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
 		{
-			std::unique_ptr<BaseComponent> component(original->GetComponent(ComponentIndex(i)).Clone());
-			clone->AddComponent(std::move(component));
+			const BaseComponent& component = original->GetComponent(ComponentIndex(i));
+
+			if (BaseComponentStorage* storage = GetComponentStorage(ComponentIndex(i)))
+				clone->AttachComponent(storage->Clone(clone->GetId(), component));
+			else
+				clone->AddComponent(component.Clone());
 		}
 
 		return clone;
@@ -164,6 +238,8 @@ namespace Ndk
 
 	void World::Update()
 	{
+		NazaraProfileZone("World::Update (entities)");
+
 		if (!m_orderedSystemsUpdated)
 			ReorderSystems();
 
@@ -184,7 +260,7 @@ namespace Ndk
 		}
 
 		// Handle killed entities before last call
-		for (std::size_t i = m_killedEntities.FindFirst(); i != m_killedEntities.npos; i = m_killedEntities.FindNext(i))
+		m_killedEntities.ForEachSetBit([&](std::size_t i)
 		{
 			NazaraAssert(i < m_entityBlocks.size(), "Entity index out of range");
 
@@ -195,11 +271,17 @@ namespace Ndk
 
 			// Send back the identifier of the entity to the free queue
 			m_freeIdList.push_back(entity->GetId());
-		}
+		});
 		m_killedEntities.Reset();
 
+		// Entities sharing a set of components (as the ones created from a same prefab) belong to the same systems,
+		// filter a set once for consecutive entities instead of once per entity
+		Nz::Bitset<> filteredComponents;
+		Nz::Bitset<> filteredSystems;
+		bool filterUpdated = false;
+
 		// Handle of entities which need an update from the systems
-		for (std::size_t i = m_dirtyEntities.FindFirst(); i != m_dirtyEntities.npos; i = m_dirtyEntities.FindNext(i))
+		m_dirtyEntities.ForEachSetBit([&](std::size_t i)
 		{
 			NazaraAssert(i < m_entityBlocks.size(), "Entity index out of range");
 
@@ -207,20 +289,35 @@ namespace Ndk
 
 			// Check entity validity (as it could have been reported as dirty and killed during the same iteration)
 			if (!entity->IsValid())
-				continue;
+				return;
 
 			Nz::Bitset<>& removedComponents = entity->GetRemovedComponentBits();
-			for (std::size_t j = removedComponents.FindFirst(); j != m_dirtyEntities.npos; j = removedComponents.FindNext(j))
+			removedComponents.ForEachSetBit([entity](std::size_t j)
+			{
 				entity->DestroyComponent(static_cast<Ndk::ComponentIndex>(j));
+			});
 			removedComponents.Reset();
 
-			for (auto& system : m_orderedSystems)
+			if (!filterUpdated || entity->GetComponentBits() != filteredComponents)
 			{
+				filteredComponents = entity->GetComponentBits();
+				filteredSystems.Resize(m_orderedSystems.size());
+
+				for (std::size_t j = 0; j < m_orderedSystems.size(); ++j)
+					filteredSystems.Set(j, m_orderedSystems[j]->Filters(entity));
+
+				filterUpdated = true;
+			}
+
+			for (std::size_t j = 0; j < m_orderedSystems.size(); ++j)
+			{
+				BaseSystem* system = m_orderedSystems[j];
+
 				// Is our entity already part of this system?
 				bool partOfSystem = system->HasEntity(entity);
 
 				// Should it be part of it?
-				if (entity->IsEnabled() && system->Filters(entity))
+				if (entity->IsEnabled() && filteredSystems.Test(j))
 				{
 					// Yes it should, add it to the system if not already done and validate it (again)
 					if (!partOfSystem)
@@ -235,7 +332,7 @@ namespace Ndk
 						system->RemoveEntity(entity);
 				}
 			}
-		}
+		});
 		m_dirtyEntities.Reset();
 	}
 
@@ -256,4 +353,103 @@ namespace Ndk
 
 		m_orderedSystemsUpdated = true;
 	}
+
+	/*!
+	* \brief Brings back an entity with a specific identifier and generation
+	* \return Handle to the entity, or an invalid handle if the identifier was never given to an entity
+	*
+	* \param id Identifier of the entity
+	* \param generation Generation of the identifier
+	*
+	* If the entity is still alive, its pending kill (if any) is cancelled.
+	* If the identifier is used by another generation, its entity is destroyed right away.
+	* Otherwise, a new entity is created with this identifier and generation.
+	*
+	* \remark Used by WorldSnapshot to restore entities killed since the capture
+	*/
+
+	const EntityHandle& World::RestoreEntity(EntityId id, Nz::UInt32 generation)
+	{
+		if (id >= m_entityBlocks.size())
+			return EntityHandle::InvalidHandle;
+
+		if (IsEntityIdValid(id))
+		{
+			m_killedEntities.UnboundedReset(id);
+
+			if (m_entityGenerations[id] == generation)
+				return m_entityBlocks[id]->handle;
+
+			// The identifier was given to another entity, which can't wait for the next update to leave
+			m_entityBlocks[id]->entity.Destroy();
+			m_freeIdList.push_back(id);
+		}
+
+		auto it = std::find(m_freeIdList.begin(), m_freeIdList.end(), id);
+		NazaraAssert(it != m_freeIdList.end(), "Identifier of a dead entity should be free");
+		m_freeIdList.erase(it);
+
+		// The block may still be waiting for the next update if its previous entity was destroyed above
+		EntityBlock* entBlock = m_entityBlocks[id];
+		entBlock->handle.Reset(&entBlock->entity);
+
+		m_entityGenerations[id] = generation;
+
+		entBlock->entity.Create();
+
+		m_aliveEntities.Insert(&entBlock->entity);
+
+		return entBlock->handle;
+	}
+
+	void World::UpdateSystemsParallel(float elapsedTime, Nz::UInt32 updateFlags)
+	{
+		Nz::TaskPool* pool = Nz::TaskScheduler::GetPool();
+
+		std::vector<BaseSystem*> runningSystems;
+		std::vector<Nz::TaskHandle> runningTasks;
+		std::vector<Nz::TaskHandle> predecessors;
+
+		auto WaitForRunningSystems = [&]()
+		{
+			if (!runningTasks.empty())
+			{
+				// Only submit and wait for our own tasks, the calling thread may have pending tasks of its own
+				pool->Run(runningTasks.data(), runningTasks.size()).Wait();
+
+				runningSystems.clear();
+				runningTasks.clear();
+			}
+		};
+
+		for (BaseSystem* system : m_orderedSystems)
+		{
+			if (!(updateFlags & ((system->IsFixedUpdateEnabled()) ? UpdateFlags_Fixed : UpdateFlags_Frame)))
+				continue;
+
+			if (!system->HasComponentAccess() || !pool)
+			{
+				// We don't know what this system does, update it alone on this thread
+				WaitForRunningSystems();
+				system->Update(elapsedTime);
+				continue;
+			}
+
+			// Only wait for the previous systems accessing the same components
+			predecessors.clear();
+			for (std::size_t i = 0; i < runningSystems.size(); ++i)
+			{
+				if (system->ConflictsWith(*runningSystems[i]))
+					predecessors.push_back(runningTasks[i]);
+			}
+
+			runningSystems.push_back(system);
+			runningTasks.push_back(pool->AddTaskAfter(predecessors.data(), predecessors.size(), [system, elapsedTime]()
+			{
+				system->Update(elapsedTime);
+			}));
+		}
+
+		WaitForRunningSystems();
+	}
 }
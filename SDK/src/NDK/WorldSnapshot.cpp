@@ -0,0 +1,434 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequesites.hpp
+
+#include <NDK/WorldSnapshot.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/SerializationContext.hpp>
+#include <NDK/BaseComponent.hpp>
+#include <NDK/World.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Ndk
+{
+	namespace
+	{
+		constexpr std::size_t MinZeroRun = 3; //< A literal run is only interrupted by this many zeros, shorter runs are cheaper to copy
+
+		bool IsSerializable(const BaseComponent& component)
+		{
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data, Nz::OpenMode_WriteOnly);
+
+			Nz::SerializationContext context;
+			context.endianness = Nz::Endianness_LittleEndian;
+			context.stream = &stream;
+
+			return component.Serialize(context);
+		}
+
+		template<typename T>
+		void PatchValue(Nz::SerializationContext& context, Nz::UInt64 offset, T value)
+		{
+			Nz::UInt64 cursorPos = context.stream->GetCursorPos();
+
+			context.stream->SetCursorPos(offset);
+			Nz::Serialize(context, value);
+			context.stream->SetCursorPos(cursorPos);
+		}
+
+		bool ReadVarInt(const Nz::UInt8*& ptr, const Nz::UInt8* end, std::size_t* value)
+		{
+			std::size_t result = 0;
+			for (unsigned int shift = 0; shift < sizeof(std::size_t) * 8; shift += 7)
+			{
+				if (ptr == end)
+					return false;
+
+				Nz::UInt8 byte = *ptr++;
+				result |= static_cast<std::size_t>(byte & 0x7F) << shift;
+
+				if ((byte & 0x80) == 0)
+				{
+					*value = result;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void WriteVarInt(Nz::ByteArray* data, std::size_t value)
+		{
+			while (value >= 0x80)
+			{
+				data->PushBack(static_cast<Nz::UInt8>(value | 0x80));
+				value >>= 7;
+			}
+
+			data->PushBack(static_cast<Nz::UInt8>(value));
+		}
+	}
+
+	/*!
+	* \ingroup NDK
+	* \class Ndk::WorldSnapshot
+	* \brief NDK class that represents the state of the entities of a world at a given time
+	*
+	* A snapshot stores, for every entity of a world, its identifier and generation, along with the data of its serializable components (see BaseComponent::Serialize).
+	* Components which are not serializable are skipped.
+	*
+	* Two snapshots of the same world are mostly identical from a tick to another, ComputeDelta encodes their difference as run-length encoded XOR, which ApplyDelta decodes.
+	*
+	* \remark Data is little-endian, and components are identified by their ComponentId, allowing snapshots to be exchanged between processes
+	*/
+
+	/*!
+	* \brief Reconstructs a snapshot from a base snapshot and a delta
+	* \return true if the delta was successfully applied
+	*
+	* \param base Snapshot the delta was computed from
+	* \param delta Delta returned by ComputeDelta
+	*
+	* \remark Produces a NazaraError if the delta is malformed or makes the snapshot grow by more than MaxDeltaGrowth bytes, in which case the snapshot is cleared
+	*
+	* \see ComputeDelta
+	*/
+
+	bool WorldSnapshot::ApplyDelta(const WorldSnapshot& base, const Nz::ByteArray& delta)
+	{
+		NazaraAssert(&base != this, "Base snapshot cannot be the target snapshot");
+
+		const Nz::UInt8* ptr = delta.GetConstBuffer();
+		const Nz::UInt8* end = ptr + delta.GetSize();
+
+		std::size_t size;
+		if (!ReadVarInt(ptr, end, &size))
+		{
+			NazaraError("Failed to read snapshot size");
+			m_data.Clear(true);
+			return false;
+		}
+
+		const Nz::UInt8* baseData = base.m_data.GetConstBuffer();
+		std::size_t baseSize = base.m_data.GetSize();
+
+		// Deltas may come from the network, don't let one make us allocate an arbitrary amount of memory
+		if (size > baseSize + MaxDeltaGrowth)
+		{
+			NazaraError("Snapshot size (" + Nz::String::Number(size) + ") exceeds the base snapshot size by more than " + Nz::String::Number(MaxDeltaGrowth) + " bytes");
+			m_data.Clear(true);
+			return false;
+		}
+
+		m_data.Resize(size);
+		Nz::UInt8* data = m_data.GetBuffer();
+
+		auto BaseAt = [&](std::size_t i) -> Nz::UInt8
+		{
+			return (i < baseSize) ? baseData[i] : Nz::UInt8(0);
+		};
+
+		std::size_t pos = 0;
+		while (pos < size)
+		{
+			std::size_t zeroCount;
+			std::size_t literalCount;
+			if (!ReadVarInt(ptr, end, &zeroCount) || !ReadVarInt(ptr, end, &literalCount) || zeroCount > size - pos || literalCount > size - pos - zeroCount || literalCount > static_cast<std::size_t>(end - ptr))
+			{
+				NazaraError("Malformed snapshot delta");
+				m_data.Clear(true);
+				return false;
+			}
+
+			for (std::size_t i = 0; i < zeroCount; ++i, ++pos)
+				data[pos] = BaseAt(pos);
+
+			for (std::size_t i = 0; i < literalCount; ++i, ++pos)
+				data[pos] = *ptr++ ^ BaseAt(pos);
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Captures the state of a world
+	*
+	* \param world World to capture
+	*
+	* \remark The memory of the previous capture is reused, capturing every tick in the same snapshot does not allocate once its size is stable
+	*/
+
+	void WorldSnapshot::Capture(const World& world)
+	{
+		m_data.Clear(true);
+
+		Nz::MemoryStream stream(&m_data, Nz::OpenMode_WriteOnly);
+
+		Nz::SerializationContext context;
+		context.endianness = Nz::Endianness_LittleEndian;
+		context.stream = &stream;
+
+		// Identifiers of every component type, entities only reference their component through their index
+		Nz::Serialize(context, static_cast<Nz::UInt16>(BaseComponent::s_entries.size()));
+		for (const BaseComponent::ComponentEntry& entry : BaseComponent::s_entries)
+			Nz::Serialize(context, entry.id);
+
+		const EntityList& entities = world.GetEntities();
+		Nz::Serialize(context, static_cast<Nz::UInt32>(entities.size()));
+
+		for (const EntityHandle& entity : entities)
+		{
+			EntityId id = entity->GetId();
+
+			Nz::Serialize(context, static_cast<Nz::UInt32>(id));
+			Nz::Serialize(context, world.GetEntityGeneration(id));
+
+			Nz::UInt64 componentCountPos = stream.GetCursorPos();
+			Nz::UInt16 componentCount = 0;
+			Nz::Serialize(context, componentCount);
+
+			const Nz::Bitset<>& componentBits = entity->GetComponentBits();
+			for (std::size_t i = componentBits.FindFirst(); i != componentBits.npos; i = componentBits.FindNext(i))
+			{
+				Nz::UInt64 componentPos = stream.GetCursorPos();
+				Nz::Serialize(context, static_cast<Nz::UInt16>(i));
+				Nz::Serialize(context, Nz::UInt32(0)); //< Size, written once known
+
+				Nz::UInt64 dataPos = stream.GetCursorPos();
+				if (!entity->GetComponent(static_cast<ComponentIndex>(i)).Serialize(context))
+				{
+					// This component is not serializable, discard what we wrote for it
+					context.ResetBitPosition();
+					stream.SetCursorPos(componentPos);
+					continue;
+				}
+
+				context.FlushBits();
+
+				PatchValue(context, dataPos - sizeof(Nz::UInt32), static_cast<Nz::UInt32>(stream.GetCursorPos() - dataPos));
+				componentCount++;
+			}
+
+			if (componentCount > 0)
+				PatchValue(context, componentCountPos, componentCount);
+		}
+
+		// Discarded components may have left data past the end
+		m_data.Resize(static_cast<std::size_t>(stream.GetCursorPos()));
+	}
+
+	/*!
+	* \brief Computes the difference between a snapshot and this one
+	*
+	* \param base Snapshot the delta is computed from, usually a snapshot acknowledged by the remote peer
+	* \param delta Output byte array receiving the delta (its content is replaced)
+	*
+	* Both snapshots are XORed together and runs of identical bytes are skipped, data which did not change between the snapshots costs almost nothing.
+	*
+	* \see ApplyDelta
+	*/
+
+	void WorldSnapshot::ComputeDelta(const WorldSnapshot& base, Nz::ByteArray* delta) const
+	{
+		NazaraAssert(delta, "Invalid delta");
+
+		const Nz::UInt8* baseData = base.m_data.GetConstBuffer();
+		std::size_t baseSize = base.m_data.GetSize();
+
+		const Nz::UInt8* data = m_data.GetConstBuffer();
+		std::size_t size = m_data.GetSize();
+
+		auto XorAt = [&](std::size_t i) -> Nz::UInt8
+		{
+			return (i < baseSize) ? data[i] ^ baseData[i] : data[i];
+		};
+
+		delta->Clear(true);
+		WriteVarInt(delta, size);
+
+		std::size_t pos = 0;
+		while (pos < size)
+		{
+			std::size_t zeroStart = pos;
+			while (pos < size && XorAt(pos) == 0)
+				pos++;
+
+			std::size_t literalStart = pos;
+			while (pos < size)
+			{
+				if (XorAt(pos) != 0)
+				{
+					pos++;
+					continue;
+				}
+
+				std::size_t zeroEnd = pos;
+				while (zeroEnd < size && zeroEnd - pos < MinZeroRun && XorAt(zeroEnd) == 0)
+					zeroEnd++;
+
+				if (zeroEnd == size || zeroEnd - pos >= MinZeroRun)
+					break;
+
+				pos = zeroEnd;
+			}
+
+			WriteVarInt(delta, literalStart - zeroStart);
+			WriteVarInt(delta, pos - literalStart);
+			for (std::size_t i = literalStart; i < pos; ++i)
+				delta->PushBack(XorAt(i));
+		}
+	}
+
+	/*!
+	* \brief Restores the state of a world
+	* \return true if the snapshot was successfully restored
+	*
+	* \param world World to restore, usually the one which was captured
+	*
+	* Components of the entities are unserialized in place, components which were removed from an entity since the capture are added back when they are default-constructible.
+	* Entities killed since the capture are created again with their identifier and generation (destroying right away an entity which would have been given their identifier since),
+	* entities created since the capture are killed, and serializable components added since the capture are removed.
+	*
+	* \remark Entities and components are killed and removed as usual, at the next update of the world
+	* \remark Produces a NazaraError if the snapshot is malformed, was captured from another world (which never used one of its identifiers) or a component failed to unserialize
+	*/
+
+	bool WorldSnapshot::Restore(World& world) const
+	{
+		if (m_data.IsEmpty())
+			return true;
+
+		Nz::MemoryView stream(m_data.GetConstBuffer(), m_data.GetSize());
+
+		Nz::SerializationContext context;
+		context.endianness = Nz::Endianness_LittleEndian;
+		context.stream = &stream;
+
+		constexpr ComponentIndex InvalidIndex = std::numeric_limits<ComponentIndex>::max();
+
+		Nz::UInt16 componentTypeCount;
+		if (!Nz::Unserialize(context, &componentTypeCount))
+		{
+			NazaraError("Failed to read snapshot header");
+			return false;
+		}
+
+		std::vector<ComponentIndex> componentIndexes(componentTypeCount);
+		for (ComponentIndex& index : componentIndexes)
+		{
+			ComponentId id;
+			if (!Nz::Unserialize(context, &id))
+			{
+				NazaraError("Failed to read snapshot header");
+				return false;
+			}
+
+			auto it = BaseComponent::s_idToIndex.find(id);
+			index = (it != BaseComponent::s_idToIndex.end()) ? it->second : InvalidIndex;
+		}
+
+		Nz::UInt32 entityCount;
+		if (!Nz::Unserialize(context, &entityCount))
+		{
+			NazaraError("Failed to read snapshot header");
+			return false;
+		}
+
+		Nz::Bitset<> restoredComponents;
+		Nz::Bitset<> restoredEntities;
+		for (Nz::UInt32 i = 0; i < entityCount; ++i)
+		{
+			Nz::UInt32 id;
+			Nz::UInt32 generation;
+			Nz::UInt16 componentCount;
+			if (!Nz::Unserialize(context, &id) || !Nz::Unserialize(context, &generation) || !Nz::Unserialize(context, &componentCount))
+			{
+				NazaraError("Failed to read entity #" + Nz::String::Number(i));
+				return false;
+			}
+
+			Entity* entity = world.RestoreEntity(id, generation).GetObject();
+			if (!entity)
+			{
+				NazaraError("Entity #" + Nz::String::Number(id) + " does not belong to this world");
+				return false;
+			}
+
+			restoredEntities.UnboundedSet(id);
+			restoredComponents.Reset();
+
+			for (Nz::UInt16 j = 0; j < componentCount; ++j)
+			{
+				Nz::UInt16 typeIndex;
+				Nz::UInt32 size;
+				if (!Nz::Unserialize(context, &typeIndex) || !Nz::Unserialize(context, &size) || typeIndex >= componentTypeCount || size > stream.GetSize() - stream.GetCursorPos())
+				{
+					NazaraError("Failed to read component of entity #" + Nz::String::Number(id));
+					return false;
+				}
+
+				Nz::UInt64 dataEnd = stream.GetCursorPos() + size;
+
+				ComponentIndex index = componentIndexes[typeIndex];
+				if (index != InvalidIndex)
+				{
+					restoredComponents.UnboundedSet(index);
+
+					context.ResetBitPosition();
+
+					if (entity->HasComponent(index))
+					{
+						// It may have been removed since the capture
+						entity->GetRemovedComponentBits().UnboundedReset(index);
+
+						if (!entity->GetComponent(index).Unserialize(context))
+						{
+							NazaraError("Failed to unserialize component of entity #" + Nz::String::Number(id));
+							return false;
+						}
+					}
+					else
+					{
+						std::unique_ptr<BaseComponent> component(BaseComponent::s_entries[index].factory());
+						if (component)
+						{
+							if (!component->Unserialize(context))
+							{
+								NazaraError("Failed to unserialize component of entity #" + Nz::String::Number(id));
+								return false;
+							}
+
+							entity->AddComponent(std::move(component));
+						}
+					}
+				}
+
+				stream.SetCursorPos(dataEnd);
+			}
+
+			// Components which were not captured are either new or not serializable
+			const Nz::Bitset<>& componentBits = entity->GetComponentBits();
+			for (std::size_t j = componentBits.FindFirst(); j != componentBits.npos; j = componentBits.FindNext(j))
+			{
+				ComponentIndex index = static_cast<ComponentIndex>(j);
+				if (!restoredComponents.UnboundedTest(index) && IsSerializable(entity->GetComponent(index)))
+					entity->RemoveComponent(index);
+			}
+		}
+
+		// Entities which were not captured were created since
+		for (const EntityHandle& entity : world.GetEntities())
+		{
+			if (!restoredEntities.UnboundedTest(entity->GetId()))
+				world.KillEntity(entity);
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_BENCHMARK_HPP
+#define NAZARA_BENCHMARKS_BENCHMARK_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define BENCHMARK_CASE(name) \
+	static void NazaraSuffixMacro(NazaraBenchmark, __LINE__)(BenchmarkState& state); \
+	static BenchmarkRegistrar NazaraSuffixMacro(nazaraBenchmarkRegistrar, __LINE__)(name, &NazaraSuffixMacro(NazaraBenchmark, __LINE__)); \
+	static void NazaraSuffixMacro(NazaraBenchmark, __LINE__)(BenchmarkState& state)
+
+class BenchmarkState
+{
+	public:
+		inline explicit BenchmarkState(Nz::UInt64 iterations);
+		BenchmarkState(const BenchmarkState&) = delete;
+		~BenchmarkState() = default;
+
+		inline Nz::UInt64 GetAllocationCount() const;
+		inline std::chrono::nanoseconds GetElapsedTime() const;
+		inline const std::string& GetError() const;
+		inline Nz::UInt64 GetBytesPerIteration() const;
+		inline Nz::UInt64 GetItemsPerIteration() const;
+		inline Nz::UInt64 GetIterationCount() const;
+
+		inline bool KeepRunning();
+
+		inline void PauseTiming();
+		inline void ResumeTiming();
+
+		inline void SetBytesPerIteration(Nz::UInt64 byteCount);
+		inline void SetItemsPerIteration(Nz::UInt64 itemCount);
+		inline void SkipWithError(std::string error);
+
+		BenchmarkState& operator=(const BenchmarkState&) = delete;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		std::chrono::nanoseconds m_elapsedTime;
+		std::string m_error;
+		Clock::time_point m_startTime;
+		Nz::UInt64 m_allocationCount;
+		Nz::UInt64 m_allocationStart;
+		Nz::UInt64 m_byteCount;
+		Nz::UInt64 m_itemCount;
+		Nz::UInt64 m_iterationCount;
+		Nz::UInt64 m_remainingIterations;
+		bool m_running;
+		bool m_started;
+};
+
+using BenchmarkFunction = void(*)(BenchmarkState& state);
+
+struct BenchmarkRegistrar
+{
+	struct Entry
+	{
+		const char* name;
+		BenchmarkFunction function;
+	};
+
+	inline BenchmarkRegistrar(const char* name, BenchmarkFunction function);
+
+	static inline std::vector<Entry>& GetBenchmarks();
+};
+
+template<typename T> void DoNotOptimize(const T& value);
+
+Nz::UInt64 GetGlobalAllocationCount();
+
+#include "Benchmark.inl"
+
+#endif // NAZARA_BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,140 @@
+#include "Benchmark.hpp"
+#include <utility>
+
+#ifdef NAZARA_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+inline BenchmarkState::BenchmarkState(Nz::UInt64 iterations) :
+m_elapsedTime(0),
+m_allocationCount(0),
+m_allocationStart(0),
+m_byteCount(0),
+m_itemCount(0),
+m_iterationCount(iterations),
+m_remainingIterations(iterations),
+m_running(false),
+m_started(false)
+{
+}
+
+/*!
+* \brief Gets the number of allocations (through operator new) which happened while timing, on any thread
+*/
+inline Nz::UInt64 BenchmarkState::GetAllocationCount() const
+{
+	return m_allocationCount;
+}
+
+inline std::chrono::nanoseconds BenchmarkState::GetElapsedTime() const
+{
+	return m_elapsedTime;
+}
+
+inline const std::string& BenchmarkState::GetError() const
+{
+	return m_error;
+}
+
+inline Nz::UInt64 BenchmarkState::GetBytesPerIteration() const
+{
+	return m_byteCount;
+}
+
+inline Nz::UInt64 BenchmarkState::GetItemsPerIteration() const
+{
+	return m_itemCount;
+}
+
+inline Nz::UInt64 BenchmarkState::GetIterationCount() const
+{
+	return m_iterationCount;
+}
+
+/*!
+* \brief Controls the measured loop, the timer starts with the first call and stops once every iteration has run
+* \return true while there are iterations left
+*/
+inline bool BenchmarkState::KeepRunning()
+{
+	if (!m_started)
+	{
+		m_started = true;
+		ResumeTiming();
+	}
+	else
+		m_remainingIterations--;
+
+	if (m_remainingIterations > 0 && m_error.empty())
+		return true;
+
+	PauseTiming();
+	return false;
+}
+
+/*!
+* \brief Stops the timer, for per-iteration setup which should not be measured
+*/
+inline void BenchmarkState::PauseTiming()
+{
+	if (m_running)
+	{
+		m_elapsedTime += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_startTime);
+		m_allocationCount += GetGlobalAllocationCount() - m_allocationStart;
+		m_running = false;
+	}
+}
+
+inline void BenchmarkState::ResumeTiming()
+{
+	if (!m_running)
+	{
+		m_running = true;
+		m_allocationStart = GetGlobalAllocationCount();
+		m_startTime = Clock::now();
+	}
+}
+
+inline void BenchmarkState::SetBytesPerIteration(Nz::UInt64 byteCount)
+{
+	m_byteCount = byteCount;
+}
+
+inline void BenchmarkState::SetItemsPerIteration(Nz::UInt64 itemCount)
+{
+	m_itemCount = itemCount;
+}
+
+/*!
+* \brief Marks the benchmark as failed, KeepRunning will return false
+*/
+inline void BenchmarkState::SkipWithError(std::string error)
+{
+	m_error = std::move(error);
+}
+
+inline BenchmarkRegistrar::BenchmarkRegistrar(const char* name, BenchmarkFunction function)
+{
+	GetBenchmarks().push_back({name, function});
+}
+
+inline std::vector<BenchmarkRegistrar::Entry>& BenchmarkRegistrar::GetBenchmarks()
+{
+	static std::vector<Entry> benchmarks;
+	return benchmarks;
+}
+
+/*!
+* \brief Prevents the compiler from optimizing away the computation of a value
+*/
+template<typename T>
+void DoNotOptimize(const T& value)
+{
+	#ifdef NAZARA_COMPILER_MSVC
+	const volatile char* ptr = &reinterpret_cast<const volatile char&>(value);
+	NazaraUnused(ptr);
+	_ReadWriteBarrier();
+	#else
+	asm volatile("" : : "r,m"(value) : "memory");
+	#endif
+}
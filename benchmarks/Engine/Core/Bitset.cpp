@@ -0,0 +1,118 @@
+#include <Nazara/Core/Bitset.hpp>
+#include <random>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t BitCount = 64 * 1024;
+
+	Nz::Bitset<> GenerateBitset(unsigned int seed, float density)
+	{
+		std::mt19937 generator(seed);
+		std::bernoulli_distribution distribution(density);
+
+		Nz::Bitset<> bitset(BitCount, false);
+		for (std::size_t i = 0; i < BitCount; ++i)
+			bitset.Set(i, distribution(generator));
+
+		return bitset;
+	}
+}
+
+BENCHMARK_CASE("Bitset/AND")
+{
+	Nz::Bitset<> a = GenerateBitset(1, 0.5f);
+	Nz::Bitset<> b = GenerateBitset(2, 0.5f);
+	Nz::Bitset<> result;
+
+	while (state.KeepRunning())
+	{
+		result.PerformsAND(a, b);
+		DoNotOptimize(result.GetBlock(0));
+	}
+
+	state.SetBytesPerIteration(BitCount / 8 * 2);
+}
+
+BENCHMARK_CASE("Bitset/Count")
+{
+	Nz::Bitset<> bitset = GenerateBitset(1, 0.5f);
+
+	while (state.KeepRunning())
+		DoNotOptimize(bitset.Count());
+
+	state.SetBytesPerIteration(BitCount / 8);
+}
+
+BENCHMARK_CASE("Bitset/Iterate (sparse)")
+{
+	Nz::Bitset<> bitset = GenerateBitset(1, 0.01f);
+
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		for (std::size_t i = bitset.FindFirst(); i != bitset.npos; i = bitset.FindNext(i))
+			sum += i;
+
+		DoNotOptimize(sum);
+	}
+
+	state.SetBytesPerIteration(BitCount / 8);
+}
+
+BENCHMARK_CASE("Bitset/Iterate (dense)")
+{
+	Nz::Bitset<> bitset = GenerateBitset(1, 0.9f);
+
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		for (std::size_t i = bitset.FindFirst(); i != bitset.npos; i = bitset.FindNext(i))
+			sum += i;
+
+		DoNotOptimize(sum);
+	}
+
+	state.SetBytesPerIteration(BitCount / 8);
+}
+
+BENCHMARK_CASE("Bitset/ForEachSetBit (sparse)")
+{
+	Nz::Bitset<> bitset = GenerateBitset(1, 0.01f);
+
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		bitset.ForEachSetBit([&](std::size_t i) { sum += i; });
+
+		DoNotOptimize(sum);
+	}
+
+	state.SetBytesPerIteration(BitCount / 8);
+}
+
+BENCHMARK_CASE("Bitset/ForEachSetBit (dense)")
+{
+	Nz::Bitset<> bitset = GenerateBitset(1, 0.9f);
+
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		bitset.ForEachSetBit([&](std::size_t i) { sum += i; });
+
+		DoNotOptimize(sum);
+	}
+
+	state.SetBytesPerIteration(BitCount / 8);
+}
+
+BENCHMARK_CASE("Bitset/Intersects (disjoint)")
+{
+	Nz::Bitset<> a = GenerateBitset(1, 0.5f);
+	Nz::Bitset<> b = ~a;
+
+	while (state.KeepRunning())
+		DoNotOptimize(a.Intersects(b));
+
+	state.SetBytesPerIteration(BitCount / 8 * 2);
+}
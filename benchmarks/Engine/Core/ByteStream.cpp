@@ -0,0 +1,51 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Benchmark.hpp>
+
+BENCHMARK_CASE("ByteStream/Write")
+{
+	Nz::ByteArray array;
+	array.Reserve(1024 * (sizeof(Nz::UInt32) + sizeof(float)));
+
+	while (state.KeepRunning())
+	{
+		array.Clear();
+
+		Nz::ByteStream stream(&array);
+		for (unsigned int i = 0; i < 1024; ++i)
+			stream << Nz::UInt32(i) << float(i);
+
+		DoNotOptimize(array.GetConstBuffer());
+	}
+
+	state.SetBytesPerIteration(1024 * (sizeof(Nz::UInt32) + sizeof(float)));
+}
+
+BENCHMARK_CASE("ByteStream/Read")
+{
+	Nz::ByteArray array;
+	{
+		Nz::ByteStream stream(&array);
+		for (unsigned int i = 0; i < 1024; ++i)
+			stream << Nz::UInt32(i) << float(i);
+	}
+
+	while (state.KeepRunning())
+	{
+		Nz::ByteStream stream(array.GetConstBuffer(), array.GetSize());
+
+		Nz::UInt32 sum = 0;
+		for (unsigned int i = 0; i < 1024; ++i)
+		{
+			Nz::UInt32 integer;
+			float value;
+			stream >> integer >> value;
+
+			sum += integer;
+		}
+
+		DoNotOptimize(sum);
+	}
+
+	state.SetBytesPerIteration(array.GetSize());
+}
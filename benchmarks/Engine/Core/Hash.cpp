@@ -0,0 +1,43 @@
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/Hash/CRC32C.hpp>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t DatagramSize = 1400;
+
+	std::vector<Nz::UInt8> GenerateData()
+	{
+		std::vector<Nz::UInt8> data(DatagramSize);
+		for (std::size_t i = 0; i < data.size(); ++i)
+			data[i] = static_cast<Nz::UInt8>(i * 31 + (i >> 3));
+
+		return data;
+	}
+}
+
+BENCHMARK_CASE("Hash/CRC32 (1400B)")
+{
+	std::vector<Nz::UInt8> data = GenerateData();
+	std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(Nz::HashType_CRC32);
+
+	while (state.KeepRunning())
+	{
+		hash->Begin();
+		hash->Append(data.data(), data.size());
+		DoNotOptimize(hash->End());
+	}
+
+	state.SetBytesPerIteration(DatagramSize);
+}
+
+BENCHMARK_CASE("Hash/CRC32C (1400B)")
+{
+	std::vector<Nz::UInt8> data = GenerateData();
+
+	while (state.KeepRunning())
+		DoNotOptimize(Nz::HashCRC32C::Compute(data.data(), data.size()));
+
+	state.SetBytesPerIteration(DatagramSize);
+}
@@ -0,0 +1,65 @@
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/MemoryPool.hpp>
+#include <array>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t BlockSize = 64;
+	constexpr std::size_t BlockCount = 256;
+}
+
+BENCHMARK_CASE("MemoryPool/AllocateFree")
+{
+	Nz::MemoryPool pool(BlockSize, BlockCount);
+
+	std::array<void*, BlockCount> blocks;
+	while (state.KeepRunning())
+	{
+		for (void*& block : blocks)
+			block = pool.Allocate(BlockSize);
+
+		DoNotOptimize(blocks);
+
+		for (void* block : blocks)
+			pool.Free(block);
+	}
+
+	state.SetItemsPerIteration(BlockCount);
+}
+
+BENCHMARK_CASE("ConcurrentMemoryPool/AllocateFree")
+{
+	Nz::ConcurrentMemoryPool pool(BlockSize, BlockCount);
+
+	std::array<void*, BlockCount> blocks;
+	while (state.KeepRunning())
+	{
+		for (void*& block : blocks)
+			block = pool.Allocate();
+
+		DoNotOptimize(blocks);
+
+		for (void* block : blocks)
+			pool.Free(block);
+	}
+
+	state.SetItemsPerIteration(BlockCount);
+}
+
+BENCHMARK_CASE("OperatorNew/AllocateFree")
+{
+	std::array<char*, BlockCount> blocks;
+	while (state.KeepRunning())
+	{
+		for (char*& block : blocks)
+			block = new char[BlockSize];
+
+		DoNotOptimize(blocks);
+
+		for (char* block : blocks)
+			delete[] block;
+	}
+
+	state.SetItemsPerIteration(BlockCount);
+}
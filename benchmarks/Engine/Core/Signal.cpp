@@ -0,0 +1,133 @@
+#include <Nazara/Core/LightSignal.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <memory>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t SumStride = 16; //< One counter per cache line
+
+	struct Listener
+	{
+		virtual ~Listener() = default;
+
+		virtual void OnValue(int value) = 0;
+	};
+
+	struct SumListener : Listener
+	{
+		void OnValue(int value) override
+		{
+			sum += value;
+		}
+
+		int sum = 0;
+	};
+}
+
+BENCHMARK_CASE("Signal/Emit (1 slot)")
+{
+	Nz::Signal<int> signal;
+
+	int sum = 0;
+	Nz::Signal<int>::ConnectionGuard connection = signal.Connect([&](int value) { sum += value; });
+
+	while (state.KeepRunning())
+		signal(1);
+
+	DoNotOptimize(sum);
+	state.SetItemsPerIteration(1);
+}
+
+BENCHMARK_CASE("Signal/Emit (16 slots)")
+{
+	Nz::Signal<int> signal;
+
+	// Each listener has its own counter, as real listeners, so we don't only measure a dependency chain
+	std::vector<int> sums(16 * SumStride);
+	std::vector<Nz::Signal<int>::ConnectionGuard> connections;
+	for (unsigned int i = 0; i < 16; ++i)
+	{
+		int* sum = &sums[i * SumStride];
+		connections.emplace_back(signal.Connect([sum](int value) { *sum += value; }));
+	}
+
+	while (state.KeepRunning())
+		signal(1);
+
+	DoNotOptimize(sums);
+	state.SetItemsPerIteration(16);
+}
+
+BENCHMARK_CASE("Signal/ConnectDisconnect")
+{
+	Nz::Signal<int> signal;
+
+	while (state.KeepRunning())
+	{
+		Nz::Signal<int>::Connection connection = signal.Connect([](int) {});
+		connection.Disconnect();
+	}
+}
+
+BENCHMARK_CASE("Signal/Emit (16 virtual calls baseline)")
+{
+	std::vector<std::unique_ptr<Listener>> listeners;
+	for (unsigned int i = 0; i < 16; ++i)
+		listeners.emplace_back(std::make_unique<SumListener>());
+
+	while (state.KeepRunning())
+	{
+		for (const std::unique_ptr<Listener>& listener : listeners)
+			listener->OnValue(1);
+	}
+
+	DoNotOptimize(listeners);
+	state.SetItemsPerIteration(16);
+}
+
+BENCHMARK_CASE("LightSignal/Emit (1 slot)")
+{
+	Nz::LightSignal<int> signal;
+
+	int sum = 0;
+	Nz::LightSignal<int>::ConnectionGuard connection = signal.Connect([&](int value) { sum += value; });
+
+	while (state.KeepRunning())
+		signal(1);
+
+	DoNotOptimize(sum);
+	state.SetItemsPerIteration(1);
+}
+
+BENCHMARK_CASE("LightSignal/Emit (16 slots)")
+{
+	Nz::LightSignal<int> signal;
+
+	// Each listener has its own counter, as real listeners, so we don't only measure a dependency chain
+	std::vector<int> sums(16 * SumStride);
+	std::vector<Nz::LightSignal<int>::ConnectionGuard> connections;
+	for (unsigned int i = 0; i < 16; ++i)
+	{
+		int* sum = &sums[i * SumStride];
+		connections.emplace_back(signal.Connect([sum](int value) { *sum += value; }));
+	}
+
+	while (state.KeepRunning())
+		signal(1);
+
+	DoNotOptimize(sums);
+	state.SetItemsPerIteration(16);
+}
+
+BENCHMARK_CASE("LightSignal/ConnectDisconnect")
+{
+	Nz::LightSignal<int> signal;
+
+	while (state.KeepRunning())
+	{
+		Nz::LightSignal<int>::ConnectionGuard connection = signal.Connect([](int) {});
+		connection.Disconnect();
+	}
+}
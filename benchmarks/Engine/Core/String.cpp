@@ -0,0 +1,60 @@
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <vector>
+#include <Benchmark.hpp>
+
+BENCHMARK_CASE("String/Append")
+{
+	while (state.KeepRunning())
+	{
+		Nz::String str;
+		for (unsigned int i = 0; i < 64; ++i)
+			str += "Nazara";
+
+		DoNotOptimize(str);
+	}
+
+	state.SetItemsPerIteration(64);
+}
+
+BENCHMARK_CASE("String/Find")
+{
+	Nz::String haystack = Nz::String(4096, 'a') + "Nazara";
+
+	while (state.KeepRunning())
+		DoNotOptimize(haystack.Find("Nazara"));
+
+	state.SetBytesPerIteration(haystack.GetSize());
+}
+
+BENCHMARK_CASE("String/Split")
+{
+	Nz::String str;
+	for (unsigned int i = 0; i < 256; ++i)
+		str += "word ";
+
+	std::vector<Nz::String> words;
+	while (state.KeepRunning())
+	{
+		words.clear();
+		str.Split(words, ' ');
+
+		DoNotOptimize(words.data());
+	}
+
+	state.SetItemsPerIteration(256);
+}
+
+BENCHMARK_CASE("StringStream/Numbers")
+{
+	while (state.KeepRunning())
+	{
+		Nz::StringStream stream;
+		for (int i = 0; i < 64; ++i)
+			stream << i << ' ' << i * 0.5f << ' ';
+
+		DoNotOptimize(stream.ToString());
+	}
+
+	state.SetItemsPerIteration(128);
+}
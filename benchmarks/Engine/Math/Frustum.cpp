@@ -0,0 +1,71 @@
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <random>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t ObjectCount = 4096;
+
+	Nz::Frustumf BuildFrustum()
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(70.f, 16.f / 9.f, 0.1f, 500.f, Nz::Vector3f::Zero(), Nz::Vector3f::Forward());
+
+		return frustum;
+	}
+}
+
+BENCHMARK_CASE("Frustum/Cull boxes")
+{
+	Nz::Frustumf frustum = BuildFrustum();
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> distribution(-500.f, 500.f);
+
+	std::vector<Nz::Boxf> boxes(ObjectCount);
+	for (Nz::Boxf& box : boxes)
+		box.Set(distribution(generator), distribution(generator), distribution(generator), 2.f, 2.f, 2.f);
+
+	while (state.KeepRunning())
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::Boxf& box : boxes)
+		{
+			if (frustum.Contains(box))
+				visibleCount++;
+		}
+
+		DoNotOptimize(visibleCount);
+	}
+
+	state.SetItemsPerIteration(ObjectCount);
+}
+
+BENCHMARK_CASE("Frustum/Cull spheres")
+{
+	Nz::Frustumf frustum = BuildFrustum();
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> distribution(-500.f, 500.f);
+
+	std::vector<Nz::Spheref> spheres(ObjectCount);
+	for (Nz::Spheref& sphere : spheres)
+		sphere.Set(distribution(generator), distribution(generator), distribution(generator), 1.f);
+
+	while (state.KeepRunning())
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::Spheref& sphere : spheres)
+		{
+			if (frustum.Contains(sphere))
+				visibleCount++;
+		}
+
+		DoNotOptimize(visibleCount);
+	}
+
+	state.SetItemsPerIteration(ObjectCount);
+}
@@ -0,0 +1,49 @@
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <vector>
+#include <Benchmark.hpp>
+
+BENCHMARK_CASE("Matrix4/Concatenate")
+{
+	Nz::Matrix4f a = Nz::Matrix4f::Transform(Nz::Vector3f(1.f, 2.f, 3.f), Nz::EulerAnglesf(10.f, 20.f, 30.f));
+	Nz::Matrix4f b = Nz::Matrix4f::Perspective(70.f, 16.f / 9.f, 0.1f, 1000.f);
+
+	while (state.KeepRunning())
+	{
+		Nz::Matrix4f result = Nz::Matrix4f::Concatenate(a, b);
+		DoNotOptimize(result);
+	}
+}
+
+BENCHMARK_CASE("Matrix4/GetInverse")
+{
+	Nz::Matrix4f matrix = Nz::Matrix4f::Transform(Nz::Vector3f(1.f, 2.f, 3.f), Nz::EulerAnglesf(10.f, 20.f, 30.f), Nz::Vector3f(2.f));
+
+	while (state.KeepRunning())
+	{
+		Nz::Matrix4f inverse;
+		matrix.GetInverse(&inverse);
+
+		DoNotOptimize(inverse);
+	}
+}
+
+BENCHMARK_CASE("Matrix4/Transform (1024 points)")
+{
+	Nz::Matrix4f matrix = Nz::Matrix4f::Transform(Nz::Vector3f(1.f, 2.f, 3.f), Nz::EulerAnglesf(10.f, 20.f, 30.f));
+
+	std::vector<Nz::Vector3f> points(1024);
+	for (std::size_t i = 0; i < points.size(); ++i)
+		points[i].Set(float(i), float(i) * 0.5f, float(i) * 0.25f);
+
+	while (state.KeepRunning())
+	{
+		for (Nz::Vector3f& point : points)
+			point = matrix.Transform(point);
+
+		DoNotOptimize(points.data());
+	}
+
+	state.SetItemsPerIteration(points.size());
+}
@@ -0,0 +1,211 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr Nz::UInt16 ServerPort = 42420;
+	constexpr Nz::UInt64 Timeout = 5000; //< Milliseconds
+
+	struct Loopback
+	{
+		Nz::ENetHost client;
+		Nz::ENetHost server;
+		Nz::ENetPeer* clientPeer = nullptr;
+		Nz::ENetPeer* serverPeer = nullptr;
+	};
+
+	bool ConnectLoopback(BenchmarkState& state, Loopback& loopback)
+	{
+		if (!loopback.server.Create(Nz::NetProtocol_IPv4, ServerPort, 1) || !loopback.client.Create(Nz::NetProtocol_IPv4, 0, 1))
+		{
+			state.SkipWithError("Failed to create hosts");
+			return false;
+		}
+
+		Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+		serverAddress.SetPort(ServerPort);
+
+		loopback.clientPeer = loopback.client.Connect(serverAddress, 1);
+		if (!loopback.clientPeer)
+		{
+			state.SkipWithError("Failed to connect");
+			return false;
+		}
+
+		bool clientConnected = false;
+		Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+		while (!clientConnected || !loopback.serverPeer)
+		{
+			if (Nz::GetElapsedMilliseconds() - startTime > Timeout)
+			{
+				state.SkipWithError("Connection timed out");
+				return false;
+			}
+
+			Nz::ENetEvent event;
+			while (loopback.server.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::IncomingConnect)
+					loopback.serverPeer = event.peer;
+			}
+
+			while (loopback.client.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::OutgoingConnect)
+					clientConnected = true;
+			}
+		}
+
+		return true;
+	}
+
+	void SendPackets(BenchmarkState& state, Nz::ENetPacketFlags flags, std::size_t packetSize)
+	{
+		Loopback loopback;
+		if (!ConnectLoopback(state, loopback))
+			return;
+
+		std::vector<Nz::UInt8> payload(packetSize, 0x42);
+
+		while (state.KeepRunning())
+		{
+			Nz::NetPacket packet(1, payload.data(), payload.size());
+			loopback.clientPeer->Send(0, flags, std::move(packet));
+			loopback.client.Flush();
+
+			// Wait for the packet to be received, acknowledgements are sent by the following services
+			Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+			bool received = false;
+			while (!received)
+			{
+				Nz::ENetEvent event;
+				while (loopback.server.Service(&event, 0) > 0)
+				{
+					if (event.type == Nz::ENetEventType::Receive)
+						received = true;
+				}
+
+				while (loopback.client.Service(&event, 0) > 0);
+
+				if (Nz::GetElapsedMilliseconds() - startTime > Timeout)
+				{
+					state.SkipWithError("Packet was not received");
+					break;
+				}
+			}
+		}
+
+		state.SetBytesPerIteration(packetSize);
+	}
+
+	void SustainLoad(BenchmarkState& state, std::size_t peerCount, std::size_t packetSize)
+	{
+		Nz::ENetHost client;
+		Nz::ENetHost server;
+		if (!server.Create(Nz::NetProtocol_IPv4, ServerPort, peerCount) || !client.Create(Nz::NetProtocol_IPv4, 0, peerCount))
+		{
+			state.SkipWithError("Failed to create hosts");
+			return;
+		}
+
+		Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+		serverAddress.SetPort(ServerPort);
+
+		for (std::size_t i = 0; i < peerCount; ++i)
+		{
+			if (!client.Connect(serverAddress, 1))
+			{
+				state.SkipWithError("Failed to connect");
+				return;
+			}
+		}
+
+		std::vector<Nz::ENetPeer*> serverPeers;
+		std::size_t connectedClients = 0;
+
+		Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+		while (connectedClients < peerCount || serverPeers.size() < peerCount)
+		{
+			if (Nz::GetElapsedMilliseconds() - startTime > Timeout)
+			{
+				state.SkipWithError("Connection timed out");
+				return;
+			}
+
+			Nz::ENetEvent event;
+			while (server.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::IncomingConnect)
+					serverPeers.push_back(event.peer);
+			}
+
+			while (client.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::OutgoingConnect)
+					connectedClients++;
+			}
+		}
+
+		std::vector<Nz::UInt8> payload(packetSize, 0x42);
+
+		// Every peer gets a reliable packet per iteration, which goes through the outgoing, sent and incoming queues
+		while (state.KeepRunning())
+		{
+			for (Nz::ENetPeer* peer : serverPeers)
+				peer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, payload.data(), payload.size()));
+
+			server.Flush();
+
+			std::size_t receivedPackets = 0;
+			startTime = Nz::GetElapsedMilliseconds();
+			while (receivedPackets < peerCount)
+			{
+				Nz::ENetEvent event;
+				while (client.Service(&event, 0) > 0)
+				{
+					if (event.type == Nz::ENetEventType::Receive)
+						receivedPackets++;
+				}
+
+				while (server.Service(&event, 0) > 0);
+
+				if (Nz::GetElapsedMilliseconds() - startTime > Timeout)
+				{
+					state.SkipWithError("Packets were not received");
+					break;
+				}
+			}
+		}
+
+		state.SetItemsPerIteration(peerCount);
+	}
+}
+
+BENCHMARK_CASE("ENetHost/Loopback reliable (64B)")
+{
+	SendPackets(state, Nz::ENetPacketFlag_Reliable, 64);
+}
+
+BENCHMARK_CASE("ENetHost/Loopback reliable (4KB)")
+{
+	SendPackets(state, Nz::ENetPacketFlag_Reliable, 4096);
+}
+
+BENCHMARK_CASE("ENetHost/Loopback unreliable (64B)")
+{
+	SendPackets(state, Nz::ENetPacketFlag_Unreliable, 64);
+}
+
+BENCHMARK_CASE("ENetHost/Loopback unreliable (16KB)")
+{
+	SendPackets(state, Nz::ENetPacketFlag_Unreliable, 16 * 1024);
+}
+
+BENCHMARK_CASE("ENetHost/Sustained reliable load (500 peers)")
+{
+	SustainLoad(state, 500, 64);
+}
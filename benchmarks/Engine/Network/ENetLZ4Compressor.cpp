@@ -0,0 +1,75 @@
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <array>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t DatagramSize = 1200;
+
+	// Looks like entity state updates: ids, slowly changing positions and mostly unchanged flags
+	std::vector<Nz::UInt8> GenerateStateUpdate()
+	{
+		std::vector<Nz::UInt8> data(DatagramSize);
+		for (std::size_t i = 0; i < data.size(); ++i)
+		{
+			std::size_t field = i % 24;
+			if (field < 4)
+				data[i] = static_cast<Nz::UInt8>((field == 0) ? i / 24 : 0);
+			else if (field < 16)
+				data[i] = static_cast<Nz::UInt8>((field % 4 == 3) ? 0x41 : (i * 31) >> 6);
+			else
+				data[i] = 0;
+		}
+
+		return data;
+	}
+}
+
+BENCHMARK_CASE("ENetLZ4Compressor/Compress state update (1200B)")
+{
+	std::vector<Nz::UInt8> data = GenerateStateUpdate();
+	std::array<Nz::UInt8, DatagramSize> output;
+
+	Nz::ENetLZ4Compressor compressor;
+	Nz::NetBuffer buffer = { data.data(), data.size() };
+
+	while (state.KeepRunning())
+	{
+		if (compressor.Compress(nullptr, &buffer, 1, data.size(), output.data(), output.size()) == 0)
+		{
+			state.SkipWithError("Failed to compress");
+			break;
+		}
+	}
+
+	state.SetBytesPerIteration(DatagramSize);
+}
+
+BENCHMARK_CASE("ENetLZ4Compressor/Decompress state update (1200B)")
+{
+	std::vector<Nz::UInt8> data = GenerateStateUpdate();
+	std::array<Nz::UInt8, DatagramSize> compressed;
+	std::array<Nz::UInt8, DatagramSize> output;
+
+	Nz::ENetLZ4Compressor compressor;
+	Nz::NetBuffer buffer = { data.data(), data.size() };
+
+	std::size_t compressedSize = compressor.Compress(nullptr, &buffer, 1, data.size(), compressed.data(), compressed.size());
+	if (compressedSize == 0)
+	{
+		state.SkipWithError("Failed to compress");
+		return;
+	}
+
+	while (state.KeepRunning())
+	{
+		if (compressor.Decompress(nullptr, compressed.data(), compressedSize, output.data(), output.size()) != DatagramSize)
+		{
+			state.SkipWithError("Failed to decompress");
+			break;
+		}
+	}
+
+	state.SetBytesPerIteration(DatagramSize);
+}
@@ -0,0 +1,123 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <memory>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr Nz::UInt16 ServerPort = 42421;
+	constexpr Nz::UInt64 Timeout = 5000; //< Milliseconds
+
+	// Peers are spread on several client hosts as the system balances datagrams between shards according to their source address
+	void SustainLoad(BenchmarkState& state, std::size_t shardCount, std::size_t clientCount, std::size_t peersPerClient, std::size_t packetSize)
+	{
+		std::size_t peerCount = clientCount * peersPerClient;
+
+		Nz::ENetShardedHost server;
+		if (!server.Create(Nz::NetProtocol_IPv4, ServerPort, peerCount, 1, shardCount))
+		{
+			state.SkipWithError("Failed to create server");
+			return;
+		}
+
+		Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+		serverAddress.SetPort(ServerPort);
+
+		std::vector<std::unique_ptr<Nz::ENetHost>> clients;
+		for (std::size_t i = 0; i < clientCount; ++i)
+		{
+			clients.emplace_back(std::make_unique<Nz::ENetHost>());
+			if (!clients.back()->Create(Nz::NetProtocol_IPv4, 0, peersPerClient))
+			{
+				state.SkipWithError("Failed to create clients");
+				return;
+			}
+
+			for (std::size_t j = 0; j < peersPerClient; ++j)
+			{
+				if (!clients.back()->Connect(serverAddress, 1))
+				{
+					state.SkipWithError("Failed to connect");
+					return;
+				}
+			}
+		}
+
+		std::vector<Nz::ENetPeer*> serverPeers;
+		std::size_t connectedClients = 0;
+
+		Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+		while (connectedClients < peerCount || serverPeers.size() < peerCount)
+		{
+			if (Nz::GetElapsedMilliseconds() - startTime > Timeout)
+			{
+				state.SkipWithError("Connection timed out");
+				return;
+			}
+
+			Nz::ENetEvent event;
+			while (server.CheckEvents(&event))
+			{
+				if (event.type == Nz::ENetEventType::IncomingConnect)
+					serverPeers.push_back(event.peer);
+			}
+
+			for (const auto& client : clients)
+			{
+				while (client->Service(&event, 0) > 0)
+				{
+					if (event.type == Nz::ENetEventType::OutgoingConnect)
+						connectedClients++;
+				}
+			}
+		}
+
+		std::vector<Nz::UInt8> payload(packetSize, 0x42);
+
+		// Every peer gets a reliable packet per iteration and acknowledges it, the server side is handled by the shard threads
+		while (state.KeepRunning())
+		{
+			for (Nz::ENetPeer* peer : serverPeers)
+				server.Send(peer, 0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, payload.data(), payload.size()));
+
+			std::size_t receivedPackets = 0;
+			startTime = Nz::GetElapsedMilliseconds();
+			while (receivedPackets < peerCount)
+			{
+				Nz::ENetEvent event;
+				for (const auto& client : clients)
+				{
+					while (client->Service(&event, 0) > 0)
+					{
+						if (event.type == Nz::ENetEventType::Receive)
+							receivedPackets++;
+					}
+				}
+
+				while (server.CheckEvents(&event));
+
+				if (Nz::GetElapsedMilliseconds() - startTime > Timeout)
+				{
+					state.SkipWithError("Packets were not received");
+					break;
+				}
+			}
+		}
+
+		state.SetItemsPerIteration(peerCount);
+	}
+}
+
+BENCHMARK_CASE("ENetShardedHost/Sustained reliable load (500 peers, 1 shard)")
+{
+	SustainLoad(state, 1, 20, 25, 64);
+}
+
+BENCHMARK_CASE("ENetShardedHost/Sustained reliable load (500 peers, 4 shards)")
+{
+	SustainLoad(state, 4, 20, 25, 64);
+}
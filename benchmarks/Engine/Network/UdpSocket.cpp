@@ -0,0 +1,115 @@
+#include <Nazara/Network/UdpSocket.hpp>
+#include <array>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t BatchSize = 32;
+	constexpr std::size_t DatagramSize = 256;
+	constexpr Nz::UInt16 ServerPort = 42421;
+
+	struct Loopback
+	{
+		Nz::IpAddress serverAddress;
+		Nz::UdpSocket client;
+		Nz::UdpSocket server;
+	};
+
+	bool BindLoopback(BenchmarkState& state, Loopback& loopback)
+	{
+		loopback.client.Create(Nz::NetProtocol_IPv4);
+		loopback.server.Create(Nz::NetProtocol_IPv4);
+
+		if (loopback.server.Bind(ServerPort) != Nz::SocketState_Bound || loopback.client.Bind(0) != Nz::SocketState_Bound)
+		{
+			state.SkipWithError("Failed to bind sockets");
+			return false;
+		}
+
+		// Make sure a batch fits in the socket buffers
+		loopback.client.SetSendBufferSize(BatchSize * DatagramSize * 4);
+		loopback.server.SetReceiveBufferSize(BatchSize * DatagramSize * 4);
+
+		loopback.serverAddress = Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), ServerPort);
+
+		return true;
+	}
+}
+
+BENCHMARK_CASE("UdpSocket/Loopback one datagram per call (32x256B)")
+{
+	Loopback loopback;
+	if (!BindLoopback(state, loopback))
+		return;
+
+	std::vector<Nz::UInt8> payload(DatagramSize, 0x42);
+	std::vector<Nz::UInt8> receiveBuffer(DatagramSize);
+
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < BatchSize; ++i)
+			loopback.client.Send(loopback.serverAddress, payload.data(), payload.size(), nullptr);
+
+		for (std::size_t i = 0; i < BatchSize; ++i)
+		{
+			std::size_t received;
+			if (!loopback.server.Receive(receiveBuffer.data(), receiveBuffer.size(), nullptr, &received) || received != DatagramSize)
+			{
+				state.SkipWithError("Failed to receive datagram");
+				return;
+			}
+		}
+	}
+
+	state.SetBytesPerIteration(BatchSize * DatagramSize);
+	state.SetItemsPerIteration(BatchSize);
+}
+
+BENCHMARK_CASE("UdpSocket/Loopback batched datagrams (32x256B)")
+{
+	Loopback loopback;
+	if (!BindLoopback(state, loopback))
+		return;
+
+	std::vector<Nz::UInt8> payload(DatagramSize, 0x42);
+	std::vector<Nz::UInt8> receiveData(BatchSize * DatagramSize);
+
+	Nz::NetBuffer sendBuffer = { payload.data(), payload.size() };
+	std::array<Nz::NetBuffer, BatchSize> receiveBuffers;
+	std::array<Nz::NetDatagram, BatchSize> receiveDatagrams;
+	std::array<Nz::NetDatagram, BatchSize> sendDatagrams;
+	for (std::size_t i = 0; i < BatchSize; ++i)
+	{
+		receiveBuffers[i] = { &receiveData[i * DatagramSize], DatagramSize };
+
+		receiveDatagrams[i].buffers = &receiveBuffers[i];
+		receiveDatagrams[i].bufferCount = 1;
+
+		sendDatagrams[i].address = loopback.serverAddress;
+		sendDatagrams[i].buffers = &sendBuffer;
+		sendDatagrams[i].bufferCount = 1;
+	}
+
+	while (state.KeepRunning())
+	{
+		std::size_t sent;
+		loopback.client.SendDatagrams(sendDatagrams.data(), sendDatagrams.size(), &sent);
+
+		std::size_t totalReceived = 0;
+		while (totalReceived < sent)
+		{
+			std::size_t received;
+			if (!loopback.server.ReceiveDatagrams(&receiveDatagrams[totalReceived], sent - totalReceived, &received) || received == 0)
+			{
+				state.SkipWithError("Failed to receive datagrams");
+				return;
+			}
+
+			totalReceived += received;
+		}
+	}
+
+	state.SetBytesPerIteration(BatchSize * DatagramSize);
+	state.SetItemsPerIteration(BatchSize);
+}
@@ -0,0 +1,64 @@
+#include <Nazara/Noise/Perlin.hpp>
+#include <Nazara/Noise/Simplex.hpp>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr unsigned int GridSize = 64;
+
+	template<typename Noise>
+	void SampleGrid2D(BenchmarkState& state, const Noise& noise)
+	{
+		while (state.KeepRunning())
+		{
+			float sum = 0.f;
+			for (unsigned int y = 0; y < GridSize; ++y)
+			{
+				for (unsigned int x = 0; x < GridSize; ++x)
+					sum += noise.Get(float(x), float(y), 0.05f);
+			}
+
+			DoNotOptimize(sum);
+		}
+
+		state.SetItemsPerIteration(GridSize * GridSize);
+	}
+
+	template<typename Noise>
+	void SampleGrid3D(BenchmarkState& state, const Noise& noise)
+	{
+		while (state.KeepRunning())
+		{
+			float sum = 0.f;
+			for (unsigned int y = 0; y < GridSize; ++y)
+			{
+				for (unsigned int x = 0; x < GridSize; ++x)
+					sum += noise.Get(float(x), float(y), 0.5f, 0.05f);
+			}
+
+			DoNotOptimize(sum);
+		}
+
+		state.SetItemsPerIteration(GridSize * GridSize);
+	}
+}
+
+BENCHMARK_CASE("Noise/Perlin 2D")
+{
+	SampleGrid2D(state, Nz::Perlin(42));
+}
+
+BENCHMARK_CASE("Noise/Perlin 3D")
+{
+	SampleGrid3D(state, Nz::Perlin(42));
+}
+
+BENCHMARK_CASE("Noise/Simplex 2D")
+{
+	SampleGrid2D(state, Nz::Simplex(42));
+}
+
+BENCHMARK_CASE("Noise/Simplex 3D")
+{
+	SampleGrid3D(state, Nz::Simplex(42));
+}
@@ -0,0 +1,46 @@
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <vector>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t PixelCount = 256 * 256;
+
+	void ConvertPixels(BenchmarkState& state, Nz::PixelFormatType srcFormat, Nz::PixelFormatType dstFormat)
+	{
+		std::size_t srcSize = Nz::PixelFormat::GetBytesPerPixel(srcFormat) * PixelCount;
+
+		std::vector<Nz::UInt8> src(srcSize);
+		for (std::size_t i = 0; i < srcSize; ++i)
+			src[i] = static_cast<Nz::UInt8>(i);
+
+		std::vector<Nz::UInt8> dst(Nz::PixelFormat::GetBytesPerPixel(dstFormat) * PixelCount);
+		while (state.KeepRunning())
+		{
+			if (!Nz::PixelFormat::Convert(srcFormat, dstFormat, src.data(), src.data() + srcSize, dst.data()))
+			{
+				state.SkipWithError("Conversion failed");
+				break;
+			}
+
+			DoNotOptimize(dst.data());
+		}
+
+		state.SetBytesPerIteration(srcSize);
+	}
+}
+
+BENCHMARK_CASE("PixelFormat/Convert BGR8 to RGBA8")
+{
+	ConvertPixels(state, Nz::PixelFormatType_BGR8, Nz::PixelFormatType_RGBA8);
+}
+
+BENCHMARK_CASE("PixelFormat/Convert RGBA8 to L8")
+{
+	ConvertPixels(state, Nz::PixelFormatType_RGBA8, Nz::PixelFormatType_L8);
+}
+
+BENCHMARK_CASE("PixelFormat/Convert RGBA8 to RGB8")
+{
+	ConvertPixels(state, Nz::PixelFormatType_RGBA8, Nz::PixelFormatType_RGB8);
+}
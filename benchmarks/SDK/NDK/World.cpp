@@ -0,0 +1,93 @@
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/Systems/VelocitySystem.hpp>
+#include <Benchmark.hpp>
+
+namespace
+{
+	void CreateMovingEntities(Ndk::World& world, std::size_t entityCount)
+	{
+		for (std::size_t i = 0; i < entityCount; ++i)
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			entity->AddComponent<Ndk::NodeComponent>();
+			entity->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::Unit());
+		}
+	}
+
+	void UpdateWorld(BenchmarkState& state, std::size_t entityCount)
+	{
+		Ndk::World world(false);
+		world.AddSystem<Ndk::VelocitySystem>();
+
+		CreateMovingEntities(world, entityCount);
+		world.Update(0.f); //< Refresh entities before measuring
+
+		while (state.KeepRunning())
+			world.Update(1.f / 60.f);
+
+		state.SetItemsPerIteration(entityCount);
+	}
+}
+
+BENCHMARK_CASE("World/CreateEntities (1000)")
+{
+	while (state.KeepRunning())
+	{
+		state.PauseTiming();
+		{
+			Ndk::World world(false);
+			world.AddSystem<Ndk::VelocitySystem>();
+			state.ResumeTiming();
+
+			CreateMovingEntities(world, 1000);
+			world.Update(0.f);
+
+			state.PauseTiming();
+		}
+		state.ResumeTiming();
+	}
+
+	state.SetItemsPerIteration(1000);
+}
+
+BENCHMARK_CASE("World/CreateEntities from prefab (1000)")
+{
+	Ndk::EntityPrefab prefab;
+	prefab.AddComponent<Ndk::NodeComponent>();
+	prefab.AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::Unit());
+
+	while (state.KeepRunning())
+	{
+		state.PauseTiming();
+		{
+			Ndk::World world(false);
+			world.AddSystem<Ndk::VelocitySystem>();
+			state.ResumeTiming();
+
+			world.CreateEntities(prefab, 1000);
+			world.Update(0.f);
+
+			state.PauseTiming();
+		}
+		state.ResumeTiming();
+	}
+
+	state.SetItemsPerIteration(1000);
+}
+
+BENCHMARK_CASE("World/Update (1000 entities)")
+{
+	UpdateWorld(state, 1000);
+}
+
+BENCHMARK_CASE("World/Update (10000 entities)")
+{
+	UpdateWorld(state, 10000);
+}
+
+BENCHMARK_CASE("World/Update (100000 entities)")
+{
+	UpdateWorld(state, 100000);
+}
@@ -0,0 +1,385 @@
+#include "Benchmark.hpp"
+#include <NDK/Application.hpp>
+#include <Nazara/Core/Log.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <Nazara/Noise/Noise.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+	std::atomic<Nz::UInt64> s_allocationCount(0);
+
+	struct Options
+	{
+		std::string filter;
+		std::string jsonPath;
+		double minTime = 0.1;
+		unsigned int sampleCount = 5;
+		bool listOnly = false;
+	};
+
+	struct Result
+	{
+		std::string error;
+		const char* name;
+		Nz::UInt64 iterationCount = 0;
+		double allocationsPerIteration = 0.0;
+		double allocationsPerSecond = 0.0;
+		double bytesPerSecond = 0.0;
+		double itemsPerSecond = 0.0;
+		double maxTime = 0.0; //< Nanoseconds per iteration
+		double meanTime = 0.0;
+		double medianTime = 0.0;
+		double minTime = 0.0;
+		double standardDeviation = 0.0;
+	};
+
+	void PrintUsage(const char* executable)
+	{
+		std::cout << "Usage: " << executable << " [options]\n"
+		             "  --filter <text>    Only run benchmarks whose name contains <text>\n"
+		             "  --json <path>      Write the results to <path>, in JSON\n"
+		             "  --list             List benchmarks without running them\n"
+		             "  --min-time <s>     Minimal duration of a sample, in seconds (default: 0.1)\n"
+		             "  --samples <count>  Number of samples per benchmark (default: 5)\n";
+	}
+
+	bool ParseOptions(int argc, char* argv[], Options* options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			auto NextArgument = [&]() -> const char*
+			{
+				if (i + 1 >= argc)
+				{
+					std::cerr << "Missing value for " << argv[i] << std::endl;
+					return nullptr;
+				}
+
+				return argv[++i];
+			};
+
+			const char* value;
+			if (std::strcmp(argv[i], "--filter") == 0)
+			{
+				if (!(value = NextArgument()))
+					return false;
+
+				options->filter = value;
+			}
+			else if (std::strcmp(argv[i], "--json") == 0)
+			{
+				if (!(value = NextArgument()))
+					return false;
+
+				options->jsonPath = value;
+			}
+			else if (std::strcmp(argv[i], "--list") == 0)
+				options->listOnly = true;
+			else if (std::strcmp(argv[i], "--min-time") == 0)
+			{
+				if (!(value = NextArgument()))
+					return false;
+
+				options->minTime = std::max(std::atof(value), 0.001);
+			}
+			else if (std::strcmp(argv[i], "--samples") == 0)
+			{
+				if (!(value = NextArgument()))
+					return false;
+
+				options->sampleCount = std::max(std::atoi(value), 1);
+			}
+			else
+			{
+				PrintUsage(argv[0]);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	Result RunBenchmark(const BenchmarkRegistrar::Entry& benchmark, const Options& options)
+	{
+		Result result;
+		result.name = benchmark.name;
+
+		// Find an iteration count for which a sample lasts at least the minimal time
+		Nz::UInt64 iterationCount = 1;
+		for (;;)
+		{
+			BenchmarkState state(iterationCount);
+			benchmark.function(state);
+
+			if (!state.GetError().empty())
+			{
+				result.error = state.GetError();
+				return result;
+			}
+
+			double seconds = state.GetElapsedTime().count() / 1e9;
+			if (seconds >= options.minTime || iterationCount >= 1000000000ULL)
+				break;
+
+			double multiplier = (seconds > 0.0) ? std::min(std::max(options.minTime * 1.2 / seconds, 2.0), 10.0) : 10.0;
+			iterationCount = static_cast<Nz::UInt64>(iterationCount * multiplier);
+		}
+
+		Nz::UInt64 allocationCount = 0;
+		std::vector<double> samples;
+		for (unsigned int i = 0; i < options.sampleCount; ++i)
+		{
+			BenchmarkState state(iterationCount);
+			benchmark.function(state);
+
+			if (!state.GetError().empty())
+			{
+				result.error = state.GetError();
+				return result;
+			}
+
+			samples.push_back(static_cast<double>(state.GetElapsedTime().count()) / iterationCount);
+			allocationCount += state.GetAllocationCount();
+
+			result.bytesPerSecond = static_cast<double>(state.GetBytesPerIteration());
+			result.itemsPerSecond = static_cast<double>(state.GetItemsPerIteration());
+		}
+
+		std::sort(samples.begin(), samples.end());
+
+		double sum = 0.0;
+		for (double sample : samples)
+			sum += sample;
+
+		double variance = 0.0;
+		double mean = sum / samples.size();
+		for (double sample : samples)
+			variance += (sample - mean) * (sample - mean);
+
+		result.allocationsPerIteration = static_cast<double>(allocationCount) / (iterationCount * samples.size());
+		result.iterationCount = iterationCount;
+		result.maxTime = samples.back();
+		result.meanTime = mean;
+		result.medianTime = (samples.size() % 2 == 0) ? (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2.0 : samples[samples.size() / 2];
+		result.minTime = samples.front();
+		result.standardDeviation = std::sqrt(variance / samples.size());
+
+		// Throughputs are based on the median
+		result.allocationsPerSecond = result.allocationsPerIteration * 1e9 / result.medianTime;
+		result.bytesPerSecond *= 1e9 / result.medianTime;
+		result.itemsPerSecond *= 1e9 / result.medianTime;
+
+		return result;
+	}
+
+	std::string FormatDuration(double nanoseconds)
+	{
+		const char* unit = "ns";
+		if (nanoseconds >= 1e9)
+		{
+			nanoseconds /= 1e9;
+			unit = "s";
+		}
+		else if (nanoseconds >= 1e6)
+		{
+			nanoseconds /= 1e6;
+			unit = "ms";
+		}
+		else if (nanoseconds >= 1e3)
+		{
+			nanoseconds /= 1e3;
+			unit = "us";
+		}
+
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.2f %s", nanoseconds, unit);
+
+		return buffer;
+	}
+
+	std::string FormatRate(double rate, const char* unit)
+	{
+		const char* prefix = "";
+		if (rate >= 1e9)
+		{
+			rate /= 1e9;
+			prefix = "G";
+		}
+		else if (rate >= 1e6)
+		{
+			rate /= 1e6;
+			prefix = "M";
+		}
+		else if (rate >= 1e3)
+		{
+			rate /= 1e3;
+			prefix = "k";
+		}
+
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.2f %s%s/s", rate, prefix, unit);
+
+		return buffer;
+	}
+
+	void PrintResult(const Result& result)
+	{
+		char line[256];
+		if (!result.error.empty())
+			std::snprintf(line, sizeof(line), "%-48s FAILED: %s", result.name, result.error.c_str());
+		else
+		{
+			std::string throughput;
+			if (result.bytesPerSecond > 0.0)
+				throughput = FormatRate(result.bytesPerSecond, "B");
+			else if (result.itemsPerSecond > 0.0)
+				throughput = FormatRate(result.itemsPerSecond, "items");
+
+			std::string allocations;
+			if (result.allocationsPerSecond > 0.0)
+				allocations = FormatRate(result.allocationsPerSecond, "allocs");
+
+			std::snprintf(line, sizeof(line), "%-48s %12s +- %-10s %12llu it  %-16s %s", result.name, FormatDuration(result.medianTime).c_str(), FormatDuration(result.standardDeviation).c_str(), static_cast<unsigned long long>(result.iterationCount), throughput.c_str(), allocations.c_str());
+		}
+
+		std::cout << line << std::endl;
+	}
+
+	std::string EscapeJson(const std::string& str)
+	{
+		std::string escaped;
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+
+			escaped += c;
+		}
+
+		return escaped;
+	}
+
+	bool WriteJson(const std::string& path, const std::vector<Result>& results)
+	{
+		std::ofstream file(path, std::ios::out | std::ios::trunc);
+		if (!file)
+			return false;
+
+		#ifdef NAZARA_DEBUG
+		const char* build = "debug";
+		#else
+		const char* build = "release";
+		#endif
+
+		file << "{\n\t\"build\": \"" << build << "\",\n\t\"benchmarks\": [";
+		for (std::size_t i = 0; i < results.size(); ++i)
+		{
+			const Result& result = results[i];
+
+			file << ((i > 0) ? ",\n" : "\n") << "\t\t{\"name\": \"" << EscapeJson(result.name) << '"';
+			if (!result.error.empty())
+				file << ", \"error\": \"" << EscapeJson(result.error) << '"';
+			else
+			{
+				file << ", \"iterations\": " << result.iterationCount
+				     << ", \"median_ns\": " << result.medianTime
+				     << ", \"mean_ns\": " << result.meanTime
+				     << ", \"min_ns\": " << result.minTime
+				     << ", \"max_ns\": " << result.maxTime
+				     << ", \"stddev_ns\": " << result.standardDeviation
+				     << ", \"bytes_per_second\": " << result.bytesPerSecond
+				     << ", \"items_per_second\": " << result.itemsPerSecond
+				     << ", \"allocations_per_iteration\": " << result.allocationsPerIteration
+				     << ", \"allocations_per_second\": " << result.allocationsPerSecond;
+			}
+			file << '}';
+		}
+		file << "\n\t]\n}\n";
+
+		return file.good();
+	}
+}
+
+Nz::UInt64 GetGlobalAllocationCount()
+{
+	return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+// Allocations are counted to report how many of them happen in the measured loops
+void* operator new(std::size_t size)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* ptr = std::malloc((size > 0) ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+// Sized deallocation (C++14) would otherwise reach the default operator, which may not forward to ours
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+	std::free(ptr);
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, &options))
+		return EXIT_FAILURE;
+
+	Ndk::Application application(argc, argv);
+	Nz::Initializer<Nz::Network, Nz::Noise> modules;
+
+	Nz::Log::GetLogger()->EnableStdReplication(false);
+
+	std::vector<BenchmarkRegistrar::Entry> benchmarks = BenchmarkRegistrar::GetBenchmarks();
+	std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkRegistrar::Entry& lhs, const BenchmarkRegistrar::Entry& rhs)
+	{
+		return std::strcmp(lhs.name, rhs.name) < 0;
+	});
+
+	std::vector<Result> results;
+	bool failed = false;
+	for (const BenchmarkRegistrar::Entry& benchmark : benchmarks)
+	{
+		if (!options.filter.empty() && std::strstr(benchmark.name, options.filter.c_str()) == nullptr)
+			continue;
+
+		if (options.listOnly)
+		{
+			std::cout << benchmark.name << std::endl;
+			continue;
+		}
+
+		results.push_back(RunBenchmark(benchmark, options));
+		PrintResult(results.back());
+
+		if (!results.back().error.empty())
+			failed = true;
+	}
+
+	if (!options.jsonPath.empty() && !WriteJson(options.jsonPath, results))
+	{
+		std::cerr << "Failed to write " << options.jsonPath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return (failed) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,30 @@
+TOOL.Name = "Benchmarks"
+
+TOOL.Directory = "../benchmarks"
+TOOL.EnableConsole = true
+TOOL.Kind = "Application"
+TOOL.TargetDirectory = TOOL.Directory
+
+TOOL.Defines = {
+}
+
+TOOL.Includes = {
+	"../benchmarks",
+	"../include"
+}
+
+TOOL.Files = {
+	"../benchmarks/main.cpp",
+	"../benchmarks/Benchmark.hpp",
+	"../benchmarks/Benchmark.inl",
+	"../benchmarks/Engine/**.hpp",
+	"../benchmarks/Engine/**.cpp",
+	"../benchmarks/SDK/**.hpp",
+	"../benchmarks/SDK/**.cpp"
+}
+
+TOOL.Libraries = {
+	"NazaraNetwork",
+	"NazaraNoise",
+	"NazaraSDK"
+}
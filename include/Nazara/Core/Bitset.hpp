@@ -45,6 +45,7 @@ namespace Nz
 
 			std::size_t FindFirst() const;
 			std::size_t FindNext(std::size_t bit) const;
+			template<typename F> void ForEachSetBit(F&& callback) const;
 
 			Block GetBlock(std::size_t i) const;
 			std::size_t GetBlockCount() const;
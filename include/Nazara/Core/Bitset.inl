@@ -5,8 +5,21 @@
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
 #include <cstdlib>
 #include <utility>
+
+// SIMD paths are selected at compile-time: SSE2 is always available on x64, AVX2 requires the code to be built for it (-mavx2, /arch:AVX2)
+#if defined(__AVX2__)
+	#define NAZARA_BITSET_AVX2
+	#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_BITSET_SSE2
+	#include <emmintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 #ifdef NAZARA_COMPILER_MSVC
@@ -17,6 +30,240 @@
 
 namespace Nz
 {
+	namespace Detail
+	{
+		// Bulk operations working on whole block arrays, as they only rely on bitwise operations they can process a full SIMD register at once whatever the block type is
+
+		struct BitsetAndOp
+		{
+			template<typename T> T operator()(T a, T b) const { return a & b; }
+
+			#ifdef NAZARA_BITSET_SSE2
+			__m128i operator()(__m128i a, __m128i b) const { return _mm_and_si128(a, b); }
+			#endif
+
+			#ifdef NAZARA_BITSET_AVX2
+			__m256i operator()(__m256i a, __m256i b) const { return _mm256_and_si256(a, b); }
+			#endif
+		};
+
+		struct BitsetOrOp
+		{
+			template<typename T> T operator()(T a, T b) const { return a | b; }
+
+			#ifdef NAZARA_BITSET_SSE2
+			__m128i operator()(__m128i a, __m128i b) const { return _mm_or_si128(a, b); }
+			#endif
+
+			#ifdef NAZARA_BITSET_AVX2
+			__m256i operator()(__m256i a, __m256i b) const { return _mm256_or_si256(a, b); }
+			#endif
+		};
+
+		struct BitsetXorOp
+		{
+			template<typename T> T operator()(T a, T b) const { return a ^ b; }
+
+			#ifdef NAZARA_BITSET_SSE2
+			__m128i operator()(__m128i a, __m128i b) const { return _mm_xor_si128(a, b); }
+			#endif
+
+			#ifdef NAZARA_BITSET_AVX2
+			__m256i operator()(__m256i a, __m256i b) const { return _mm256_xor_si256(a, b); }
+			#endif
+		};
+
+		template<typename Block, typename Op>
+		void BitsetTransform(Block* result, const Block* a, const Block* b, std::size_t blockCount, Op op)
+		{
+			// result may be a or b, which is fine as every register is loaded before being stored
+			std::size_t i = 0;
+
+			#ifdef NAZARA_BITSET_AVX2
+			constexpr std::size_t avxBlockCount = sizeof(__m256i) / sizeof(Block);
+			for (; i + avxBlockCount <= blockCount; i += avxBlockCount)
+			{
+				__m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&a[i]));
+				__m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&b[i]));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(&result[i]), op(first, second));
+			}
+			#endif
+
+			#ifdef NAZARA_BITSET_SSE2
+			constexpr std::size_t sseBlockCount = sizeof(__m128i) / sizeof(Block);
+			for (; i + sseBlockCount <= blockCount; i += sseBlockCount)
+			{
+				__m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&a[i]));
+				__m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&b[i]));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&result[i]), op(first, second));
+			}
+			#endif
+
+			for (; i < blockCount; ++i)
+				result[i] = op(a[i], b[i]);
+		}
+
+		template<typename Block>
+		std::size_t BitsetCount(const Block* blocks, std::size_t blockCount)
+		{
+			std::size_t count = 0;
+			std::size_t i = 0;
+
+			#ifdef NAZARA_BITSET_AVX2
+			{
+				// Count bits of each nibble using a lookup table, then sum bytes (http://0x80.pl/articles/sse-popcount.html)
+				const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+				                                        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+				const __m256i lowMask = _mm256_set1_epi8(0x0F);
+
+				constexpr std::size_t avxBlockCount = sizeof(__m256i) / sizeof(Block);
+				__m256i sums = _mm256_setzero_si256();
+				for (; i + avxBlockCount <= blockCount; i += avxBlockCount)
+				{
+					__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&blocks[i]));
+					__m256i lowCount = _mm256_shuffle_epi8(lookup, _mm256_and_si256(value, lowMask));
+					__m256i highCount = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(value, 4), lowMask));
+
+					sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_add_epi8(lowCount, highCount), _mm256_setzero_si256()));
+				}
+
+				alignas(32) UInt64 partialSums[4];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(partialSums), sums);
+
+				count += static_cast<std::size_t>(partialSums[0] + partialSums[1] + partialSums[2] + partialSums[3]);
+			}
+			#endif
+
+			#ifdef NAZARA_BITSET_SSE2
+			{
+				// Parallel bit count of each byte, then sum bytes (https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel)
+				const __m128i mask1 = _mm_set1_epi8(0x55);
+				const __m128i mask2 = _mm_set1_epi8(0x33);
+				const __m128i mask4 = _mm_set1_epi8(0x0F);
+
+				constexpr std::size_t sseBlockCount = sizeof(__m128i) / sizeof(Block);
+				__m128i sums = _mm_setzero_si128();
+				for (; i + sseBlockCount <= blockCount; i += sseBlockCount)
+				{
+					__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&blocks[i]));
+					value = _mm_sub_epi8(value, _mm_and_si128(_mm_srli_epi64(value, 1), mask1));
+					value = _mm_add_epi8(_mm_and_si128(value, mask2), _mm_and_si128(_mm_srli_epi64(value, 2), mask2));
+					value = _mm_and_si128(_mm_add_epi8(value, _mm_srli_epi64(value, 4)), mask4);
+
+					sums = _mm_add_epi64(sums, _mm_sad_epu8(value, _mm_setzero_si128()));
+				}
+
+				alignas(16) UInt64 partialSums[2];
+				_mm_store_si128(reinterpret_cast<__m128i*>(partialSums), sums);
+
+				count += static_cast<std::size_t>(partialSums[0] + partialSums[1]);
+			}
+			#endif
+
+			for (; i < blockCount; ++i)
+				count += CountBits(blocks[i]);
+
+			return count;
+		}
+
+		template<typename Block>
+		bool BitsetIntersects(const Block* a, const Block* b, std::size_t blockCount)
+		{
+			std::size_t i = 0;
+
+			#ifdef NAZARA_BITSET_AVX2
+			constexpr std::size_t avxBlockCount = sizeof(__m256i) / sizeof(Block);
+			for (; i + avxBlockCount <= blockCount; i += avxBlockCount)
+			{
+				__m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&a[i]));
+				__m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&b[i]));
+				if (!_mm256_testz_si256(first, second))
+					return true;
+			}
+			#endif
+
+			#ifdef NAZARA_BITSET_SSE2
+			constexpr std::size_t sseBlockCount = sizeof(__m128i) / sizeof(Block);
+			for (; i + sseBlockCount <= blockCount; i += sseBlockCount)
+			{
+				__m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&a[i]));
+				__m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&b[i]));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(first, second), _mm_setzero_si128())) != 0xFFFF)
+					return true;
+			}
+			#endif
+
+			for (; i < blockCount; ++i)
+			{
+				if (a[i] & b[i])
+					return true;
+			}
+
+			return false;
+		}
+
+		template<typename Block>
+		void BitsetNot(Block* result, const Block* blocks, std::size_t blockCount)
+		{
+			std::size_t i = 0;
+
+			#ifdef NAZARA_BITSET_AVX2
+			constexpr std::size_t avxBlockCount = sizeof(__m256i) / sizeof(Block);
+			for (; i + avxBlockCount <= blockCount; i += avxBlockCount)
+			{
+				__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&blocks[i]));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(&result[i]), _mm256_xor_si256(value, _mm256_set1_epi8(-1)));
+			}
+			#endif
+
+			#ifdef NAZARA_BITSET_SSE2
+			constexpr std::size_t sseBlockCount = sizeof(__m128i) / sizeof(Block);
+			for (; i + sseBlockCount <= blockCount; i += sseBlockCount)
+			{
+				__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&blocks[i]));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&result[i]), _mm_xor_si128(value, _mm_set1_epi8(-1)));
+			}
+			#endif
+
+			for (; i < blockCount; ++i)
+				result[i] = ~blocks[i];
+		}
+
+		template<typename Block>
+		bool BitsetTestAny(const Block* blocks, std::size_t blockCount)
+		{
+			std::size_t i = 0;
+
+			#ifdef NAZARA_BITSET_AVX2
+			constexpr std::size_t avxBlockCount = sizeof(__m256i) / sizeof(Block);
+			for (; i + avxBlockCount <= blockCount; i += avxBlockCount)
+			{
+				__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&blocks[i]));
+				if (!_mm256_testz_si256(value, value))
+					return true;
+			}
+			#endif
+
+			#ifdef NAZARA_BITSET_SSE2
+			constexpr std::size_t sseBlockCount = sizeof(__m128i) / sizeof(Block);
+			for (; i + sseBlockCount <= blockCount; i += sseBlockCount)
+			{
+				__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&blocks[i]));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(value, _mm_setzero_si128())) != 0xFFFF)
+					return true;
+			}
+			#endif
+
+			for (; i < blockCount; ++i)
+			{
+				if (blocks[i])
+					return true;
+			}
+
+			return false;
+		}
+	}
+
 	/*!
 	* \ingroup core
 	* \class Nz::Bitset
@@ -208,14 +455,7 @@ namespace Nz
 	template<typename Block, class Allocator>
 	std::size_t Bitset<Block, Allocator>::Count() const
 	{
-		if (m_blocks.empty())
-			return 0;
-
-		std::size_t count = 0;
-		for (std::size_t i = 0; i < m_blocks.size(); ++i)
-			count += CountBits(m_blocks[i]);
-
-		return count;
+		return Detail::BitsetCount(m_blocks.data(), m_blocks.size());
 	}
 
 	/*!
@@ -226,8 +466,7 @@ namespace Nz
 	template<typename Block, class Allocator>
 	void Bitset<Block, Allocator>::Flip()
 	{
-		for (Block& block : m_blocks)
-			block ^= fullBitMask;
+		Detail::BitsetNot(m_blocks.data(), m_blocks.data(), m_blocks.size());
 
 		ResetExtraBits();
 	}
@@ -277,6 +516,42 @@ namespace Nz
 			return FindFirstFrom(blockIndex + 1);
 	}
 
+	/*!
+	* \brief Calls a function for every enabled bit of the bitset, in increasing order
+	*
+	* \param callback Function called with the index of each enabled bit
+	*
+	* This is equivalent to a FindFirst/FindNext loop, but works a block at a time instead of searching the next bit from its index.
+	* As with FindNext, bits set or reset by the callback after the current one are taken into account.
+	*
+	* \remark The callback must not shrink the bitset
+	*/
+	template<typename Block, class Allocator>
+	template<typename F>
+	void Bitset<Block, Allocator>::ForEachSetBit(F&& callback) const
+	{
+		for (std::size_t i = 0; i < m_blocks.size(); ++i)
+		{
+			Block blockValue = m_blocks[i];
+			Block block = blockValue;
+			while (block)
+			{
+				unsigned int bitIndex = IntegralLog2Pot(block & -block);
+				callback(i * bitsPerBlock + bitIndex);
+
+				Block newBlockValue = m_blocks[i];
+				if (newBlockValue == blockValue)
+					block &= block - 1; //< Clear the bit we just went through
+				else
+				{
+					// The callback changed the block, take it into account while ignoring the bits we already went through
+					block = newBlockValue & static_cast<Block>((fullBitMask << bitIndex) << 1U);
+					blockValue = newBlockValue;
+				}
+			}
+		}
+	}
+
 	/*!
 	* \brief Gets the ith block
 	* \return Block in the bitset
@@ -415,12 +690,10 @@ namespace Nz
 		m_bitCount = std::max(a.GetSize(), b.GetSize());
 
 		// In case of the "AND", we can stop with the smallest size (because x & 0 = 0)
-		for (std::size_t i = 0; i < minmax.first; ++i)
-			m_blocks[i] = a.GetBlock(i) & b.GetBlock(i);
+		Detail::BitsetTransform(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minmax.first, Detail::BitsetAndOp());
 
 		// And then reset every other block to zero
-		for (std::size_t i = minmax.first; i < minmax.second; ++i)
-			m_blocks[i] = 0U;
+		std::fill(m_blocks.begin() + minmax.first, m_blocks.end(), Block(0U));
 
 		ResetExtraBits();
 	}
@@ -437,8 +710,7 @@ namespace Nz
 		m_blocks.resize(a.GetBlockCount());
 		m_bitCount = a.GetSize();
 
-		for (std::size_t i = 0; i < m_blocks.size(); ++i)
-			m_blocks[i] = ~a.GetBlock(i);
+		Detail::BitsetNot(m_blocks.data(), a.m_blocks.data(), m_blocks.size());
 
 		ResetExtraBits();
 	}
@@ -463,11 +735,11 @@ namespace Nz
 		m_blocks.resize(maxBlockCount);
 		m_bitCount = greater.GetSize();
 
-		for (std::size_t i = 0; i < minBlockCount; ++i)
-			m_blocks[i] = a.GetBlock(i) | b.GetBlock(i);
+		Detail::BitsetTransform(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minBlockCount, Detail::BitsetOrOp());
 
-		for (std::size_t i = minBlockCount; i < maxBlockCount; ++i)
-			m_blocks[i] = greater.GetBlock(i); // (x | 0 = x)
+		// (x | 0 = x)
+		if (&greater != this)
+			std::copy(greater.m_blocks.begin() + minBlockCount, greater.m_blocks.end(), m_blocks.begin() + minBlockCount);
 
 		ResetExtraBits();
 	}
@@ -492,11 +764,11 @@ namespace Nz
 		m_blocks.resize(maxBlockCount);
 		m_bitCount = greater.GetSize();
 
-		for (std::size_t i = 0; i < minBlockCount; ++i)
-			m_blocks[i] = a.GetBlock(i) ^ b.GetBlock(i);
+		Detail::BitsetTransform(m_blocks.data(), a.m_blocks.data(), b.m_blocks.data(), minBlockCount, Detail::BitsetXorOp());
 
-		for (std::size_t i = minBlockCount; i < maxBlockCount; ++i)
-			m_blocks[i] = greater.GetBlock(i); // (x ^ 0 = x)
+		// (x ^ 0 = x)
+		if (&greater != this)
+			std::copy(greater.m_blocks.begin() + minBlockCount, greater.m_blocks.end(), m_blocks.begin() + minBlockCount);
 
 		ResetExtraBits();
 	}
@@ -512,15 +784,8 @@ namespace Nz
 	{
 		// We only test the blocks in common
 		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
-		for (std::size_t i = 0; i < sharedBlocks; ++i)
-		{
-			Block a = GetBlock(i);
-			Block b = bitset.GetBlock(i);
-			if (a & b)
-				return true;
-		}
 
-		return false;
+		return Detail::BitsetIntersects(m_blocks.data(), bitset.m_blocks.data(), sharedBlocks);
 	}
 
 	/*!
@@ -830,16 +1095,7 @@ namespace Nz
 	template<typename Block, class Allocator>
 	bool Bitset<Block, Allocator>::TestAny() const
 	{
-		if (m_blocks.empty())
-			return false;
-
-		for (std::size_t i = 0; i < m_blocks.size(); ++i)
-		{
-			if (m_blocks[i])
-				return true;
-		}
-
-		return false;
+		return Detail::BitsetTestAny(m_blocks.data(), m_blocks.size());
 	}
 
 	/*!
@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CONCURRENTMEMORYPOOL_HPP
+#define NAZARA_CONCURRENTMEMORYPOOL_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <memory>
+
+namespace Nz
+{
+	class ConcurrentMemoryPoolImpl;
+
+	class NAZARA_CORE_API ConcurrentMemoryPool
+	{
+		public:
+			ConcurrentMemoryPool(unsigned int blockSize, unsigned int blocksPerChunk = 1024);
+			ConcurrentMemoryPool(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool(ConcurrentMemoryPool&&) noexcept = default;
+			~ConcurrentMemoryPool() = default;
+
+			void* Allocate();
+
+			template<typename T> void Delete(T* ptr);
+
+			void Free(void* ptr);
+
+			unsigned int GetBlockSize() const;
+			unsigned int GetBlocksPerChunk() const;
+			std::size_t GetChunkCount() const;
+
+			bool IsOwnerOf(const void* ptr) const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+
+			ConcurrentMemoryPool& operator=(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool& operator=(ConcurrentMemoryPool&&) noexcept = default;
+
+		private:
+			std::shared_ptr<ConcurrentMemoryPoolImpl> m_impl;
+	};
+}
+
+#include <Nazara/Core/ConcurrentMemoryPool.inl>
+
+#endif // NAZARA_CONCURRENTMEMORYPOOL_HPP
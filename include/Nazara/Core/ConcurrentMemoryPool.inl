@@ -0,0 +1,50 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Destroys the object and releases its block
+	*
+	* \param ptr Pointer to an object created by New
+	*
+	* \remark If ptr is null, nothing is done
+	*/
+	template<typename T>
+	void ConcurrentMemoryPool::Delete(T* ptr)
+	{
+		if (ptr)
+		{
+			PlacementDestroy(ptr);
+			Free(ptr);
+		}
+	}
+
+	/*!
+	* \brief Creates a new object of type T in a block of the pool
+	* \return Pointer to the constructed object
+	*
+	* \param args Arguments for the new object
+	*
+	* \remark sizeof(T) must not exceed the block size
+	*/
+	template<typename T, typename... Args>
+	T* ConcurrentMemoryPool::New(Args&&... args)
+	{
+		NazaraAssert(sizeof(T) <= GetBlockSize(), "Type is too big for this pool");
+
+		T* object = static_cast<T*>(Allocate());
+		PlacementNew(object, std::forward<Args>(args)...);
+
+		return object;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
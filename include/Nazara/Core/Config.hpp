@@ -55,6 +55,9 @@
 // Use the MemoryManager to manage dynamic allocations (can detect memory leak but allocations/frees are slower)
 #define NAZARA_CORE_MANAGE_MEMORY 0
 
+// Compile the profiler zones (NazaraProfileZone), which then cost a branch even while the Profiler is disabled
+#define NAZARA_CORE_PROFILER 0
+
 // Activate the security tests based on the code (Advised for development)
 #define NAZARA_CORE_SAFE 1
 
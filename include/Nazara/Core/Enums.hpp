@@ -71,8 +71,9 @@ namespace Nz
 		HashType_SHA384,
 		HashType_SHA512,
 		HashType_Whirlpool,
+		HashType_CRC32C,
 
-		HashType_Max = HashType_Whirlpool
+		HashType_Max = HashType_CRC32C
 	};
 
 	enum OpenMode
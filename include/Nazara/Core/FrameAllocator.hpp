@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FRAMEALLOCATOR_HPP
+#define NAZARA_FRAMEALLOCATOR_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <vector>
+
+namespace Nz
+{
+	template<typename T>
+	class FrameAllocator
+	{
+		template<typename U> friend class FrameAllocator;
+
+		public:
+			using value_type = T;
+
+			FrameAllocator(FrameArena& arena);
+			template<typename U> FrameAllocator(const FrameAllocator<U>& allocator);
+			FrameAllocator(const FrameAllocator&) = default;
+			~FrameAllocator() = default;
+
+			T* allocate(std::size_t n);
+
+			void deallocate(T* ptr, std::size_t n);
+
+			FrameArena& GetArena() const;
+
+			FrameAllocator& operator=(const FrameAllocator&) = default;
+
+			template<typename U> bool operator==(const FrameAllocator<U>& allocator) const;
+			template<typename U> bool operator!=(const FrameAllocator<U>& allocator) const;
+
+		private:
+			FrameArena* m_arena;
+	};
+
+	template<typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
+
+#include <Nazara/Core/FrameAllocator.inl>
+
+#endif // NAZARA_FRAMEALLOCATOR_HPP
@@ -0,0 +1,99 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FrameAllocator.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::FrameAllocator
+	* \brief Core class adapting a FrameArena to the standard Allocator requirements
+	*
+	* This allows standard containers to take their memory from a FrameArena, for example `FrameVector<T> vec(arena);`.
+	* Deallocation does nothing, memory is reclaimed when the arena is reset: such containers must not outlive the frame.
+	*/
+
+	/*!
+	* \brief Constructs a FrameAllocator object
+	*
+	* \param arena Arena to take the memory from, which must outlive the allocator and its copies
+	*/
+	template<typename T>
+	FrameAllocator<T>::FrameAllocator(FrameArena& arena) :
+	m_arena(&arena)
+	{
+	}
+
+	/*!
+	* \brief Constructs a FrameAllocator object from an allocator of another type
+	*
+	* \param allocator Allocator to take the arena from
+	*/
+	template<typename T>
+	template<typename U>
+	FrameAllocator<T>::FrameAllocator(const FrameAllocator<U>& allocator) :
+	m_arena(allocator.m_arena)
+	{
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory for n objects
+	* \return Pointer to the memory
+	*
+	* \param n Number of objects
+	*/
+	template<typename T>
+	T* FrameAllocator<T>::allocate(std::size_t n)
+	{
+		return m_arena->AllocateArray<T>(n);
+	}
+
+	/*!
+	* \brief Does nothing, memory is reclaimed by FrameArena::Reset
+	*/
+	template<typename T>
+	void FrameAllocator<T>::deallocate(T* /*ptr*/, std::size_t /*n*/)
+	{
+	}
+
+	/*!
+	* \brief Gets the arena used by this allocator
+	* \return Reference to the arena
+	*/
+	template<typename T>
+	FrameArena& FrameAllocator<T>::GetArena() const
+	{
+		return *m_arena;
+	}
+
+	/*!
+	* \brief Checks whether two allocators share the same arena
+	* \return true If memory allocated by one can be deallocated by the other
+	*
+	* \param allocator Other allocator
+	*/
+	template<typename T>
+	template<typename U>
+	bool FrameAllocator<T>::operator==(const FrameAllocator<U>& allocator) const
+	{
+		return m_arena == allocator.m_arena;
+	}
+
+	/*!
+	* \brief Checks whether two allocators use different arenas
+	* \return false If memory allocated by one can be deallocated by the other
+	*
+	* \param allocator Other allocator
+	*/
+	template<typename T>
+	template<typename U>
+	bool FrameAllocator<T>::operator!=(const FrameAllocator<U>& allocator) const
+	{
+		return !operator==(allocator);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
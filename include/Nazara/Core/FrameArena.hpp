@@ -0,0 +1,59 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FRAMEARENA_HPP
+#define NAZARA_FRAMEARENA_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API FrameArena
+	{
+		public:
+			FrameArena(std::size_t blockSize = 64 * 1024);
+			FrameArena(const FrameArena&) = delete;
+			FrameArena(FrameArena&& arena) noexcept;
+			~FrameArena() = default;
+
+			inline void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+			template<typename T> T* AllocateArray(std::size_t count);
+
+			inline std::size_t GetBlockSize() const;
+			std::size_t GetCapacity() const;
+			std::size_t GetUsedSize() const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+
+			void Release();
+			inline void Reset();
+
+			FrameArena& operator=(const FrameArena&) = delete;
+			FrameArena& operator=(FrameArena&& arena) noexcept;
+
+		private:
+			void* AllocateSlow(std::size_t size, std::size_t alignment);
+
+			struct Block
+			{
+				std::unique_ptr<UInt8[]> memory;
+				std::size_t size;
+			};
+
+			std::size_t m_blockSize;
+			std::size_t m_currentBlock;
+			std::vector<Block> m_blocks;
+			UInt8* m_cursor;
+			UInt8* m_end;
+	};
+}
+
+#include <Nazara/Core/FrameArena.inl>
+
+#endif // NAZARA_FRAMEARENA_HPP
@@ -0,0 +1,96 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Allocates memory from the arena
+	* \return Pointer to the allocated memory, valid until the next call to Reset or Release, or nullptr if the size is too big to be aligned
+	*
+	* \param size Size to allocate
+	* \param alignment Alignment of the returned pointer, must be a power of two
+	*/
+	inline void* FrameArena::Allocate(std::size_t size, std::size_t alignment)
+	{
+		NazaraAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		std::uintptr_t address = (reinterpret_cast<std::uintptr_t>(m_cursor) + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+		UInt8* ptr = reinterpret_cast<UInt8*>(address);
+		if (m_cursor && ptr <= m_end && size <= static_cast<std::size_t>(m_end - ptr))
+		{
+			m_cursor = ptr + size;
+			return ptr;
+		}
+
+		return AllocateSlow(size, alignment);
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory for an array
+	* \return Pointer to the first element, or nullptr if the size of the array cannot be represented
+	*
+	* \param count Number of elements
+	*/
+	template<typename T>
+	T* FrameArena::AllocateArray(std::size_t count)
+	{
+		if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+		{
+			NazaraError("Array size overflow (" + String::Number(count) + " elements of size " + String::Number(sizeof(T)) + ')');
+			return nullptr;
+		}
+
+		return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	/*!
+	* \brief Gets the default size of the blocks reserved by the arena
+	* \return Block size
+	*/
+	inline std::size_t FrameArena::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Constructs an object in the arena
+	* \return Pointer to the constructed object
+	*
+	* \param args Arguments for the new object
+	*
+	* \remark The destructor of the object will never be called by the arena, this should only be used with trivially destructible types or objects destroyed manually
+	*/
+	template<typename T, typename... Args>
+	T* FrameArena::New(Args&&... args)
+	{
+		return PlacementNew(static_cast<T*>(Allocate(sizeof(T), alignof(T))), std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Makes every allocation of the arena available again, in constant time
+	*
+	* Reserved memory is kept to be reused by the next frame.
+	*
+	* \remark Every pointer returned by the arena gets invalid
+	*/
+	inline void FrameArena::Reset()
+	{
+		m_currentBlock = 0;
+		if (!m_blocks.empty())
+		{
+			m_cursor = m_blocks.front().memory.get();
+			m_end = m_cursor + m_blocks.front().size;
+		}
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,36 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_HASH_CRC32C_HPP
+#define NAZARA_HASH_CRC32C_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API HashCRC32C : public AbstractHash
+	{
+		public:
+			HashCRC32C() = default;
+			~HashCRC32C() = default;
+
+			void Append(const UInt8* data, std::size_t len) override;
+			void Begin() override;
+			ByteArray End() override;
+
+			std::size_t GetDigestLength() const override;
+			const char* GetHashName() const override;
+
+			static UInt32 Compute(const void* data, std::size_t len, UInt32 crc = 0);
+
+		private:
+			UInt32 m_crc;
+	};
+}
+
+#endif // NAZARA_HASH_CRC32C_HPP
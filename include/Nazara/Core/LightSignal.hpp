@@ -0,0 +1,119 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LIGHTSIGNAL_HPP
+#define NAZARA_LIGHTSIGNAL_HPP
+
+#include <Nazara/Core/Signal.hpp>
+#include <cstddef>
+#include <type_traits>
+
+#define NazaraDetailLightSignal(Keyword, SignalName, ...) using SignalName ## Type = Nz::LightSignal<__VA_ARGS__>; \
+                                                          Keyword SignalName ## Type SignalName
+
+#define NazaraLightSignal(SignalName, ...) NazaraDetailLightSignal(mutable, SignalName, __VA_ARGS__)
+#define NazaraStaticLightSignal(SignalName, ...) NazaraDetailLightSignal(static, SignalName, __VA_ARGS__)
+
+namespace Nz
+{
+	template<typename... Args>
+	class LightSignal
+	{
+		public:
+			class ConnectionGuard;
+
+			LightSignal();
+			LightSignal(const LightSignal&) = delete;
+			LightSignal(LightSignal&& signal) noexcept;
+			~LightSignal();
+
+			void Clear() noexcept;
+
+			template<typename F> ConnectionGuard Connect(F&& func);
+			template<typename O> ConnectionGuard Connect(O& object, void (O::*method)(Args...));
+			template<typename O> ConnectionGuard Connect(O* object, void (O::*method)(Args...));
+			template<typename O> ConnectionGuard Connect(const O& object, void (O::*method)(Args...) const);
+			template<typename O> ConnectionGuard Connect(const O* object, void (O::*method)(Args...) const);
+
+			inline bool IsEmpty() const;
+
+			void operator()(Args... args) const;
+
+			LightSignal& operator=(const LightSignal&) = delete;
+			LightSignal& operator=(LightSignal&& signal) noexcept;
+
+			static constexpr std::size_t CallbackStorageSize = 4 * sizeof(void*);
+
+		private:
+			struct Emission
+			{
+				ConnectionGuard* next;
+				Emission* previous;
+			};
+
+			void Link(ConnectionGuard* slot) noexcept;
+			void Replace(ConnectionGuard* slot, ConnectionGuard* newSlot) noexcept;
+			void Unlink(ConnectionGuard* slot) noexcept;
+
+			ConnectionGuard* m_first;
+			ConnectionGuard* m_last;
+			mutable Emission* m_emission;
+	};
+
+	template<typename... Args>
+	class LightSignal<Args...>::ConnectionGuard
+	{
+		using BaseClass = LightSignal<Args...>;
+		friend BaseClass;
+
+		public:
+			ConnectionGuard();
+			ConnectionGuard(const ConnectionGuard&) = delete;
+			ConnectionGuard(ConnectionGuard&& connection) noexcept;
+			~ConnectionGuard();
+
+			template<typename... ConnectArgs>
+			void Connect(BaseClass& signal, ConnectArgs&&... args);
+			void Disconnect() noexcept;
+
+			inline bool IsConnected() const;
+
+			ConnectionGuard& operator=(const ConnectionGuard&) = delete;
+			ConnectionGuard& operator=(ConnectionGuard&& connection) noexcept;
+
+		private:
+			enum class Operation
+			{
+				Destroy,
+				Move
+			};
+
+			using Storage = typename std::aligned_storage<CallbackStorageSize, alignof(std::max_align_t)>::type;
+			using Invoker = void(*)(Storage& storage, Args... args);
+			using Manager = void(*)(Operation operation, Storage& storage, Storage* destination);
+
+			template<typename F> void SetCallback(F&& func);
+			template<typename F> void SetCallback(F&& func, std::false_type /*fitsStorage*/);
+			template<typename F> void SetCallback(F&& func, std::true_type /*fitsStorage*/);
+			void ResetCallback() noexcept;
+
+			template<typename F> static void InvokeHeap(Storage& storage, Args... args);
+			template<typename F> static void InvokeLocal(Storage& storage, Args... args);
+			template<typename F> static void ManageHeap(Operation operation, Storage& storage, Storage* destination);
+			template<typename F> static void ManageLocal(Operation operation, Storage& storage, Storage* destination);
+
+			Storage m_storage;
+			BaseClass* m_signal;
+			ConnectionGuard* m_next;
+			ConnectionGuard* m_previous;
+			Invoker m_invoker;
+			Manager m_manager;
+	};
+}
+
+#include <Nazara/Core/LightSignal.inl>
+
+#endif // NAZARA_LIGHTSIGNAL_HPP
@@ -0,0 +1,576 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LightSignal.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::LightSignal
+	* \brief Core class that represents a lightweight signal, for signals fired very often
+	*
+	* Unlike Signal, listeners are stored in an intrusive list made of their ConnectionGuard, and callbacks small enough (as lambdas capturing a few pointers or member functions) are stored inside of it.
+	* Connecting doesn't allocate and firing the signal only costs an indirect call per listener, with no reference counting involved.
+	*
+	* In exchange, there's no copyable Connection: the ConnectionGuard owns the callback and must stay alive as long as the connection, making it ideal for members declared with NazaraSlot.
+	*
+	* \remark As Signal, this class is not thread-safe
+	* \remark Listeners connected while the signal is fired will be called during the same emission
+	*/
+
+	/*!
+	* \brief Constructs a LightSignal object by default
+	*/
+
+	template<typename... Args>
+	LightSignal<Args...>::LightSignal() :
+	m_first(nullptr),
+	m_last(nullptr),
+	m_emission(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Constructs a LightSignal object by move semantic
+	*
+	* \param signal Signal to move in this
+	*/
+
+	template<typename... Args>
+	LightSignal<Args...>::LightSignal(LightSignal&& signal) noexcept :
+	LightSignal()
+	{
+		operator=(std::move(signal));
+	}
+
+	/*!
+	* \brief Destructs the object and disconnects every listener
+	*/
+
+	template<typename... Args>
+	LightSignal<Args...>::~LightSignal()
+	{
+		Clear();
+	}
+
+	/*!
+	* \brief Disconnects every listener of the signal
+	*
+	* \remark Callbacks are only released with their ConnectionGuard
+	*/
+
+	template<typename... Args>
+	void LightSignal<Args...>::Clear() noexcept
+	{
+		ConnectionGuard* slot = m_first;
+		while (slot)
+		{
+			ConnectionGuard* next = slot->m_next;
+
+			slot->m_next = nullptr;
+			slot->m_previous = nullptr;
+			slot->m_signal = nullptr;
+
+			slot = next;
+		}
+
+		m_first = nullptr;
+		m_last = nullptr;
+
+		// Stop every emission in progress
+		for (Emission* emission = m_emission; emission; emission = emission->previous)
+			emission->next = nullptr;
+	}
+
+	/*!
+	* \brief Connects a function to the signal
+	* \return Connection attached to the signal, the listener is disconnected when it gets destroyed
+	*
+	* \param func Callable object, stored inside of the connection if it's small enough
+	*/
+
+	template<typename... Args>
+	template<typename F>
+	typename LightSignal<Args...>::ConnectionGuard LightSignal<Args...>::Connect(F&& func)
+	{
+		ConnectionGuard connection;
+		connection.SetCallback(std::forward<F>(func));
+
+		Link(&connection);
+
+		return connection;
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename LightSignal<Args...>::ConnectionGuard LightSignal<Args...>::Connect(O& object, void (O::*method)(Args...))
+	{
+		return Connect([&object, method] (Args... args)
+		{
+			return (object .* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename LightSignal<Args...>::ConnectionGuard LightSignal<Args...>::Connect(O* object, void (O::*method)(Args...))
+	{
+		return Connect([object, method] (Args... args)
+		{
+			return (object ->* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename LightSignal<Args...>::ConnectionGuard LightSignal<Args...>::Connect(const O& object, void (O::*method)(Args...) const)
+	{
+		return Connect([&object, method] (Args... args)
+		{
+			return (object .* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename LightSignal<Args...>::ConnectionGuard LightSignal<Args...>::Connect(const O* object, void (O::*method)(Args...) const)
+	{
+		return Connect([object, method] (Args... args)
+		{
+			return (object ->* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Checks whether the signal has no listener
+	* \return true If nothing is connected to the signal
+	*/
+
+	template<typename... Args>
+	inline bool LightSignal<Args...>::IsEmpty() const
+	{
+		return m_first == nullptr;
+	}
+
+	/*!
+	* \brief Applies the list of arguments to every callback functions
+	*
+	* \param args Arguments to send with the message
+	*
+	* \remark Listeners may disconnect (or destroy) any connection of this signal from their callback, but the signal itself must outlive the emission
+	*/
+
+	template<typename... Args>
+	void LightSignal<Args...>::operator()(Args... args) const
+	{
+		// Emissions are tracked so disconnecting the next listener from a callback won't break the iteration
+		// Since they're stored on the stack, this also works when the signal is fired recursively
+		Emission emission;
+		emission.previous = m_emission;
+
+		m_emission = &emission;
+
+		try
+		{
+			ConnectionGuard* slot = m_first;
+			while (slot)
+			{
+				emission.next = slot->m_next;
+				slot->m_invoker(slot->m_storage, args...);
+
+				slot = emission.next;
+			}
+		}
+		catch (...)
+		{
+			m_emission = emission.previous;
+			throw;
+		}
+
+		m_emission = emission.previous;
+	}
+
+	/*!
+	* \brief Moves the signal into this
+	* \return A reference to this
+	*
+	* \param signal Signal to move in this
+	*
+	* \remark Produces a NazaraAssert if one of the signals is being fired
+	*/
+
+	template<typename... Args>
+	LightSignal<Args...>& LightSignal<Args...>::operator=(LightSignal&& signal) noexcept
+	{
+		NazaraAssert(!m_emission && !signal.m_emission, "Signals cannot be moved while being fired");
+
+		if (&signal != this)
+		{
+			Clear();
+
+			m_first = signal.m_first;
+			m_last = signal.m_last;
+
+			signal.m_first = nullptr;
+			signal.m_last = nullptr;
+
+			// We need to update the signal pointer inside of each slot
+			for (ConnectionGuard* slot = m_first; slot; slot = slot->m_next)
+				slot->m_signal = this;
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Appends a listener at the end of the signal list
+	*
+	* \param slot Disconnected listener
+	*/
+
+	template<typename... Args>
+	void LightSignal<Args...>::Link(ConnectionGuard* slot) noexcept
+	{
+		NazaraAssert(!slot->m_signal, "Slot is already connected");
+
+		slot->m_signal = this;
+		slot->m_next = nullptr;
+		slot->m_previous = m_last;
+
+		if (m_last)
+			m_last->m_next = slot;
+		else
+			m_first = slot;
+
+		m_last = slot;
+
+		// If an emission was about to end, it has to call this new listener (as Signal does)
+		for (Emission* emission = m_emission; emission; emission = emission->previous)
+		{
+			if (!emission->next)
+				emission->next = slot;
+		}
+	}
+
+	/*!
+	* \brief Replaces a listener by another, keeping its place in the list
+	*
+	* \param slot Listener attached to this signal
+	* \param newSlot Disconnected listener taking its place
+	*/
+
+	template<typename... Args>
+	void LightSignal<Args...>::Replace(ConnectionGuard* slot, ConnectionGuard* newSlot) noexcept
+	{
+		NazaraAssert(slot->m_signal == this, "Slot is not attached to this signal");
+
+		newSlot->m_signal = this;
+		newSlot->m_next = slot->m_next;
+		newSlot->m_previous = slot->m_previous;
+
+		if (slot->m_previous)
+			slot->m_previous->m_next = newSlot;
+		else
+			m_first = newSlot;
+
+		if (slot->m_next)
+			slot->m_next->m_previous = newSlot;
+		else
+			m_last = newSlot;
+
+		for (Emission* emission = m_emission; emission; emission = emission->previous)
+		{
+			if (emission->next == slot)
+				emission->next = newSlot;
+		}
+
+		slot->m_next = nullptr;
+		slot->m_previous = nullptr;
+		slot->m_signal = nullptr;
+	}
+
+	/*!
+	* \brief Removes a listener from the signal list
+	*
+	* \param slot Listener attached to this signal
+	*/
+
+	template<typename... Args>
+	void LightSignal<Args...>::Unlink(ConnectionGuard* slot) noexcept
+	{
+		NazaraAssert(slot->m_signal == this, "Slot is not attached to this signal");
+
+		if (slot->m_previous)
+			slot->m_previous->m_next = slot->m_next;
+		else
+			m_first = slot->m_next;
+
+		if (slot->m_next)
+			slot->m_next->m_previous = slot->m_previous;
+		else
+			m_last = slot->m_previous;
+
+		for (Emission* emission = m_emission; emission; emission = emission->previous)
+		{
+			if (emission->next == slot)
+				emission->next = slot->m_next;
+		}
+
+		slot->m_next = nullptr;
+		slot->m_previous = nullptr;
+		slot->m_signal = nullptr;
+	}
+
+	/*!
+	* \class Nz::LightSignal::ConnectionGuard
+	* \brief Core class that represents a listener of a LightSignal, owning its callback and disconnecting it on destruction
+	*/
+
+	/*!
+	* \brief Constructs a LightSignal::ConnectionGuard object by default (not connected)
+	*/
+
+	template<typename... Args>
+	LightSignal<Args...>::ConnectionGuard::ConnectionGuard() :
+	m_signal(nullptr),
+	m_next(nullptr),
+	m_previous(nullptr),
+	m_invoker(nullptr),
+	m_manager(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Constructs a LightSignal::ConnectionGuard object by move semantic
+	*
+	* \param connection Connection to move, taking its place in the signal
+	*/
+
+	template<typename... Args>
+	LightSignal<Args...>::ConnectionGuard::ConnectionGuard(ConnectionGuard&& connection) noexcept :
+	ConnectionGuard()
+	{
+		operator=(std::move(connection));
+	}
+
+	/*!
+	* \brief Destructs the object, disconnecting it and releasing its callback
+	*/
+
+	template<typename... Args>
+	LightSignal<Args...>::ConnectionGuard::~ConnectionGuard()
+	{
+		Disconnect();
+		ResetCallback();
+	}
+
+	/*!
+	* \brief Connects to a signal with arguments, disconnecting from the previous one
+	*
+	* \param signal New signal to listen
+	* \param args Arguments for LightSignal::Connect
+	*/
+
+	template<typename... Args>
+	template<typename... ConnectArgs>
+	void LightSignal<Args...>::ConnectionGuard::Connect(BaseClass& signal, ConnectArgs&&... args)
+	{
+		operator=(signal.Connect(std::forward<ConnectArgs>(args)...));
+	}
+
+	/*!
+	* \brief Disconnects the connection from the signal
+	*
+	* \remark The callback is kept until the connection is destroyed or reconnected, making it safe to disconnect from the callback itself
+	*/
+
+	template<typename... Args>
+	void LightSignal<Args...>::ConnectionGuard::Disconnect() noexcept
+	{
+		if (m_signal)
+			m_signal->Unlink(this);
+	}
+
+	/*!
+	* \brief Checks whether the connection is still active with the signal
+	* \return true if signal is still active
+	*/
+
+	template<typename... Args>
+	inline bool LightSignal<Args...>::ConnectionGuard::IsConnected() const
+	{
+		return m_signal != nullptr;
+	}
+
+	/*!
+	* \brief Moves the connection into this, disconnecting the current one
+	* \return A reference to this
+	*
+	* \param connection Connection to move in this, taking its place in the signal
+	*/
+
+	template<typename... Args>
+	typename LightSignal<Args...>::ConnectionGuard& LightSignal<Args...>::ConnectionGuard::operator=(ConnectionGuard&& connection) noexcept
+	{
+		if (&connection != this)
+		{
+			Disconnect();
+			ResetCallback();
+
+			if (connection.m_manager)
+			{
+				connection.m_manager(Operation::Move, connection.m_storage, &m_storage);
+
+				m_invoker = connection.m_invoker;
+				m_manager = connection.m_manager;
+
+				connection.m_invoker = nullptr;
+				connection.m_manager = nullptr;
+			}
+
+			if (connection.m_signal)
+				connection.m_signal->Replace(&connection, this);
+		}
+
+		return *this;
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void LightSignal<Args...>::ConnectionGuard::SetCallback(F&& func)
+	{
+		using Callable = typename std::decay<F>::type;
+		using FitsStorage = std::integral_constant<bool, sizeof(Callable) <= sizeof(Storage) && alignof(Callable) <= alignof(Storage) && std::is_nothrow_move_constructible<Callable>::value>;
+
+		ResetCallback();
+		SetCallback(std::forward<F>(func), FitsStorage());
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void LightSignal<Args...>::ConnectionGuard::SetCallback(F&& func, std::false_type)
+	{
+		using Callable = typename std::decay<F>::type;
+
+		// Too big (or unsafe to move) to be stored inline, fallback to the heap
+		PlacementNew(reinterpret_cast<Callable**>(&m_storage), new Callable(std::forward<F>(func)));
+
+		m_invoker = &InvokeHeap<Callable>;
+		m_manager = &ManageHeap<Callable>;
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void LightSignal<Args...>::ConnectionGuard::SetCallback(F&& func, std::true_type)
+	{
+		using Callable = typename std::decay<F>::type;
+
+		PlacementNew(reinterpret_cast<Callable*>(&m_storage), std::forward<F>(func));
+
+		m_invoker = &InvokeLocal<Callable>;
+		m_manager = &ManageLocal<Callable>;
+	}
+
+	template<typename... Args>
+	void LightSignal<Args...>::ConnectionGuard::ResetCallback() noexcept
+	{
+		if (m_manager)
+		{
+			m_manager(Operation::Destroy, m_storage, nullptr);
+
+			m_invoker = nullptr;
+			m_manager = nullptr;
+		}
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void LightSignal<Args...>::ConnectionGuard::InvokeHeap(Storage& storage, Args... args)
+	{
+		(**reinterpret_cast<F**>(&storage))(std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void LightSignal<Args...>::ConnectionGuard::InvokeLocal(Storage& storage, Args... args)
+	{
+		(*reinterpret_cast<F*>(&storage))(std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void LightSignal<Args...>::ConnectionGuard::ManageHeap(Operation operation, Storage& storage, Storage* destination)
+	{
+		F*& functor = *reinterpret_cast<F**>(&storage);
+
+		switch (operation)
+		{
+			case Operation::Destroy:
+				delete functor;
+				break;
+
+			case Operation::Move:
+				PlacementNew(reinterpret_cast<F**>(destination), functor);
+				break;
+		}
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void LightSignal<Args...>::ConnectionGuard::ManageLocal(Operation operation, Storage& storage, Storage* destination)
+	{
+		F& functor = *reinterpret_cast<F*>(&storage);
+
+		switch (operation)
+		{
+			case Operation::Destroy:
+				break;
+
+			case Operation::Move:
+				PlacementNew(reinterpret_cast<F*>(destination), std::move(functor));
+				break;
+		}
+
+		PlacementDestroy(&functor);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
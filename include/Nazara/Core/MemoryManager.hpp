@@ -10,28 +10,47 @@
 #include <Nazara/Prerequesites.hpp>
 #include <cstdio>
 #include <cstring>
+#include <vector>
 
 namespace Nz
 {
 	class NAZARA_CORE_API MemoryManager
 	{
 		public:
+			struct CallSiteStatistics;
+
 			static void* Allocate(std::size_t size, bool multi = false, const char* file = nullptr, unsigned int line = 0);
 
 			static void EnableAllocationFilling(bool allocationFilling);
 			static void EnableAllocationLogging(bool logAllocations);
+			static void EnableAllocationStatistics(bool allocationStatistics);
 
 			static void Free(void* pointer, bool multi = false);
 
 			static unsigned int GetAllocatedBlockCount();
 			static std::size_t GetAllocatedSize();
 			static unsigned int GetAllocationCount();
+			static void GetCallSiteStatistics(std::vector<CallSiteStatistics>* statistics);
 
 			static bool IsAllocationFillingEnabled();
 			static bool IsAllocationLoggingEnabled();
+			static bool IsAllocationStatisticsEnabled();
 
+			static void NextFrame();
 			static void NextFree(const char* file, unsigned int line);
 
+			struct CallSiteStatistics
+			{
+				const char* file; //< nullptr for unknown positions
+				unsigned int line;
+				UInt64 allocatedSize;
+				UInt64 allocationCount;
+				UInt64 frameAllocatedSize;
+				UInt64 frameAllocationCount;
+				UInt64 freeCount;
+				UInt64 freedSize;
+			};
+
 		private:
 			MemoryManager();
 			~MemoryManager();
@@ -0,0 +1,43 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PARALLEL_HPP
+#define NAZARA_PARALLEL_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace Nz
+{
+	class TaskPool;
+
+	namespace Detail
+	{
+		class ParallelRange
+		{
+			public:
+				inline ParallelRange(std::size_t first, std::size_t last, std::size_t grainSize, std::size_t participantCount);
+
+				inline bool Acquire(std::size_t* chunkBegin, std::size_t* chunkEnd);
+
+			private:
+				std::atomic<std::size_t> m_next;
+				std::size_t m_divisor;
+				std::size_t m_grainSize;
+				std::size_t m_last;
+		};
+	}
+
+	template<typename F> void ParallelFor(std::size_t first, std::size_t last, std::size_t grainSize, F&& function);
+	template<typename F> void ParallelFor(TaskPool& pool, std::size_t first, std::size_t last, std::size_t grainSize, F&& function);
+	template<typename T, typename F, typename R> T ParallelReduce(std::size_t first, std::size_t last, std::size_t grainSize, T identity, F&& function, R&& reduce);
+	template<typename T, typename F, typename R> T ParallelReduce(TaskPool& pool, std::size_t first, std::size_t last, std::size_t grainSize, T identity, F&& function, R&& reduce);
+}
+
+#include <Nazara/Core/Parallel.inl>
+
+#endif // NAZARA_PARALLEL_HPP
@@ -0,0 +1,234 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		/*!
+		* \brief Constructs a ParallelRange object splitting [first, last[ between participants
+		*
+		* \param first First index of the range
+		* \param last Index past the last element of the range
+		* \param grainSize Minimum number of indices handed out at once
+		* \param participantCount Number of threads sharing the range
+		*/
+		inline ParallelRange::ParallelRange(std::size_t first, std::size_t last, std::size_t grainSize, std::size_t participantCount) :
+		m_next(first),
+		m_divisor(participantCount * 2),
+		m_grainSize(grainSize),
+		m_last(last)
+		{
+		}
+
+		/*!
+		* \brief Acquires the next chunk of the range
+		* \return false if the whole range was already distributed
+		*
+		* Chunks get smaller as the range gets consumed (but never below the grain size), big chunks keep the overhead low while the small last ones balance the load between participants.
+		*
+		* \param chunkBegin Output first index of the chunk
+		* \param chunkEnd Output index past the last element of the chunk
+		*/
+		inline bool ParallelRange::Acquire(std::size_t* chunkBegin, std::size_t* chunkEnd)
+		{
+			std::size_t current = m_next.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				if (current >= m_last)
+					return false;
+
+				std::size_t remaining = m_last - current;
+				std::size_t chunkSize = std::min(std::max(m_grainSize, remaining / m_divisor), remaining);
+				if (m_next.compare_exchange_weak(current, current + chunkSize, std::memory_order_relaxed))
+				{
+					*chunkBegin = current;
+					*chunkEnd = current + chunkSize;
+					return true;
+				}
+			}
+		}
+
+		inline std::size_t GetParallelParticipantCount(const TaskPool& pool, std::size_t indexCount, std::size_t grainSize)
+		{
+			std::size_t chunkCount = (indexCount + grainSize - 1) / grainSize;
+
+			// Workers plus the calling thread (unless it is already one of them)
+			std::size_t threadCount = pool.GetWorkerCount() + ((pool.IsWorkerThread()) ? 0 : 1);
+
+			return std::min(chunkCount, threadCount);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \fn Nz::ParallelFor
+	* \brief Calls a function over a range of indices, using the default pool workers
+	*
+	* \param first First index of the range
+	* \param last Index past the last element of the range
+	* \param grainSize Minimum number of indices per call, should be big enough to amortize the cost of a call
+	* \param function Function called as function(chunkBegin, chunkEnd) for each chunk of the range, possibly concurrently
+	*
+	* \see TaskScheduler
+	*/
+	template<typename F>
+	void ParallelFor(std::size_t first, std::size_t last, std::size_t grainSize, F&& function)
+	{
+		TaskPool* pool = TaskScheduler::GetPool();
+		if (!pool)
+		{
+			if (first < last)
+				function(first, last);
+
+			return;
+		}
+
+		ParallelFor(*pool, first, last, grainSize, std::forward<F>(function));
+	}
+
+	/*!
+	* \ingroup core
+	* \fn Nz::ParallelFor
+	* \brief Calls a function over a range of indices, using the workers of a pool
+	*
+	* The range is split in chunks acquired dynamically by each participant (including the calling thread), so uneven workloads stay balanced.
+	*
+	* \param pool Pool whose workers will process the range
+	* \param first First index of the range
+	* \param last Index past the last element of the range
+	* \param grainSize Minimum number of indices per call, should be big enough to amortize the cost of a call
+	* \param function Function called as function(chunkBegin, chunkEnd) for each chunk of the range, possibly concurrently
+	*
+	* \remark This calls TaskPool::Run, which also submits the tasks previously added to this pool by the calling thread
+	* \remark This can be called from a task
+	*/
+	template<typename F>
+	void ParallelFor(TaskPool& pool, std::size_t first, std::size_t last, std::size_t grainSize, F&& function)
+	{
+		NazaraAssert(grainSize > 0, "Grain size must be over zero");
+
+		if (first >= last)
+			return;
+
+		std::size_t participantCount = Detail::GetParallelParticipantCount(pool, last - first, grainSize);
+		if (participantCount <= 1)
+		{
+			function(first, last);
+			return;
+		}
+
+		Detail::ParallelRange range(first, last, grainSize, participantCount);
+		auto Process = [&range, &function]()
+		{
+			std::size_t chunkBegin;
+			std::size_t chunkEnd;
+			while (range.Acquire(&chunkBegin, &chunkEnd))
+				function(chunkBegin, chunkEnd);
+		};
+
+		for (std::size_t i = 1; i < participantCount; ++i)
+			pool.AddTask(Process);
+
+		TaskHandle participants = pool.Run();
+		Process();
+		participants.Wait();
+	}
+
+	/*!
+	* \ingroup core
+	* \fn Nz::ParallelReduce
+	* \brief Reduces a range of indices to a single value, using the default pool workers
+	* \return The reduction of every chunk result with the identity value
+	*
+	* \param first First index of the range
+	* \param last Index past the last element of the range
+	* \param grainSize Minimum number of indices per call, should be big enough to amortize the cost of a call
+	* \param identity Identity value of the reduction (ex: zero for a sum)
+	* \param function Function called as function(chunkBegin, chunkEnd) for each chunk of the range, possibly concurrently, and returning the chunk result
+	* \param reduce Function combining two results, must be associative and commutative
+	*
+	* \see TaskScheduler
+	*/
+	template<typename T, typename F, typename R>
+	T ParallelReduce(std::size_t first, std::size_t last, std::size_t grainSize, T identity, F&& function, R&& reduce)
+	{
+		TaskPool* pool = TaskScheduler::GetPool();
+		if (!pool)
+		{
+			if (first >= last)
+				return identity;
+
+			return reduce(identity, function(first, last));
+		}
+
+		return ParallelReduce(*pool, first, last, grainSize, std::move(identity), std::forward<F>(function), std::forward<R>(reduce));
+	}
+
+	/*!
+	* \ingroup core
+	* \fn Nz::ParallelReduce
+	* \brief Reduces a range of indices to a single value, using the workers of a pool
+	* \return The reduction of every chunk result with the identity value
+	*
+	* \param pool Pool whose workers will process the range
+	* \param first First index of the range
+	* \param last Index past the last element of the range
+	* \param grainSize Minimum number of indices per call, should be big enough to amortize the cost of a call
+	* \param identity Identity value of the reduction (ex: zero for a sum)
+	* \param function Function called as function(chunkBegin, chunkEnd) for each chunk of the range, possibly concurrently, and returning the chunk result
+	* \param reduce Function combining two results, must be associative and commutative as the chunks are not combined in any particular order
+	*
+	* \remark This calls TaskPool::Run, which also submits the tasks previously added to this pool by the calling thread
+	* \remark This can be called from a task
+	*/
+	template<typename T, typename F, typename R>
+	T ParallelReduce(TaskPool& pool, std::size_t first, std::size_t last, std::size_t grainSize, T identity, F&& function, R&& reduce)
+	{
+		NazaraAssert(grainSize > 0, "Grain size must be over zero");
+
+		if (first >= last)
+			return identity;
+
+		std::size_t participantCount = Detail::GetParallelParticipantCount(pool, last - first, grainSize);
+		if (participantCount <= 1)
+			return reduce(identity, function(first, last));
+
+		std::vector<T> results(participantCount, identity);
+
+		Detail::ParallelRange range(first, last, grainSize, participantCount);
+		auto Process = [&range, &function, &reduce](T& result)
+		{
+			std::size_t chunkBegin;
+			std::size_t chunkEnd;
+			while (range.Acquire(&chunkBegin, &chunkEnd))
+				result = reduce(result, function(chunkBegin, chunkEnd));
+		};
+
+		for (std::size_t i = 1; i < participantCount; ++i)
+		{
+			T* result = &results[i];
+			pool.AddTask([&Process, result]() { Process(*result); });
+		}
+
+		TaskHandle participants = pool.Run();
+		Process(results[0]);
+		participants.Wait();
+
+		T result = identity;
+		for (T& partialResult : results)
+			result = reduce(result, partialResult);
+
+		return result;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,51 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_POOLALLOCATOR_HPP
+#define NAZARA_POOLALLOCATOR_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <list>
+
+namespace Nz
+{
+	template<typename T>
+	class PoolAllocator
+	{
+		template<typename U> friend class PoolAllocator;
+
+		public:
+			using value_type = T;
+
+			PoolAllocator(ConcurrentMemoryPool& pool);
+			template<typename U> PoolAllocator(const PoolAllocator<U>& allocator);
+			PoolAllocator(const PoolAllocator&) = default;
+			~PoolAllocator() = default;
+
+			T* allocate(std::size_t n);
+
+			void deallocate(T* ptr, std::size_t n);
+
+			ConcurrentMemoryPool& GetPool() const;
+
+			PoolAllocator& operator=(const PoolAllocator&) = default;
+
+			template<typename U> bool operator==(const PoolAllocator<U>& allocator) const;
+			template<typename U> bool operator!=(const PoolAllocator<U>& allocator) const;
+
+		private:
+			static bool IsPooled(const ConcurrentMemoryPool& pool, std::size_t n);
+
+			ConcurrentMemoryPool* m_pool;
+	};
+
+	template<typename T> using PoolList = std::list<T, PoolAllocator<T>>;
+}
+
+#include <Nazara/Core/PoolAllocator.inl>
+
+#endif // NAZARA_POOLALLOCATOR_HPP
@@ -0,0 +1,125 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PoolAllocator.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <cstddef>
+#include <new>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::PoolAllocator
+	* \brief Core class adapting a ConcurrentMemoryPool to the standard Allocator requirements
+	*
+	* Single objects fitting in a block of the pool (such as the nodes of a `PoolList<T>`) are taken from the pool,
+	* other allocations fall back to the global operator new.
+	* Containers sharing a pool have equal allocators, which allows to splice elements between lists without any allocation.
+	*/
+
+	/*!
+	* \brief Constructs a PoolAllocator object
+	*
+	* \param pool Pool to take the memory from, which must outlive the allocator and its copies
+	*/
+	template<typename T>
+	PoolAllocator<T>::PoolAllocator(ConcurrentMemoryPool& pool) :
+	m_pool(&pool)
+	{
+	}
+
+	/*!
+	* \brief Constructs a PoolAllocator object from an allocator of another type
+	*
+	* \param allocator Allocator to take the pool from
+	*/
+	template<typename T>
+	template<typename U>
+	PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& allocator) :
+	m_pool(allocator.m_pool)
+	{
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory for n objects
+	* \return Pointer to the memory
+	*
+	* \param n Number of objects
+	*
+	* \remark Throws std::bad_alloc if the pool failed to grow
+	*/
+	template<typename T>
+	T* PoolAllocator<T>::allocate(std::size_t n)
+	{
+		if (!IsPooled(*m_pool, n))
+			return static_cast<T*>(OperatorNew(n * sizeof(T)));
+
+		void* ptr = m_pool->Allocate();
+		if (!ptr)
+			throw std::bad_alloc();
+
+		return static_cast<T*>(ptr);
+	}
+
+	/*!
+	* \brief Gives back memory previously returned by allocate
+	*
+	* \param ptr Pointer to the memory
+	* \param n Number of objects, as given to allocate
+	*/
+	template<typename T>
+	void PoolAllocator<T>::deallocate(T* ptr, std::size_t n)
+	{
+		if (IsPooled(*m_pool, n))
+			m_pool->Free(ptr);
+		else
+			OperatorDelete(ptr);
+	}
+
+	/*!
+	* \brief Gets the pool used by this allocator
+	* \return Reference to the pool
+	*/
+	template<typename T>
+	ConcurrentMemoryPool& PoolAllocator<T>::GetPool() const
+	{
+		return *m_pool;
+	}
+
+	/*!
+	* \brief Checks whether two allocators share the same pool
+	* \return true If memory allocated by one can be deallocated by the other
+	*
+	* \param allocator Other allocator
+	*/
+	template<typename T>
+	template<typename U>
+	bool PoolAllocator<T>::operator==(const PoolAllocator<U>& allocator) const
+	{
+		return m_pool == allocator.m_pool;
+	}
+
+	/*!
+	* \brief Checks whether two allocators use different pools
+	* \return false If memory allocated by one can be deallocated by the other
+	*
+	* \param allocator Other allocator
+	*/
+	template<typename T>
+	template<typename U>
+	bool PoolAllocator<T>::operator!=(const PoolAllocator<U>& allocator) const
+	{
+		return !operator==(allocator);
+	}
+
+	template<typename T>
+	bool PoolAllocator<T>::IsPooled(const ConcurrentMemoryPool& pool, std::size_t n)
+	{
+		return n == 1 && sizeof(T) <= pool.GetBlockSize() && alignof(T) <= alignof(std::max_align_t);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
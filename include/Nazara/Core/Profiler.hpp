@@ -0,0 +1,72 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PROFILER_HPP
+#define NAZARA_PROFILER_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/String.hpp>
+#include <atomic>
+
+#if NAZARA_CORE_PROFILER
+	#define NazaraProfileZone(name) Nz::ProfilerZone NazaraSuffixMacro(nazaraProfilerZone, __LINE__)(name)
+#else
+	#define NazaraProfileZone(name)
+#endif
+
+namespace Nz
+{
+	class Stream;
+
+	class NAZARA_CORE_API Profiler
+	{
+		friend class ProfilerZone;
+
+		public:
+			Profiler() = delete;
+			~Profiler() = delete;
+
+			static void Clear();
+
+			static void Enable(bool enable = true);
+
+			static bool ExportChromeTrace(const String& filePath);
+			static bool ExportChromeTrace(Stream& stream);
+
+			static std::size_t GetBufferSize();
+
+			static inline bool IsEnabled();
+
+			static void SetBufferSize(std::size_t eventCount);
+			static void SetThreadName(const String& name);
+
+		private:
+			static void RecordZone(const char* name, UInt64 start, UInt64 end);
+
+			static std::atomic<bool> s_enabled;
+	};
+
+	class ProfilerZone
+	{
+		public:
+			inline explicit ProfilerZone(const char* name);
+			ProfilerZone(const ProfilerZone&) = delete;
+			ProfilerZone(ProfilerZone&&) = delete;
+			inline ~ProfilerZone();
+
+			ProfilerZone& operator=(const ProfilerZone&) = delete;
+			ProfilerZone& operator=(ProfilerZone&&) = delete;
+
+		private:
+			const char* m_name;
+			UInt64 m_start;
+	};
+}
+
+#include <Nazara/Core/Profiler.inl>
+
+#endif // NAZARA_PROFILER_HPP
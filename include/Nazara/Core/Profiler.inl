@@ -0,0 +1,54 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Checks whether the profiler records zones
+	* \return true If enabled
+	*/
+	inline bool Profiler::IsEnabled()
+	{
+		return s_enabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ProfilerZone
+	* \brief Core class that records the duration of its scope in the Profiler
+	*
+	* Use it through the NazaraProfileZone macro, which expands to nothing if NAZARA_CORE_PROFILER is disabled.
+	*/
+
+	/*!
+	* \brief Starts the zone, if the profiler is enabled
+	*
+	* \param name Name of the zone, which must stay valid until the profile has been exported (usually a literal)
+	*/
+	inline ProfilerZone::ProfilerZone(const char* name)
+	{
+		if (Profiler::IsEnabled())
+		{
+			m_name = name;
+			m_start = GetElapsedMicroseconds();
+		}
+		else
+			m_name = nullptr;
+	}
+
+	/*!
+	* \brief Ends the zone and records it
+	*/
+	inline ProfilerZone::~ProfilerZone()
+	{
+		if (m_name)
+			Profiler::RecordZone(m_name, m_start, GetElapsedMicroseconds());
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/Debug.hpp>
 
@@ -58,6 +59,8 @@ namespace Nz
 		NazaraAssert(resource, "Invalid resource");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
+		NazaraProfileZone("ResourceLoader::LoadFromFile");
+
 		String path = File::NormalizePath(filePath);
 		String ext = path.SubStringFrom('.', -1, true).ToLower();
 		if (ext.IsEmpty())
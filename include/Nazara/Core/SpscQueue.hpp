@@ -0,0 +1,56 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SPSCQUEUE_HPP
+#define NAZARA_SPSCQUEUE_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <atomic>
+#include <memory>
+
+namespace Nz
+{
+	template<typename T>
+	class SpscQueue
+	{
+		public:
+			explicit SpscQueue(std::size_t capacity);
+			SpscQueue(const SpscQueue&) = delete;
+			SpscQueue(SpscQueue&&) = delete;
+			~SpscQueue() = default;
+
+			std::size_t GetCapacity() const;
+
+			bool IsEmpty() const;
+
+			bool TryPop(T* value);
+			bool TryPush(const T& value);
+			bool TryPush(T&& value);
+
+			SpscQueue& operator=(const SpscQueue&) = delete;
+			SpscQueue& operator=(SpscQueue&&) = delete;
+
+		private:
+			template<typename U> bool Push(U&& value);
+
+			static constexpr std::size_t CacheLineSize = 64;
+
+			// The consumer and the producer indices live on their own cache lines, along with the copy of the other index they last saw
+			std::size_t m_mask;
+			std::unique_ptr<T[]> m_values;
+			UInt8 m_consumerPadding[CacheLineSize];
+			std::atomic<std::size_t> m_head;
+			std::size_t m_cachedTail;
+			UInt8 m_producerPadding[CacheLineSize];
+			std::atomic<std::size_t> m_tail;
+			std::size_t m_cachedHead;
+			UInt8 m_endPadding[CacheLineSize];
+	};
+}
+
+#include <Nazara/Core/SpscQueue.inl>
+
+#endif // NAZARA_SPSCQUEUE_HPP
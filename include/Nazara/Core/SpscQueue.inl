@@ -0,0 +1,143 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/SpscQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::SpscQueue
+	* \brief Core class that represents a bounded lock-free queue between one producer thread and one consumer thread
+	*
+	* Values are moved into a ring buffer allocated once, pushing and popping never lock nor allocate.
+	* Only one thread may push and only one (other) thread may pop at the same time.
+	*
+	* \remark T must be default constructible and move assignable, popped slots are left in a moved-from state
+	*/
+
+	/*!
+	* \brief Constructs a SpscQueue object
+	*
+	* \param capacity Maximum number of values the queue can hold, rounded up to a power of two
+	*
+	* \remark Produces a NazaraAssert if capacity is zero
+	*/
+	template<typename T>
+	SpscQueue<T>::SpscQueue(std::size_t capacity) :
+	m_head(0),
+	m_cachedTail(0),
+	m_tail(0),
+	m_cachedHead(0)
+	{
+		NazaraAssert(capacity > 0, "Capacity must be over zero");
+
+		std::size_t powerOfTwo = 1;
+		while (powerOfTwo < capacity)
+			powerOfTwo <<= 1;
+
+		m_mask = powerOfTwo - 1;
+		m_values.reset(new T[powerOfTwo]);
+	}
+
+	/*!
+	* \brief Gets the maximum number of values the queue can hold
+	* \return Capacity of the queue
+	*/
+	template<typename T>
+	std::size_t SpscQueue<T>::GetCapacity() const
+	{
+		return m_mask + 1;
+	}
+
+	/*!
+	* \brief Checks whether the queue is empty
+	* \return true If no value is waiting to be popped
+	*
+	* \remark The result may already be outdated when the function returns, unless it is called by the consumer (for emptiness) or the producer (for non-emptiness)
+	*/
+	template<typename T>
+	bool SpscQueue<T>::IsEmpty() const
+	{
+		return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Pops the oldest value of the queue
+	* \return true If a value was popped, false if the queue was empty
+	*
+	* \param value Pointer to the object receiving the value
+	*
+	* \remark Must only be called by the consumer thread
+	*/
+	template<typename T>
+	bool SpscQueue<T>::TryPop(T* value)
+	{
+		NazaraAssert(value, "Invalid value");
+
+		std::size_t head = m_head.load(std::memory_order_relaxed);
+		if (head == m_cachedTail)
+		{
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			if (head == m_cachedTail)
+				return false;
+		}
+
+		*value = std::move(m_values[head & m_mask]);
+		m_head.store(head + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	* \brief Pushes a copy of a value at the end of the queue
+	* \return true If the value was pushed, false if the queue was full
+	*
+	* \param value Value to push
+	*
+	* \remark Must only be called by the producer thread
+	*/
+	template<typename T>
+	bool SpscQueue<T>::TryPush(const T& value)
+	{
+		return Push(value);
+	}
+
+	/*!
+	* \brief Moves a value at the end of the queue
+	* \return true If the value was pushed, false if the queue was full (the value is left untouched)
+	*
+	* \param value Value to push
+	*
+	* \remark Must only be called by the producer thread
+	*/
+	template<typename T>
+	bool SpscQueue<T>::TryPush(T&& value)
+	{
+		return Push(std::move(value));
+	}
+
+	template<typename T>
+	template<typename U>
+	bool SpscQueue<T>::Push(U&& value)
+	{
+		std::size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_cachedHead > m_mask)
+		{
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail - m_cachedHead > m_mask)
+				return false;
+		}
+
+		m_values[tail & m_mask] = std::forward<U>(value);
+		m_tail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,63 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TASKHANDLE_HPP
+#define NAZARA_TASKHANDLE_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Nz
+{
+	class TaskPool;
+
+	class NAZARA_CORE_API TaskHandle
+	{
+		friend TaskPool;
+
+		public:
+			struct Counter;
+
+			inline TaskHandle();
+			TaskHandle(const TaskHandle& handle);
+			inline TaskHandle(TaskHandle&& handle) noexcept;
+			~TaskHandle();
+
+			bool IsDone() const;
+			inline bool IsValid() const;
+
+			void Wait() const;
+
+			TaskHandle& operator=(const TaskHandle& handle);
+			TaskHandle& operator=(TaskHandle&& handle) noexcept;
+
+			static void Release(Counter* counter);
+
+			// Shared state of a task (or a batch of tasks), handled by the TaskPool
+			struct Counter
+			{
+				Counter(std::size_t taskCount, unsigned int references, TaskPool* pool);
+				virtual ~Counter();
+
+				std::atomic<bool> successorLock;
+				std::atomic<std::size_t> remainingTasks;
+				std::atomic<unsigned int> referenceCount;
+				std::vector<Counter*> successors;
+				TaskPool* owner;
+			};
+
+		private:
+			inline explicit TaskHandle(Counter* counter);
+
+			Counter* m_counter;
+	};
+}
+
+#include <Nazara/Core/TaskHandle.inl>
+
+#endif // NAZARA_TASKHANDLE_HPP
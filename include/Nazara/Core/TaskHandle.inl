@@ -0,0 +1,48 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs an invalid TaskHandle object
+	*/
+	inline TaskHandle::TaskHandle() :
+	m_counter(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Constructs a TaskHandle object by move semantic
+	*
+	* \param handle TaskHandle to move into this
+	*/
+	inline TaskHandle::TaskHandle(TaskHandle&& handle) noexcept :
+	m_counter(handle.m_counter)
+	{
+		handle.m_counter = nullptr;
+	}
+
+	/*!
+	* \brief Checks whether the handle refers to a task (or a batch of tasks)
+	* \return true If the handle is valid
+	*/
+	inline bool TaskHandle::IsValid() const
+	{
+		return m_counter != nullptr;
+	}
+
+	/*!
+	* \brief Constructs a TaskHandle object adopting a reference to a counter
+	*
+	* \param counter Counter tracking the task(s), its reference count must already account for this handle
+	*/
+	inline TaskHandle::TaskHandle(Counter* counter) :
+	m_counter(counter)
+	{
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,62 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TASKPOOL_HPP
+#define NAZARA_TASKPOOL_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Functor.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TaskHandle.hpp>
+#include <initializer_list>
+
+namespace Nz
+{
+	class TaskPoolImpl;
+	class TaskScheduler;
+
+	class NAZARA_CORE_API TaskPool
+	{
+		friend TaskHandle;
+		friend TaskScheduler;
+
+		public:
+			TaskPool(unsigned int workerCount = 0, const String& workerName = "TaskWorker", UInt64 affinityMask = 0);
+			TaskPool(const TaskPool&) = delete;
+			TaskPool(TaskPool&&) = delete;
+			~TaskPool();
+
+			template<typename F> TaskHandle AddTask(F function);
+			template<typename F, typename... Args> TaskHandle AddTask(F function, Args&&... args);
+			template<typename C> TaskHandle AddTask(void (C::*function)(), C* object);
+			template<typename F> TaskHandle AddTaskAfter(std::initializer_list<TaskHandle> predecessors, F function);
+			template<typename F> TaskHandle AddTaskAfter(const TaskHandle* predecessors, std::size_t predecessorCount, F function);
+
+			UInt64 GetAffinityMask() const;
+			const String& GetWorkerName() const;
+			unsigned int GetWorkerCount() const;
+
+			bool IsWorkerThread() const;
+
+			TaskHandle Run();
+			TaskHandle Run(const TaskHandle* tasks, std::size_t taskCount);
+
+			void WaitForTasks();
+
+			TaskPool& operator=(const TaskPool&) = delete;
+			TaskPool& operator=(TaskPool&&) = delete;
+
+		private:
+			TaskHandle AddTaskFunctor(Functor* taskFunctor, const TaskHandle* predecessors = nullptr, std::size_t predecessorCount = 0);
+			void WaitForCounter(const TaskHandle::Counter* counter);
+
+			TaskPoolImpl* m_impl;
+	};
+}
+
+#include <Nazara/Core/TaskPool.inl>
+
+#endif // NAZARA_TASKPOOL_HPP
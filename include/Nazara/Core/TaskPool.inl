@@ -0,0 +1,90 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::TaskPool
+	* \brief Core class that represents a pool of worker threads executing tasks
+	*/
+
+	/*!
+	* \brief Adds a task to the pending list
+	* \return Handle which can be used to wait for this task
+	*
+	* \param function Task that the pool will execute
+	*/
+
+	template<typename F>
+	TaskHandle TaskPool::AddTask(F function)
+	{
+		return AddTaskFunctor(new FunctorWithoutArgs<F>(function));
+	}
+
+	/*!
+	* \brief Adds a task to the pending list
+	* \return Handle which can be used to wait for this task
+	*
+	* \param function Task that the pool will execute
+	* \param args Arguments of the function
+	*/
+
+	template<typename F, typename... Args>
+	TaskHandle TaskPool::AddTask(F function, Args&&... args)
+	{
+		return AddTaskFunctor(new FunctorWithArgs<F, Args...>(function, std::forward<Args>(args)...));
+	}
+
+	/*!
+	* \brief Adds a task to the pending list
+	* \return Handle which can be used to wait for this task
+	*
+	* \param function Task that the pool will execute
+	* \param object Object on which the method will be called
+	*/
+
+	template<typename C>
+	TaskHandle TaskPool::AddTask(void (C::*function)(), C* object)
+	{
+		return AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
+	}
+
+	/*!
+	* \brief Adds a task to the pending list, which will only be executed once its predecessors are done
+	* \return Handle which can be used to wait for this task (or as a predecessor of another task)
+	*
+	* \param predecessors Handles of the tasks (or batches of tasks) which must be done before this task starts
+	* \param function Task that the pool will execute
+	*
+	* \remark The task still has to be submitted using Run, it will then start as soon as its last predecessor is done
+	*/
+
+	template<typename F>
+	TaskHandle TaskPool::AddTaskAfter(std::initializer_list<TaskHandle> predecessors, F function)
+	{
+		return AddTaskFunctor(new FunctorWithoutArgs<F>(function), predecessors.begin(), predecessors.size());
+	}
+
+	/*!
+	* \brief Adds a task to the pending list, which will only be executed once its predecessors are done
+	* \return Handle which can be used to wait for this task (or as a predecessor of another task)
+	*
+	* \param predecessors Pointer to the handles of the tasks (or batches of tasks) which must be done before this task starts
+	* \param predecessorCount Number of handles
+	* \param function Task that the pool will execute
+	*
+	* \remark The task still has to be submitted using Run, it will then start as soon as its last predecessor is done
+	*/
+
+	template<typename F>
+	TaskHandle TaskPool::AddTaskAfter(const TaskHandle* predecessors, std::size_t predecessorCount, F function)
+	{
+		return AddTaskFunctor(new FunctorWithoutArgs<F>(function), predecessors, predecessorCount);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -9,6 +9,9 @@
 
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <Nazara/Core/TaskHandle.hpp>
+#include <Nazara/Core/TaskPool.hpp>
+#include <initializer_list>
 
 namespace Nz
 {
@@ -18,18 +21,21 @@ namespace Nz
 			TaskScheduler() = delete;
 			~TaskScheduler() = delete;
 
-			template<typename F> static void AddTask(F function);
-			template<typename F, typename... Args> static void AddTask(F function, Args&&... args);
-			template<typename C> static void AddTask(void (C::*function)(), C* object);
+			template<typename F> static TaskHandle AddTask(F function);
+			template<typename F, typename... Args> static TaskHandle AddTask(F function, Args&&... args);
+			template<typename C> static TaskHandle AddTask(void (C::*function)(), C* object);
+			template<typename F> static TaskHandle AddTaskAfter(std::initializer_list<TaskHandle> predecessors, F function);
+			template<typename F> static TaskHandle AddTaskAfter(const TaskHandle* predecessors, std::size_t predecessorCount, F function);
+			static TaskPool* GetPool();
 			static unsigned int GetWorkerCount();
 			static bool Initialize();
-			static void Run();
+			static TaskHandle Run();
 			static void SetWorkerCount(unsigned int workerCount);
 			static void Uninitialize();
 			static void WaitForTasks();
 
 		private:
-			static void AddTaskFunctor(Functor* taskFunctor);
+			static TaskHandle AddTaskFunctor(Functor* taskFunctor, const TaskHandle* predecessors = nullptr, std::size_t predecessorCount = 0);
 	};
 }
 
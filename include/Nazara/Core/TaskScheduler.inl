@@ -9,45 +9,81 @@ namespace Nz
 	/*!
 	* \ingroup core
 	* \class Nz::TaskScheduler
-	* \brief Core class that represents a thread pool
+	* \brief Core class giving access to the default task pool
 	*/
 
 	/*!
 	* \brief Adds a task to the pending list
+	* \return Handle which can be used to wait for this task
 	*
 	* \param function Task that the pool will execute
 	*/
 
 	template<typename F>
-	void TaskScheduler::AddTask(F function)
+	TaskHandle TaskScheduler::AddTask(F function)
 	{
-		AddTaskFunctor(new FunctorWithoutArgs<F>(function));
+		return AddTaskFunctor(new FunctorWithoutArgs<F>(function));
 	}
 
 	/*!
 	* \brief Adds a task to the pending list
+	* \return Handle which can be used to wait for this task
 	*
 	* \param function Task that the pool will execute
 	* \param args Arguments of the function
 	*/
 
 	template<typename F, typename... Args>
-	void TaskScheduler::AddTask(F function, Args&&... args)
+	TaskHandle TaskScheduler::AddTask(F function, Args&&... args)
 	{
-		AddTaskFunctor(new FunctorWithArgs<F, Args...>(function, std::forward<Args>(args)...));
+		return AddTaskFunctor(new FunctorWithArgs<F, Args...>(function, std::forward<Args>(args)...));
 	}
 
 	/*!
 	* \brief Adds a task to the pending list
+	* \return Handle which can be used to wait for this task
 	*
 	* \param function Task that the pool will execute
 	* \param object Object on which the method will be called
 	*/
 
 	template<typename C>
-	void TaskScheduler::AddTask(void (C::*function)(), C* object)
+	TaskHandle TaskScheduler::AddTask(void (C::*function)(), C* object)
 	{
-		AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
+		return AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
+	}
+
+	/*!
+	* \brief Adds a task to the pending list, which will only be executed once its predecessors are done
+	* \return Handle which can be used to wait for this task (or as a predecessor of another task)
+	*
+	* \param predecessors Handles of the tasks (or batches of tasks) which must be done before this task starts
+	* \param function Task that the pool will execute
+	*
+	* \remark The task still has to be submitted using Run, it will then start as soon as its last predecessor is done
+	*/
+
+	template<typename F>
+	TaskHandle TaskScheduler::AddTaskAfter(std::initializer_list<TaskHandle> predecessors, F function)
+	{
+		return AddTaskFunctor(new FunctorWithoutArgs<F>(function), predecessors.begin(), predecessors.size());
+	}
+
+	/*!
+	* \brief Adds a task to the pending list, which will only be executed once its predecessors are done
+	* \return Handle which can be used to wait for this task (or as a predecessor of another task)
+	*
+	* \param predecessors Pointer to the handles of the tasks (or batches of tasks) which must be done before this task starts
+	* \param predecessorCount Number of handles
+	* \param function Task that the pool will execute
+	*
+	* \remark The task still has to be submitted using Run, it will then start as soon as its last predecessor is done
+	*/
+
+	template<typename F>
+	TaskHandle TaskScheduler::AddTaskAfter(const TaskHandle* predecessors, std::size_t predecessorCount, F function)
+	{
+		return AddTaskFunctor(new FunctorWithoutArgs<F>(function), predecessors, predecessorCount);
 	}
 }
 
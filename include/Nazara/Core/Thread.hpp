@@ -32,6 +32,7 @@ namespace Nz
 			Id GetId() const;
 			bool IsJoinable() const;
 			void Join();
+			void SetAffinity(UInt64 cpuMask);
 			void SetName(const String& name);
 
 			Thread& operator=(const Thread&) = delete;
@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/LightSignal.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/RefCounted.hpp>
@@ -178,7 +179,7 @@ namespace Nz
 			template<typename... Args> static MaterialRef New(Args&&... args);
 
 			// Signals:
-			NazaraSignal(OnMaterialRelease, const Material* /*material*/);
+			NazaraLightSignal(OnMaterialRelease, const Material* /*material*/);
 			NazaraSignal(OnMaterialReset, const Material* /*material*/);
 
 		private:
@@ -173,6 +173,23 @@ namespace Nz
 	//TODO: Mark as constexpr when supported by all major compilers
 	/*constexpr*/ inline std::size_t CountBits(T value)
 	{
+		if (sizeof(T) <= sizeof(UInt64))
+		{
+			UInt64 bits = static_cast<std::make_unsigned_t<T>>(value);
+
+			#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC)
+			// Single instruction when the target supports it (-mpopcnt)
+			return __builtin_popcountll(bits);
+			#else
+			// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel
+			bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+			bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+			bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+			return static_cast<std::size_t>((bits * 0x0101010101010101ULL) >> 56);
+			#endif
+		}
+
 		// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetKernighan
 		std::size_t count = 0;
 		while (value)
@@ -447,6 +464,12 @@ namespace Nz
 	//TODO: Mark as constexpr when supported by all major compilers
 	/*constexpr*/ inline unsigned int IntegralLog2Pot(T pot)
 	{
+		#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC)
+		// The log of a power of two is its number of trailing zeros
+		if (sizeof(T) <= sizeof(unsigned long long))
+			return (pot != 0) ? static_cast<unsigned int>(__builtin_ctzll(static_cast<unsigned long long>(pot))) : 0U;
+		#endif
+
 		return Detail::IntegralLog2Pot<T>(pot);
 	}
 
@@ -0,0 +1,34 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETCOMPRESSOR_HPP
+#define NAZARA_ENETCOMPRESSOR_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+
+namespace Nz
+{
+	class ENetPeer;
+
+	class NAZARA_NETWORK_API ENetCompressor
+	{
+		public:
+			ENetCompressor() = default;
+			ENetCompressor(const ENetCompressor&) = delete;
+			ENetCompressor(ENetCompressor&&) = default;
+			virtual ~ENetCompressor();
+
+			virtual std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) = 0;
+			virtual std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) = 0;
+
+			ENetCompressor& operator=(const ENetCompressor&) = delete;
+			ENetCompressor& operator=(ENetCompressor&&) = default;
+	};
+}
+
+#endif // NAZARA_ENETCOMPRESSOR_HPP
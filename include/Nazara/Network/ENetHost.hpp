@@ -20,15 +20,18 @@
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Clock.hpp>
-#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 #include <deque>
+#include <memory>
 #include <queue>
 #include <random>
 #include <set>
@@ -59,13 +62,22 @@ namespace Nz
 			bool Create(const IpAddress& address, std::size_t peerCount, std::size_t channelCount, UInt32 incomingBandwidth, UInt32 outgoingBandwidth);
 			void Destroy();
 
+			inline void EnableChecksum(bool checksum = true);
+			inline void EnableReusePort(bool reusePort = true);
+
 			void Flush();
 
 			inline Nz::IpAddress GetBoundAddress() const;
+			inline ENetCompressor* GetCompressor() const;
 			inline UInt32 GetServiceTime() const;
 
+			inline bool IsChecksumEnabled() const;
+			inline bool IsReusePortEnabled() const;
+
 			int Service(ENetEvent* event, UInt32 timeout);
 
+			inline void SetCompressor(std::unique_ptr<ENetCompressor> compressor);
+
 			void SimulateNetwork(double packetLossProbability, UInt16 minDelay, UInt16 maxDelay);
 
 			ENetHost& operator=(const ENetHost&) = delete;
@@ -90,9 +102,12 @@ namespace Nz
 			void NotifyConnect(ENetPeer* peer, ENetEvent* event, bool incoming);
 			void NotifyDisconnect(ENetPeer*, ENetEvent* event);
 
+			bool QueueOutgoingDatagram(const IpAddress& to);
+
 			void SendAcknowledgements(ENetPeer* peer);
 			bool SendReliableOutgoingCommands(ENetPeer* peer);
 			int SendOutgoingCommands(ENetEvent* event, bool checkForTimeouts);
+			bool SendOutgoingDatagrams();
 			void SendUnreliableOutgoingCommands(ENetPeer* peer);
 
 			void ThrottleBandwidth();
@@ -124,18 +139,27 @@ namespace Nz
 			std::size_t m_channelLimit;
 			std::size_t m_commandCount;
 			std::size_t m_duplicatePeers;
+			std::size_t m_incomingDatagramCount;
+			std::size_t m_incomingDatagramIndex;
 			std::size_t m_maximumPacketSize;
 			std::size_t m_maximumWaitingData;
+			std::size_t m_outgoingDatagramCount;
 			std::size_t m_packetSize;
 			std::size_t m_peerCount;
 			std::size_t m_receivedDataLength;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
+			std::unique_ptr<ENetCompressor> m_compressor;
 			std::vector<ENetPeer> m_peers;
+			std::vector<NetBuffer> m_datagramBuffers;
+			std::vector<NetDatagram> m_incomingDatagrams;
+			std::vector<NetDatagram> m_outgoingDatagrams;
 			std::vector<PendingIncomingPacket> m_pendingIncomingPackets;
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
+			std::vector<UInt8> m_datagramData;
 			UInt8* m_receivedData;
 			Bitset<UInt64> m_dispatchQueue;
-			MemoryPool m_packetPool;
+			ConcurrentMemoryPool m_commandPool;
+			ConcurrentMemoryPool m_packetPool;
 			IpAddress m_address;
 			IpAddress m_receivedAddress;
 			SocketPoller m_poller;
@@ -153,6 +177,8 @@ namespace Nz
 			UInt64 m_totalSentData;
 			UInt64 m_totalReceivedData;
 			bool m_continueSending;
+			bool m_isChecksumEnabled;
+			bool m_isReusePortEnabled;
 			bool m_isSimulationEnabled;
 			bool m_recalculateBandwidthLimits;
 
@@ -9,7 +9,10 @@
 namespace Nz
 {
 	inline ENetHost::ENetHost() :
+	m_commandPool(ENetPeer::commandBlockSize),
 	m_packetPool(sizeof(ENetPacket)),
+	m_isChecksumEnabled(false),
+	m_isReusePortEnabled(false),
 	m_isSimulationEnabled(false)
 	{
 	}
@@ -52,16 +55,93 @@ namespace Nz
 		m_socket.Close();
 	}
 
+	/*!
+	* \brief Enables datagram checksums
+	*
+	* A CRC32C of every datagram (and of the connection it belongs to) is sent along with it, datagrams with a wrong checksum are dropped on reception.
+	*
+	* \param checksum Should checksums be used
+	*
+	* \remark Remote hosts must enable checksums too, as datagrams with and without checksums are not compatible
+	*/
+
+	inline void ENetHost::EnableChecksum(bool checksum)
+	{
+		m_isChecksumEnabled = checksum;
+	}
+
+	/*!
+	* \brief Allows other hosts of the process to bind the same port
+	*
+	* Incoming datagrams are then balanced by the system between the hosts sharing the port, according to their source address.
+	*
+	* \param reusePort Should the port be shared
+	*
+	* \remark This must be called before Create, which fails if the system doesn't support it
+	*
+	* \see UdpSocket::EnableReusePort
+	*/
+
+	inline void ENetHost::EnableReusePort(bool reusePort)
+	{
+		m_isReusePortEnabled = reusePort;
+	}
+
 	inline Nz::IpAddress ENetHost::GetBoundAddress() const
 	{
 		return m_address;
 	}
 
+	/*!
+	* \brief Gets the compressor used on datagrams
+	* \return Compressor used by the host, or nullptr if datagrams are sent uncompressed
+	*/
+
+	inline ENetCompressor* ENetHost::GetCompressor() const
+	{
+		return m_compressor.get();
+	}
+
 	inline UInt32 Nz::ENetHost::GetServiceTime() const
 	{
 		return m_serviceTime;
 	}
 
+	/*!
+	* \brief Checks whether datagram checksums are enabled
+	* \return true If datagrams are sent and received with a checksum
+	*/
+
+	inline bool ENetHost::IsChecksumEnabled() const
+	{
+		return m_isChecksumEnabled;
+	}
+
+	/*!
+	* \brief Checks whether the host shares its port with other hosts
+	* \return true If it is the case
+	*/
+
+	inline bool ENetHost::IsReusePortEnabled() const
+	{
+		return m_isReusePortEnabled;
+	}
+
+	/*!
+	* \brief Sets the compressor used on datagrams
+	*
+	* Every datagram sent by the host will be compressed if it makes it smaller, and compressed datagrams will be decompressed on reception.
+	*
+	* \param compressor Compressor to use, or nullptr to disable compression
+	*
+	* \remark Remote hosts must use the same compressor, as they drop compressed datagrams they can't decompress
+	*/
+
+	inline void ENetHost::SetCompressor(std::unique_ptr<ENetCompressor> compressor)
+	{
+		m_compressor = std::move(compressor);
+	}
+
 	inline ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags, NetPacket&& data)
 	{
 		ENetPacketRef ref = AllocatePacket(flags);
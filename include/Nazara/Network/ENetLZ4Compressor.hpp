@@ -0,0 +1,34 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETLZ4COMPRESSOR_HPP
+#define NAZARA_ENETLZ4COMPRESSOR_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <array>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetLZ4Compressor final : public ENetCompressor
+	{
+		public:
+			ENetLZ4Compressor() = default;
+			~ENetLZ4Compressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+		private:
+			static constexpr unsigned int HashLog = 12;
+
+			std::array<UInt8, ENetConstants::ENetProtocol_MaximumMTU> m_inputBuffer;
+			std::array<UInt16, 1 << HashLog> m_hashTable;
+	};
+}
+
+#endif // NAZARA_ENETLZ4COMPRESSOR_HPP
@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <atomic>
 
 namespace Nz
 {
@@ -30,14 +31,14 @@ namespace Nz
 
 	constexpr ENetPacketFlags ENetPacketFlag_Unreliable = 0;
 
-	class MemoryPool;
+	class ConcurrentMemoryPool;
 
 	struct ENetPacket
 	{
-		MemoryPool* owner;
+		ConcurrentMemoryPool* owner;
 		ENetPacketFlags flags;
 		NetPacket data;
-		std::size_t referenceCount = 0;
+		std::atomic<std::size_t> referenceCount{0}; //< References may be released by another thread than the host one
 	};
 
 	struct NAZARA_NETWORK_API ENetPacketRef
@@ -94,6 +95,11 @@ namespace Nz
 
 		ENetPacketRef& operator=(ENetPacketRef&& packet)
 		{
+			if (this == &packet)
+				return *this;
+
+			Reset();
+
 			m_packet = packet.m_packet;
 			packet.m_packet = nullptr;
 
@@ -20,13 +20,14 @@
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/PoolAllocator.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
+#include <algorithm>
 #include <array>
-#include <list>
 #include <random>
 #include <vector>
 
@@ -40,7 +41,9 @@ namespace Nz
 		friend struct PacketRef;
 
 		public:
-			inline ENetPeer(ENetHost* host, UInt16 peerId);
+			struct CompressionStats;
+
+			ENetPeer(ENetHost* host, UInt16 peerId);
 			ENetPeer(const ENetPeer&) = delete;
 			ENetPeer(ENetPeer&&) = default;
 			~ENetPeer() = default;
@@ -50,6 +53,8 @@ namespace Nz
 			void DisconnectNow(UInt32 data);
 
 			inline const IpAddress& GetAddress() const;
+			inline const CompressionStats& GetCompressionStats() const;
+			inline ENetHost* GetHost() const;
 			inline UInt32 GetMtu() const;
 			inline UInt32 GetPacketThrottleAcceleration() const;
 			inline UInt32 GetPacketThrottleDeceleration() const;
@@ -78,6 +83,15 @@ namespace Nz
 			ENetPeer& operator=(const ENetPeer&) = delete;
 			ENetPeer& operator=(ENetPeer&&) = default;
 
+			struct CompressionStats
+			{
+				UInt64 compressedDataReceived = 0;   //< Size of compressed datagrams received, before decompression
+				UInt64 compressedDataSent = 0;       //< Size of datagrams sent after compression (even if it didn't make them smaller)
+				UInt64 uncompressedDataReceived = 0; //< Size of compressed datagrams received, once decompressed
+				UInt64 uncompressedDataSent = 0;     //< Size of datagrams sent before compression
+				UInt32 incompressibleDatagrams = 0;  //< Number of datagrams sent uncompressed because compression didn't make them smaller
+			};
+
 		private:
 			void InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand);
 			void InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize);
@@ -87,6 +101,9 @@ namespace Nz
 			struct IncomingCommmand;
 			struct OutgoingCommand;
 
+			using IncomingCommandList = PoolList<IncomingCommmand>;
+			using OutgoingCommandList = PoolList<OutgoingCommand>;
+
 			inline void ChangeState(ENetPeerState state);
 
 			bool CheckTimeouts(ENetEvent* event);
@@ -133,7 +150,9 @@ namespace Nz
 
 			struct Channel
 			{
-				Channel()
+				Channel(ConcurrentMemoryPool& commandPool) :
+				incomingReliableCommands(commandPool),
+				incomingUnreliableCommands(commandPool)
 				{
 					incomingReliableSequenceNumber = 0;
 					incomingUnreliableSequenceNumber = 0;
@@ -144,8 +163,8 @@ namespace Nz
 				}
 
 				std::array<UInt16, ENetPeer_ReliableWindows> reliableWindows;
-				std::list<IncomingCommmand>                  incomingReliableCommands;
-				std::list<IncomingCommmand>                  incomingUnreliableCommands;
+				IncomingCommandList                          incomingReliableCommands;
+				IncomingCommandList                          incomingUnreliableCommands;
 				UInt16                                       incomingReliableSequenceNumber;
 				UInt16                                       incomingUnreliableSequenceNumber;
 				UInt16                                       outgoingReliableSequenceNumber;
@@ -179,15 +198,19 @@ namespace Nz
 
 			static constexpr std::size_t unsequencedWindow = ENetPeer_ReliableWindowSize / 32;
 
+			// Command lists nodes hold two links along with the command
+			static constexpr std::size_t commandBlockSize = 2 * sizeof(void*) + std::max(sizeof(IncomingCommmand), sizeof(OutgoingCommand));
+
 			ENetHost*                             m_host;
 			IpAddress                             m_address; /**< Internet address of the peer */
 			std::array<UInt32, unsequencedWindow> m_unsequencedWindow;
 			std::bernoulli_distribution           m_packetLossProbability;
-			std::list<IncomingCommmand>           m_dispatchedCommands;
-			std::list<OutgoingCommand>            m_outgoingReliableCommands;
-			std::list<OutgoingCommand>            m_outgoingUnreliableCommands;
-			std::list<OutgoingCommand>            m_sentReliableCommands;
-			std::list<OutgoingCommand>            m_sentUnreliableCommands;
+			CompressionStats                      m_compressionStats;
+			IncomingCommandList                   m_dispatchedCommands;
+			OutgoingCommandList                   m_outgoingReliableCommands;
+			OutgoingCommandList                   m_outgoingUnreliableCommands;
+			OutgoingCommandList                   m_sentReliableCommands;
+			OutgoingCommandList                   m_sentUnreliableCommands;
 			std::size_t                           m_totalWaitingData;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::vector<Acknowledgement>          m_acknowledgements;
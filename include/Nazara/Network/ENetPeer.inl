@@ -8,19 +8,19 @@
 
 namespace Nz
 {
-	inline ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
-	m_host(host),
-	m_incomingSessionID(0xFF),
-	m_outgoingSessionID(0xFF),
-	m_incomingPeerID(peerId),
-	m_isSimulationEnabled(false)
+	inline const IpAddress& ENetPeer::GetAddress() const
 	{
-		Reset();
+		return m_address;
 	}
 
-	inline const IpAddress& ENetPeer::GetAddress() const
+	inline const ENetPeer::CompressionStats& ENetPeer::GetCompressionStats() const
 	{
-		return m_address;
+		return m_compressionStats;
+	}
+
+	inline ENetHost* ENetPeer::GetHost() const
+	{
+		return m_host;
 	}
 
 	inline UInt32 ENetPeer::GetMtu() const
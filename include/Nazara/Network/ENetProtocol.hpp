@@ -27,6 +27,7 @@ namespace Nz
 	enum ENetConstants
 	{
 		ENetHost_BandwidthThrottleInterval = 1000,
+		ENetHost_DatagramBatchSize         = 32,
 		ENetHost_DefaultMaximumPacketSize  = 32 * 1024 * 1024,
 		ENetHost_DefaultMaximumWaitingData = 32 * 1024 * 1024,
 		ENetHost_DefaultMTU                = 1400,
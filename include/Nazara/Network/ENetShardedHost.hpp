@@ -0,0 +1,103 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETSHARDEDHOST_HPP
+#define NAZARA_ENETSHARDEDHOST_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/SpscQueue.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPacket.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class ENetPeer;
+
+	class NAZARA_NETWORK_API ENetShardedHost
+	{
+		public:
+			inline ENetShardedHost();
+			ENetShardedHost(const ENetShardedHost&) = delete;
+			ENetShardedHost(ENetShardedHost&&) = delete;
+			inline ~ENetShardedHost();
+
+			std::size_t Broadcast(UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet);
+
+			bool CheckEvents(ENetEvent* event);
+
+			inline bool Create(NetProtocol protocol, UInt16 port, std::size_t peerCount, std::size_t channelCount = 0, std::size_t shardCount = 0);
+			bool Create(const IpAddress& address, std::size_t peerCount, std::size_t channelCount = 0, std::size_t shardCount = 0);
+			void Destroy();
+
+			bool Disconnect(ENetPeer* peer, UInt32 data = 0);
+
+			inline const IpAddress& GetBoundAddress() const;
+			inline std::size_t GetShardCount() const;
+
+			bool Send(ENetPeer* peer, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet);
+
+			ENetShardedHost& operator=(const ENetShardedHost&) = delete;
+			ENetShardedHost& operator=(ENetShardedHost&&) = delete;
+
+		private:
+			enum class CommandType
+			{
+				Broadcast,
+				Disconnect,
+				Send
+			};
+
+			struct Command
+			{
+				CommandType type;
+				ENetPacketFlags flags;
+				ENetPeer* peer;
+				NetPacket packet;
+				UInt8 channelId;
+				UInt32 data;
+				UInt32 generation;
+			};
+
+			struct Shard
+			{
+				Shard(std::size_t peerCount);
+
+				ENetHost host;
+				SpscQueue<Command> commands;
+				SpscQueue<ENetEvent> events;
+				Thread thread;
+				std::vector<UInt32> knownGenerations; //< Disconnections of each peer seen by the user thread
+				std::vector<UInt32> peerGenerations;  //< Disconnections of each peer reported by the shard thread
+			};
+
+			Shard* GetShard(const ENetPeer* peer);
+
+			void ProcessCommands(Shard& shard);
+			bool PushCommand(Shard& shard, Command&& command);
+
+			void RunShard(Shard& shard);
+
+			static constexpr std::size_t CommandQueueSize = 4096;
+			static constexpr std::size_t EventQueueSize = 4096;
+			static constexpr UInt32 ServiceTimeout = 1; //< Milliseconds a shard waits for datagrams before processing user commands again
+
+			std::atomic<bool> m_isRunning;
+			std::size_t m_nextShard;
+			std::vector<std::unique_ptr<Shard>> m_shards;
+			IpAddress m_address;
+	};
+}
+
+#include <Nazara/Network/ENetShardedHost.inl>
+
+#endif // NAZARA_ENETSHARDEDHOST_HPP
@@ -0,0 +1,82 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline ENetShardedHost::ENetShardedHost() :
+	m_isRunning(false),
+	m_nextShard(0)
+	{
+	}
+
+	inline ENetShardedHost::~ENetShardedHost()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Creates the host, listening on a port of every interface
+	* \return true If the host was created
+	*
+	* \param protocol Net protocol to use
+	* \param port Port to listen on, or zero to let the system pick one
+	* \param peerCount Maximum number of peers of each shard
+	* \param channelCount Maximum number of channels of each peer
+	* \param shardCount Number of shards, zero to use one per hardware thread
+	*
+	* \see Create(const IpAddress&, std::size_t, std::size_t, std::size_t)
+	*/
+
+	inline bool ENetShardedHost::Create(NetProtocol protocol, UInt16 port, std::size_t peerCount, std::size_t channelCount, std::size_t shardCount)
+	{
+		NazaraAssert(protocol != NetProtocol_Any, "Any protocol not supported for Listen"); //< TODO
+		NazaraAssert(protocol != NetProtocol_Unknown, "Invalid protocol");
+
+		IpAddress any;
+		switch (protocol)
+		{
+			case NetProtocol_Any:
+			case NetProtocol_Unknown:
+				NazaraInternalError("Invalid protocol Any at this point");
+				return false;
+
+			case NetProtocol_IPv4:
+				any = IpAddress::AnyIpV4;
+				break;
+
+			case NetProtocol_IPv6:
+				any = IpAddress::AnyIpV6;
+				break;
+		}
+
+		any.SetPort(port);
+		return Create(any, peerCount, channelCount, shardCount);
+	}
+
+	/*!
+	* \brief Gets the address the shards are listening on
+	* \return Bound address, including the port picked by the system if none was specified
+	*/
+
+	inline const IpAddress& ENetShardedHost::GetBoundAddress() const
+	{
+		return m_address;
+	}
+
+	/*!
+	* \brief Gets the number of shards, each one being serviced by its own thread
+	* \return Shard count, which may be lower than requested if the system can't balance a port between several sockets
+	*/
+
+	inline std::size_t ENetShardedHost::GetShardCount() const
+	{
+		return m_shards.size();
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,25 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETDATAGRAM_HPP
+#define NAZARA_NETDATAGRAM_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+
+namespace Nz
+{
+	struct NetDatagram
+	{
+		IpAddress address;       //< Destination when sending, sender when receiving
+		NetBuffer* buffers;      //< Gathered into (or scattered from) a single datagram
+		std::size_t bufferCount;
+		std::size_t dataLength;  //< Size of the received datagram
+	};
+}
+
+#endif // NAZARA_NETDATAGRAM_HPP
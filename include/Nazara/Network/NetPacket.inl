@@ -55,9 +55,12 @@ namespace Nz
 	m_memoryStream(std::move(packet.m_memoryStream)),
 	m_netCode(packet.m_netCode)
 	{
-		///< Redirect memory stream to the moved buffer
-		m_memoryStream.SetBuffer(m_buffer.get(), m_memoryStream.GetOpenMode());
-		SetStream(&m_memoryStream);
+		///< Redirect memory stream to the moved buffer (an empty packet has no stream yet)
+		if (m_buffer)
+		{
+			m_memoryStream.SetBuffer(m_buffer.get(), m_memoryStream.GetOpenMode());
+			SetStream(&m_memoryStream);
+		}
 	}
 
 	/*!
@@ -205,9 +208,12 @@ namespace Nz
 		m_memoryStream = std::move(packet.m_memoryStream);
 		m_netCode = packet.m_netCode;
 		
-		///< Redirect memory stream to the moved buffer
-		m_memoryStream.SetBuffer(m_buffer.get(), m_memoryStream.GetOpenMode());
-		SetStream(&m_memoryStream);
+		///< Redirect memory stream to the moved buffer (an empty packet has no stream yet)
+		if (m_buffer)
+		{
+			m_memoryStream.SetBuffer(m_buffer.get(), m_memoryStream.GetOpenMode());
+			SetStream(&m_memoryStream);
+		}
 
 		return *this;
 	}
@@ -11,6 +11,7 @@
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 
 namespace Nz
 {
@@ -30,18 +31,22 @@ namespace Nz
 			inline bool Create(NetProtocol protocol);
 
 			void EnableBroadcasting(bool broadcasting);
+			bool EnableReusePort(bool reusePort = true);
 
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
 
 			inline bool IsBroadcastingEnabled() const;
+			inline bool IsReusePortEnabled() const;
 
 			std::size_t QueryMaxDatagramSize();
 
 			bool Receive(void* buffer, std::size_t size, IpAddress* from, std::size_t* received);
+			bool ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received);
 			bool ReceivePacket(NetPacket* packet, IpAddress* from);
 
 			bool Send(const IpAddress& to, const void* buffer, std::size_t size, std::size_t* sent);
+			bool SendDatagrams(const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent);
 			bool SendMultiple(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
 			bool SendPacket(const IpAddress& to, const NetPacket& packet);
 
@@ -51,6 +56,7 @@ namespace Nz
 
 			IpAddress m_boundAddress;
 			bool m_isBroadCastingEnabled;
+			bool m_isReusePortEnabled;
 	};
 }
 
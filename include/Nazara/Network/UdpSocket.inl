@@ -35,7 +35,9 @@ namespace Nz
 
 	inline UdpSocket::UdpSocket(UdpSocket&& udpSocket) :
 	AbstractSocket(std::move(udpSocket)),
-	m_boundAddress(std::move(udpSocket.m_boundAddress))
+	m_boundAddress(std::move(udpSocket.m_boundAddress)),
+	m_isBroadCastingEnabled(udpSocket.m_isBroadCastingEnabled),
+	m_isReusePortEnabled(udpSocket.m_isReusePortEnabled)
 	{
 	}
 
@@ -112,6 +114,18 @@ namespace Nz
 	{
 		return m_isBroadCastingEnabled;
 	}
+
+	/*!
+	* \brief Checks whether the socket shares its port with other sockets
+	* \return true If it is the case
+	*
+	* \see EnableReusePort
+	*/
+
+	inline bool UdpSocket::IsReusePortEnabled() const
+	{
+		return m_isReusePortEnabled;
+	}
 }
 
 #include <Nazara/Network/DebugOff.hpp>
@@ -8,12 +8,14 @@
 #define NAZARA_NODE_HPP
 
 #include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/LightSignal.hpp>
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Math/Quaternion.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/Enums.hpp>
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 
@@ -94,13 +96,14 @@ namespace Nz
 			Node& operator=(const Node& node);
 
 			// Signals:
-			NazaraSignal(OnNodeInvalidation, const Node* /*node*/);
+			NazaraLightSignal(OnNodeInvalidation, const Node* /*node*/);
 			NazaraSignal(OnNodeNewParent, const Node* /*node*/, const Node* /*parent*/);
 			NazaraSignal(OnNodeRelease, const Node* /*node*/);
 
 		protected:
 			void AddChild(Node* node) const;
 			virtual void InvalidateNode();
+			virtual void OnInvalidation();
 			virtual void OnParenting(const Node* parent);
 			void RemoveChild(Node* node) const;
 			virtual void UpdateDerived() const;
@@ -118,11 +121,11 @@ namespace Nz
 			Vector3f m_position;
 			Vector3f m_scale;
 			const Node* m_parent;
-			mutable bool m_derivedUpdated;
+			mutable std::atomic<bool> m_derivedUpdated;
 			bool m_inheritPosition;
 			bool m_inheritRotation;
 			bool m_inheritScale;
-			mutable bool m_transformMatrixUpdated;
+			mutable std::atomic<bool> m_transformMatrixUpdated;
 	};
 }
 
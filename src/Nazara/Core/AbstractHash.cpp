@@ -5,6 +5,7 @@
 #include <Nazara/Core/AbstractHash.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Hash/CRC32.hpp>
+#include <Nazara/Core/Hash/CRC32C.hpp>
 #include <Nazara/Core/Hash/Fletcher16.hpp>
 #include <Nazara/Core/Hash/MD5.hpp>
 #include <Nazara/Core/Hash/SHA1.hpp>
@@ -68,6 +69,9 @@ namespace Nz
 
 			case HashType_Whirlpool:
 				return std::make_unique<HashWhirlpool>();
+
+			case HashType_CRC32C:
+				return std::make_unique<HashCRC32C>();
 		}
 
 		NazaraInternalError("Hash type not handled (0x" + String::Number(type, 16) + ')');
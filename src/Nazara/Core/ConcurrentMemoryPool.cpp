@@ -0,0 +1,393 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <malloc.h>
+#else
+	#include <cstdlib>
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Number of blocks moved at once between the thread caches and the shared list
+		constexpr unsigned int BatchSize = 32;
+
+		struct Block
+		{
+			Block* next;
+			Block* nextBatch; //< Only meaningful for the first block of a batch
+		};
+
+		struct ChunkHeader
+		{
+			ConcurrentMemoryPoolImpl* owner;
+			ChunkHeader* next;
+		};
+
+		std::size_t AlignUp(std::size_t size, std::size_t alignment)
+		{
+			return (size + alignment - 1) / alignment * alignment;
+		}
+
+		void* AllocateAligned(std::size_t size)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			return _aligned_malloc(size, size);
+			#else
+			void* ptr;
+			if (posix_memalign(&ptr, size, size) != 0)
+				return nullptr;
+
+			return ptr;
+			#endif
+		}
+
+		void FreeAligned(void* ptr)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			_aligned_free(ptr);
+			#else
+			std::free(ptr);
+			#endif
+		}
+
+		std::atomic<UInt64> s_nextPoolId(0);
+	}
+
+	class ConcurrentMemoryPoolImpl
+	{
+		public:
+			ConcurrentMemoryPoolImpl(unsigned int blockSize, unsigned int blocksPerChunk);
+			~ConcurrentMemoryPoolImpl();
+
+			Block* AllocateChunk();
+			Block* PopBatch();
+			void PushBatches(Block* first, Block* last);
+
+			std::atomic<Block*> batches;
+			std::atomic<ChunkHeader*> chunks;
+			std::atomic<std::size_t> chunkCount;
+			std::atomic_flag popLock;
+			std::size_t blockSize;
+			std::size_t blocksPerChunk;
+			std::size_t chunkSize;
+			std::size_t headerSize;
+			UInt64 id;
+	};
+
+	namespace
+	{
+		struct LocalCache
+		{
+			UInt64 poolId;
+			std::weak_ptr<ConcurrentMemoryPoolImpl> pool;
+			Block* blocks;
+			std::size_t blockCount;
+		};
+
+		struct LocalCacheList
+		{
+			~LocalCacheList()
+			{
+				// Give our blocks back to the pools still alive, so other threads can use them
+				for (LocalCache& cache : caches)
+				{
+					if (!cache.blocks)
+						continue;
+
+					if (std::shared_ptr<ConcurrentMemoryPoolImpl> pool = cache.pool.lock())
+						pool->PushBatches(cache.blocks, cache.blocks);
+				}
+			}
+
+			std::vector<LocalCache> caches;
+			std::size_t lastUsed = 0;
+		};
+
+		thread_local LocalCacheList s_localCaches;
+
+		LocalCache& GetLocalCache(const std::shared_ptr<ConcurrentMemoryPoolImpl>& pool)
+		{
+			LocalCacheList& list = s_localCaches;
+			if (list.lastUsed < list.caches.size() && list.caches[list.lastUsed].poolId == pool->id)
+				return list.caches[list.lastUsed];
+
+			for (std::size_t i = 0; i < list.caches.size(); ++i)
+			{
+				if (list.caches[i].poolId == pool->id)
+				{
+					list.lastUsed = i;
+					return list.caches[i];
+				}
+			}
+
+			// First use of this pool by this thread, take the opportunity to forget about the destroyed ones
+			list.caches.erase(std::remove_if(list.caches.begin(), list.caches.end(), [](const LocalCache& cache) { return cache.pool.expired(); }), list.caches.end());
+			list.caches.push_back({pool->id, pool, nullptr, 0});
+			list.lastUsed = list.caches.size() - 1;
+
+			return list.caches.back();
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ConcurrentMemoryPool
+	* \brief Core class that represents a thread-safe pool of fixed-size blocks
+	*
+	* Unlike MemoryPool, this pool can be used from any thread, and a block may be freed by another thread than the one which allocated it.
+	*
+	* Each thread works on its own cache of free blocks, without any synchronization.
+	* Blocks are exchanged with a shared lock-free list by batches when a cache gets empty or too big, or when the thread exits.
+	* Memory is reserved by chunks aligned on their size, whose header is found from any block address by masking it, allowing Free to check ownership in constant time.
+	*
+	* \remark Chunks are only released when the pool is destroyed
+	* \see MemoryPool
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentMemoryPool object
+	*
+	* \param blockSize Size of the blocks (rounded up to respect the fundamental alignment)
+	* \param blocksPerChunk Minimal number of blocks reserved each time the pool has to grow
+	*/
+	ConcurrentMemoryPool::ConcurrentMemoryPool(unsigned int blockSize, unsigned int blocksPerChunk) :
+	m_impl(std::make_shared<ConcurrentMemoryPoolImpl>(blockSize, blocksPerChunk))
+	{
+	}
+
+	/*!
+	* \brief Allocates a block
+	* \return Pointer to a block of GetBlockSize() bytes, or nullptr if the pool failed to grow
+	*/
+	void* ConcurrentMemoryPool::Allocate()
+	{
+		LocalCache& cache = GetLocalCache(m_impl);
+		if (!cache.blocks)
+		{
+			Block* batch = m_impl->PopBatch();
+			if (!batch)
+			{
+				batch = m_impl->AllocateChunk();
+				if (!batch)
+				{
+					NazaraError("Failed to allocate pool chunk");
+					return nullptr;
+				}
+			}
+
+			cache.blocks = batch;
+			cache.blockCount = 0;
+			for (Block* block = batch; block; block = block->next)
+				cache.blockCount++;
+		}
+
+		Block* block = cache.blocks;
+		cache.blocks = block->next;
+		cache.blockCount--;
+
+		return block;
+	}
+
+	/*!
+	* \brief Frees a block
+	*
+	* \param ptr Pointer to a block allocated by this pool (from any thread)
+	*
+	* \remark Produces a NazaraError if the block does not belong to this pool with NAZARA_CORE_SAFE defined
+	* \remark If ptr is null, nothing is done
+	*/
+	void ConcurrentMemoryPool::Free(void* ptr)
+	{
+		if (!ptr)
+			return;
+
+		#if NAZARA_CORE_SAFE
+		if (!IsOwnerOf(ptr))
+		{
+			NazaraError("Invalid pointer (does not point to a block of the pool)");
+			return;
+		}
+		#endif
+
+		LocalCache& cache = GetLocalCache(m_impl);
+
+		Block* block = static_cast<Block*>(ptr);
+		block->next = cache.blocks;
+		cache.blocks = block;
+
+		if (++cache.blockCount >= 2 * BatchSize)
+		{
+			// Our cache is getting big, share a batch with the other threads
+			Block* last = block;
+			for (unsigned int i = 1; i < BatchSize; ++i)
+				last = last->next;
+
+			cache.blocks = last->next;
+			cache.blockCount -= BatchSize;
+
+			last->next = nullptr;
+			m_impl->PushBatches(block, block);
+		}
+	}
+
+	/*!
+	* \brief Gets the block size
+	* \return Size of the blocks
+	*/
+	unsigned int ConcurrentMemoryPool::GetBlockSize() const
+	{
+		return static_cast<unsigned int>(m_impl->blockSize);
+	}
+
+	/*!
+	* \brief Gets the number of blocks reserved each time the pool grows
+	* \return Number of blocks per chunk
+	*/
+	unsigned int ConcurrentMemoryPool::GetBlocksPerChunk() const
+	{
+		return static_cast<unsigned int>(m_impl->blocksPerChunk);
+	}
+
+	/*!
+	* \brief Gets the number of chunks reserved by the pool
+	* \return Number of chunks
+	*/
+	std::size_t ConcurrentMemoryPool::GetChunkCount() const
+	{
+		return m_impl->chunkCount.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Checks whether a block was allocated by this pool, in constant time
+	* \return true If the block belongs to this pool
+	*
+	* \param ptr Pointer to a block allocated by any ConcurrentMemoryPool
+	*/
+	bool ConcurrentMemoryPool::IsOwnerOf(const void* ptr) const
+	{
+		std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+		std::uintptr_t chunkAddress = address & ~static_cast<std::uintptr_t>(m_impl->chunkSize - 1);
+
+		const ChunkHeader* header = reinterpret_cast<const ChunkHeader*>(chunkAddress);
+		if (header->owner != m_impl.get())
+			return false;
+
+		std::uintptr_t offset = address - chunkAddress;
+		return offset >= m_impl->headerSize && (offset - m_impl->headerSize) % m_impl->blockSize == 0;
+	}
+
+	ConcurrentMemoryPoolImpl::ConcurrentMemoryPoolImpl(unsigned int blockSizeHint, unsigned int blocksPerChunkHint) :
+	batches(nullptr),
+	chunks(nullptr),
+	chunkCount(0),
+	id(s_nextPoolId++)
+	{
+		NazaraAssert(blocksPerChunkHint > 0, "Chunks must hold at least one block");
+
+		constexpr std::size_t alignment = alignof(std::max_align_t);
+
+		blockSize = AlignUp(std::max<std::size_t>(blockSizeHint, sizeof(Block)), alignment);
+		headerSize = AlignUp(sizeof(ChunkHeader), alignment);
+
+		// Chunks are aligned on their size, which must be a power of two
+		chunkSize = 1;
+		while (chunkSize < headerSize + blockSize * blocksPerChunkHint)
+			chunkSize <<= 1;
+
+		blocksPerChunk = (chunkSize - headerSize) / blockSize;
+
+		popLock.clear();
+	}
+
+	ConcurrentMemoryPoolImpl::~ConcurrentMemoryPoolImpl()
+	{
+		ChunkHeader* chunk = chunks.load(std::memory_order_acquire);
+		while (chunk)
+		{
+			ChunkHeader* next = chunk->next;
+			FreeAligned(chunk);
+
+			chunk = next;
+		}
+	}
+
+	Block* ConcurrentMemoryPoolImpl::AllocateChunk()
+	{
+		void* memory = AllocateAligned(chunkSize);
+		if (!memory)
+			return nullptr;
+
+		ChunkHeader* header = static_cast<ChunkHeader*>(memory);
+		header->owner = this;
+		header->next = chunks.load(std::memory_order_relaxed);
+		while (!chunks.compare_exchange_weak(header->next, header, std::memory_order_release, std::memory_order_relaxed));
+
+		chunkCount.fetch_add(1, std::memory_order_relaxed);
+
+		// Split the chunk in batches, keep the first one and share the others
+		UInt8* blocks = static_cast<UInt8*>(memory) + headerSize;
+		auto GetBlock = [&](std::size_t index) { return reinterpret_cast<Block*>(blocks + index * blockSize); };
+
+		Block* firstBatch = nullptr;
+		Block* lastBatch = nullptr;
+		for (std::size_t first = 0; first < blocksPerChunk; first += BatchSize)
+		{
+			std::size_t last = std::min<std::size_t>(first + BatchSize, blocksPerChunk) - 1;
+			for (std::size_t i = first; i < last; ++i)
+				GetBlock(i)->next = GetBlock(i + 1);
+
+			GetBlock(last)->next = nullptr;
+
+			Block* batch = GetBlock(first);
+			batch->nextBatch = nullptr;
+			if (lastBatch)
+				lastBatch->nextBatch = batch;
+			else
+				firstBatch = batch;
+
+			lastBatch = batch;
+		}
+
+		if (firstBatch->nextBatch)
+			PushBatches(firstBatch->nextBatch, lastBatch);
+
+		return firstBatch;
+	}
+
+	Block* ConcurrentMemoryPoolImpl::PopBatch()
+	{
+		// Pushing is lock-free, but concurrent pops would be subject to the ABA problem: serialize them
+		// (the critical section is a few instructions long and only reached once per batch)
+		while (popLock.test_and_set(std::memory_order_acquire))
+			std::this_thread::yield();
+
+		Block* batch = batches.load(std::memory_order_acquire);
+		while (batch && !batches.compare_exchange_weak(batch, batch->nextBatch, std::memory_order_acquire, std::memory_order_acquire));
+
+		popLock.clear(std::memory_order_release);
+
+		return batch;
+	}
+
+	void ConcurrentMemoryPoolImpl::PushBatches(Block* first, Block* last)
+	{
+		last->nextBatch = batches.load(std::memory_order_relaxed);
+		while (!batches.compare_exchange_weak(last->nextBatch, first, std::memory_order_release, std::memory_order_relaxed));
+	}
+}
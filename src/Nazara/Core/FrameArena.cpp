@@ -0,0 +1,159 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::FrameArena
+	* \brief Core class that represents a linear (bump-pointer) allocator for short-lived memory
+	*
+	* Allocating only moves a cursor forward, and nothing is freed individually: the whole arena is reset at once (typically at the end of a frame) in constant time.
+	* The memory reserved by the arena is kept between resets, so a frame allocating as much as the previous one will not reach the heap.
+	*
+	* \see FrameAllocator
+	*/
+
+	/*!
+	* \brief Constructs a FrameArena object
+	*
+	* \param blockSize Size of the memory blocks reserved when the arena needs more memory
+	*
+	* \remark No memory is reserved until the first allocation
+	*/
+	FrameArena::FrameArena(std::size_t blockSize) :
+	m_blockSize(blockSize),
+	m_currentBlock(0),
+	m_cursor(nullptr),
+	m_end(nullptr)
+	{
+		NazaraAssert(blockSize > 0, "Block size must be over zero");
+	}
+
+	/*!
+	* \brief Constructs a FrameArena object by moving another one
+	*
+	* \param arena FrameArena to move into this
+	*
+	* \remark The moved arena is left empty but usable
+	*/
+	FrameArena::FrameArena(FrameArena&& arena) noexcept :
+	m_blockSize(arena.m_blockSize),
+	m_currentBlock(arena.m_currentBlock),
+	m_blocks(std::move(arena.m_blocks)),
+	m_cursor(arena.m_cursor),
+	m_end(arena.m_end)
+	{
+		arena.m_blocks.clear();
+		arena.m_currentBlock = 0;
+		arena.m_cursor = nullptr;
+		arena.m_end = nullptr;
+	}
+
+	/*!
+	* \brief Gets the amount of memory reserved by the arena
+	* \return Reserved memory size in bytes
+	*/
+	std::size_t FrameArena::GetCapacity() const
+	{
+		std::size_t capacity = 0;
+		for (const Block& block : m_blocks)
+			capacity += block.size;
+
+		return capacity;
+	}
+
+	/*!
+	* \brief Gets the amount of memory used since the last reset
+	* \return Used memory size in bytes, including alignment padding and the unused ends of the filled blocks
+	*/
+	std::size_t FrameArena::GetUsedSize() const
+	{
+		if (m_blocks.empty())
+			return 0;
+
+		std::size_t usedSize = 0;
+		for (std::size_t i = 0; i < m_currentBlock; ++i)
+			usedSize += m_blocks[i].size;
+
+		return usedSize + (m_cursor - m_blocks[m_currentBlock].memory.get());
+	}
+
+	/*!
+	* \brief Frees every block of the arena
+	*
+	* \remark Every pointer returned by the arena gets invalid
+	*/
+	void FrameArena::Release()
+	{
+		m_blocks.clear();
+		m_currentBlock = 0;
+		m_cursor = nullptr;
+		m_end = nullptr;
+	}
+
+	/*!
+	* \brief Moves another arena into this one
+	* \return A reference to this
+	*
+	* \param arena FrameArena to move into this
+	*
+	* \remark Every pointer previously returned by this arena gets invalid, the moved arena is left empty but usable
+	*/
+	FrameArena& FrameArena::operator=(FrameArena&& arena) noexcept
+	{
+		if (this == &arena)
+			return *this;
+
+		m_blockSize = arena.m_blockSize;
+		m_blocks = std::move(arena.m_blocks);
+		m_currentBlock = arena.m_currentBlock;
+		m_cursor = arena.m_cursor;
+		m_end = arena.m_end;
+
+		arena.Release();
+
+		return *this;
+	}
+
+	void* FrameArena::AllocateSlow(std::size_t size, std::size_t alignment)
+	{
+		if (size > std::numeric_limits<std::size_t>::max() - (alignment - 1))
+		{
+			NazaraError("Allocation size overflow (" + String::Number(size) + ')');
+			return nullptr;
+		}
+
+		// Leave room to align the pointer whatever the alignment of the block is
+		std::size_t requiredSize = size + alignment - 1;
+
+		// Look for the next block (reserved by a previous frame) big enough
+		std::size_t nextBlock = (m_cursor) ? m_currentBlock + 1 : 0;
+		while (nextBlock < m_blocks.size() && m_blocks[nextBlock].size < requiredSize)
+			nextBlock++;
+
+		if (nextBlock == m_blocks.size())
+		{
+			Block block;
+			block.size = std::max(m_blockSize, requiredSize);
+			block.memory.reset(new UInt8[block.size]);
+
+			m_blocks.push_back(std::move(block));
+		}
+
+		// Blocks skipped by the search stay unused until the next reset
+		m_currentBlock = nextBlock;
+		m_cursor = m_blocks[nextBlock].memory.get();
+		m_end = m_cursor + m_blocks[nextBlock].size;
+
+		return Allocate(size, alignment);
+	}
+}
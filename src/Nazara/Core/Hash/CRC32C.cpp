@@ -0,0 +1,175 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Hash/CRC32C.hpp>
+#include <Nazara/Core/Endianness.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <array>
+#include <cstring>
+
+#if defined(NAZARA_PLATFORM_x64) || defined(__i386__) || defined(_M_IX86)
+	#define NAZARA_CRC32C_SSE42
+	#include <nmmintrin.h>
+
+	#if defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_CLANG)
+		#define NAZARA_CRC32C_SSE42_FUNCTION __attribute__((target("sse4.2")))
+	#else
+		#define NAZARA_CRC32C_SSE42_FUNCTION
+	#endif
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr UInt32 crc32c_polynomial = 0x82F63B78; //< Castagnoli polynomial (reversed)
+
+		struct CRC32CTables
+		{
+			CRC32CTables()
+			{
+				for (UInt32 i = 0; i < 256; ++i)
+				{
+					UInt32 crc = i;
+					for (unsigned int j = 0; j < 8; ++j)
+						crc = (crc >> 1) ^ ((crc & 1) ? crc32c_polynomial : 0);
+
+					tables[0][i] = crc;
+				}
+
+				// Each table gives the contribution of a byte one position further, which allows to process eight bytes at once
+				for (std::size_t i = 1; i < tables.size(); ++i)
+				{
+					for (UInt32 j = 0; j < 256; ++j)
+						tables[i][j] = (tables[i - 1][j] >> 8) ^ tables[0][tables[i - 1][j] & 0xFF];
+				}
+			}
+
+			std::array<std::array<UInt32, 256>, 8> tables;
+		};
+
+		UInt32 crc32c_software(UInt32 crc, const UInt8* data, std::size_t len)
+		{
+			static const CRC32CTables crcTables;
+			const auto& tables = crcTables.tables;
+
+			for (; len >= 8; len -= 8, data += 8)
+			{
+				UInt32 first = crc ^ (UInt32(data[0]) | (UInt32(data[1]) << 8) | (UInt32(data[2]) << 16) | (UInt32(data[3]) << 24));
+				UInt32 second = UInt32(data[4]) | (UInt32(data[5]) << 8) | (UInt32(data[6]) << 16) | (UInt32(data[7]) << 24);
+
+				crc = tables[7][first & 0xFF] ^ tables[6][(first >> 8) & 0xFF] ^ tables[5][(first >> 16) & 0xFF] ^ tables[4][first >> 24] ^
+				      tables[3][second & 0xFF] ^ tables[2][(second >> 8) & 0xFF] ^ tables[1][(second >> 16) & 0xFF] ^ tables[0][second >> 24];
+			}
+
+			while (len--)
+				crc = tables[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+
+			return crc;
+		}
+
+		#ifdef NAZARA_CRC32C_SSE42
+		bool crc32c_hasHardwareSupport()
+		{
+			static bool hasSSE42 = HardwareInfo::Initialize() && HardwareInfo::HasCapability(ProcessorCap_SSE42);
+			return hasSSE42;
+		}
+
+		NAZARA_CRC32C_SSE42_FUNCTION UInt32 crc32c_hardware(UInt32 crc, const UInt8* data, std::size_t len)
+		{
+			#ifdef NAZARA_PLATFORM_x64
+			UInt64 crc64 = crc;
+			for (; len >= 8; len -= 8, data += 8)
+			{
+				UInt64 value;
+				std::memcpy(&value, data, sizeof(UInt64));
+
+				crc64 = _mm_crc32_u64(crc64, value);
+			}
+
+			crc = static_cast<UInt32>(crc64);
+			#endif
+
+			for (; len >= 4; len -= 4, data += 4)
+			{
+				UInt32 value;
+				std::memcpy(&value, data, sizeof(UInt32));
+
+				crc = _mm_crc32_u32(crc, value);
+			}
+
+			while (len--)
+				crc = _mm_crc32_u8(crc, *data++);
+
+			return crc;
+		}
+		#endif
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::HashCRC32C
+	* \brief Core class that represents the CRC32C (Castagnoli) hash
+	*
+	* Uses the SSE4.2 crc32 instruction when the processor supports it, and a slicing-by-8 table implementation otherwise.
+	*/
+
+	void HashCRC32C::Append(const UInt8* data, std::size_t len)
+	{
+		m_crc = Compute(data, len, m_crc);
+	}
+
+	void HashCRC32C::Begin()
+	{
+		m_crc = 0;
+	}
+
+	ByteArray HashCRC32C::End()
+	{
+		UInt32 crc = m_crc;
+
+		#ifdef NAZARA_LITTLE_ENDIAN
+		SwapBytes(&crc, sizeof(UInt32));
+		#endif
+
+		return ByteArray(reinterpret_cast<UInt8*>(&crc), 4);
+	}
+
+	std::size_t HashCRC32C::GetDigestLength() const
+	{
+		return 4;
+	}
+
+	const char* HashCRC32C::GetHashName() const
+	{
+		return "CRC32C";
+	}
+
+	/*!
+	* \brief Computes the CRC32C of a block of data
+	* \return CRC32C of the data following the one given in parameter
+	*
+	* \param data Data to compute the CRC of
+	* \param len Size of the data
+	* \param crc CRC of the previous data, allowing to compute the CRC of discontiguous data in multiple calls (0 for the first one)
+	*/
+
+	UInt32 HashCRC32C::Compute(const void* data, std::size_t len, UInt32 crc)
+	{
+		const UInt8* ptr = static_cast<const UInt8*>(data);
+
+		crc = ~crc;
+
+		#ifdef NAZARA_CRC32C_SSE42
+		if (crc32c_hasHardwareSupport())
+			crc = crc32c_hardware(crc, ptr, len);
+		else
+		#endif
+			crc = crc32c_software(crc, ptr, len);
+
+		return ~crc;
+	}
+}
@@ -3,9 +3,11 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/MemoryManager.hpp>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <mutex>
 #include <new>
 #include <stdexcept>
 
@@ -23,6 +25,8 @@ namespace Nz
 	{
 		constexpr unsigned int s_allocatedId = 0xDEADB33FUL;
 		constexpr unsigned int s_freedId = 0x4B1DUL;
+		constexpr std::size_t s_callSiteMaxProbe = 16;
+		constexpr std::size_t s_callSiteTableSize = 1024; //< Must be a power of two
 
 		struct Block
 		{
@@ -35,8 +39,37 @@ namespace Nz
 			unsigned int magic;
 		};
 
+		struct CallSite
+		{
+			std::atomic<bool> claimed;
+			std::atomic<bool> ready; //< file and line are set
+			const char* file;
+			unsigned int line;
+			std::atomic<UInt64> allocatedSize;
+			std::atomic<UInt64> allocationCount;
+			std::atomic<UInt64> freeCount;
+			std::atomic<UInt64> freedSize;
+		};
+
+		// Statistics of the call sites, one table per thread to avoid sharing cache lines between them
+		struct StatisticsTable
+		{
+			CallSite callSites[s_callSiteTableSize];
+			CallSite overflow; //< Call sites which did not find a place in the table
+			StatisticsTable* next;
+			std::atomic<bool> inUse;
+		};
+
+		struct StatisticsTableOwner
+		{
+			~StatisticsTableOwner();
+
+			StatisticsTable* table = nullptr;
+		};
+
 		bool s_allocationFilling = true;
 		bool s_allocationLogging = false;
+		std::atomic<bool> s_allocationStatistics(false);
 		bool s_initialized = false;
 		const char* s_logFileName = "NazaraMemory.log";
 		thread_local const char* s_nextFreeFile = "(Internal error)";
@@ -57,6 +90,16 @@ namespace Nz
 		unsigned int s_allocatedBlock = 0;
 		std::size_t s_allocatedSize = 0;
 
+		std::atomic<StatisticsTable*> s_statisticsTables(nullptr);
+		StatisticsTable s_sharedStatisticsTable; //< Used by exiting threads
+		thread_local StatisticsTable* s_threadStatisticsTable = nullptr;
+		thread_local bool s_threadStatisticsReleased = false;
+		thread_local StatisticsTableOwner s_threadStatisticsOwner;
+
+		std::mutex s_frameMutex;
+		MemoryManager::CallSiteStatistics* s_frameSnapshot = nullptr;
+		std::size_t s_frameSnapshotSize = 0;
+
 		#if defined(NAZARA_PLATFORM_WINDOWS)
 		CRITICAL_SECTION s_mutex;
 		#elif defined(NAZARA_PLATFORM_POSIX)
@@ -64,12 +107,206 @@ namespace Nz
 		#else
 		#error Lack of implementation: Mutex
 		#endif
+
+		StatisticsTableOwner::~StatisticsTableOwner()
+		{
+			// Let another thread reuse our table, the allocations made after this point are counted in the shared table
+			if (table && table != &s_sharedStatisticsTable)
+				table->inUse.store(false, std::memory_order_release);
+
+			s_threadStatisticsTable = nullptr;
+			s_threadStatisticsReleased = true;
+		}
+
+		StatisticsTable* AcquireStatisticsTable()
+		{
+			// Reuse the table of an exited thread if possible (statistics are per call site, not per thread)
+			for (StatisticsTable* table = s_statisticsTables.load(std::memory_order_acquire); table; table = table->next)
+			{
+				bool expected = false;
+				if (!table->inUse.load(std::memory_order_relaxed) && table->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+					return table;
+			}
+
+			// Memory is zeroed by calloc, which is a valid initial state for every field
+			StatisticsTable* table = static_cast<StatisticsTable*>(std::calloc(1, sizeof(StatisticsTable)));
+			if (!table)
+				return &s_sharedStatisticsTable;
+
+			table->inUse.store(true, std::memory_order_relaxed);
+			table->next = s_statisticsTables.load(std::memory_order_relaxed);
+			while (!s_statisticsTables.compare_exchange_weak(table->next, table, std::memory_order_release, std::memory_order_relaxed));
+
+			return table;
+		}
+
+		CallSite* FindCallSite(const char* file, unsigned int line)
+		{
+			StatisticsTable* table = s_threadStatisticsTable;
+			if (!table)
+			{
+				if (s_threadStatisticsReleased)
+					table = &s_sharedStatisticsTable; // This thread is exiting
+				else
+				{
+					table = AcquireStatisticsTable();
+
+					s_threadStatisticsTable = table;
+					s_threadStatisticsOwner.table = table;
+				}
+			}
+
+			std::size_t index = (reinterpret_cast<std::uintptr_t>(file) / sizeof(void*) * 31 + line) & (s_callSiteTableSize - 1);
+			for (std::size_t i = 0; i < s_callSiteMaxProbe; ++i)
+			{
+				CallSite& callSite = table->callSites[(index + i) & (s_callSiteTableSize - 1)];
+				if (callSite.ready.load(std::memory_order_acquire))
+				{
+					if (callSite.file == file && callSite.line == line)
+						return &callSite;
+				}
+				else
+				{
+					// The shared table may be used by multiple threads, claim the entry before setting it
+					bool expected = false;
+					if (!callSite.claimed.load(std::memory_order_relaxed) && callSite.claimed.compare_exchange_strong(expected, true, std::memory_order_acquire))
+					{
+						callSite.file = file;
+						callSite.line = line;
+						callSite.ready.store(true, std::memory_order_release);
+
+						return &callSite;
+					}
+				}
+			}
+
+			return &table->overflow;
+		}
+
+		int CompareCallSites(const void* first, const void* second)
+		{
+			const MemoryManager::CallSiteStatistics* lhs = static_cast<const MemoryManager::CallSiteStatistics*>(first);
+			const MemoryManager::CallSiteStatistics* rhs = static_cast<const MemoryManager::CallSiteStatistics*>(second);
+
+			if (lhs->file != rhs->file)
+			{
+				if (!lhs->file || !rhs->file)
+					return (lhs->file) ? 1 : -1;
+
+				if (int cmp = std::strcmp(lhs->file, rhs->file))
+					return cmp;
+			}
+
+			if (lhs->line != rhs->line)
+				return (lhs->line < rhs->line) ? -1 : 1;
+
+			return 0;
+		}
+
+		template<typename F>
+		void ForEachStatisticsTable(const F& func)
+		{
+			func(s_sharedStatisticsTable);
+			for (StatisticsTable* table = s_statisticsTables.load(std::memory_order_acquire); table; table = table->next)
+				func(*table);
+		}
+
+		// Merges the tables of every thread in a sorted array allocated by malloc (as we cannot rely on operator new here)
+		MemoryManager::CallSiteStatistics* CollectStatistics(std::size_t* count)
+		{
+			std::size_t capacity = 0;
+			ForEachStatisticsTable([&](StatisticsTable&) { capacity += s_callSiteTableSize + 1; });
+
+			MemoryManager::CallSiteStatistics* callSites = static_cast<MemoryManager::CallSiteStatistics*>(std::malloc(capacity * sizeof(MemoryManager::CallSiteStatistics)));
+			if (!callSites)
+			{
+				*count = 0;
+				return nullptr;
+			}
+
+			std::size_t callSiteCount = 0;
+			auto AddCallSite = [&](const CallSite& callSite, const char* file, unsigned int line)
+			{
+				if (callSiteCount == capacity)
+					return; // A table was added since we counted them
+
+				MemoryManager::CallSiteStatistics& statistics = callSites[callSiteCount++];
+				statistics.file = file;
+				statistics.line = line;
+				statistics.allocatedSize = callSite.allocatedSize.load(std::memory_order_relaxed);
+				statistics.allocationCount = callSite.allocationCount.load(std::memory_order_relaxed);
+				statistics.frameAllocatedSize = 0;
+				statistics.frameAllocationCount = 0;
+				statistics.freeCount = callSite.freeCount.load(std::memory_order_relaxed);
+				statistics.freedSize = callSite.freedSize.load(std::memory_order_relaxed);
+			};
+
+			ForEachStatisticsTable([&](StatisticsTable& table)
+			{
+				for (const CallSite& callSite : table.callSites)
+				{
+					if (callSite.ready.load(std::memory_order_acquire))
+						AddCallSite(callSite, callSite.file, callSite.line);
+				}
+
+				if (table.overflow.allocationCount.load(std::memory_order_relaxed) > 0 || table.overflow.freeCount.load(std::memory_order_relaxed) > 0)
+					AddCallSite(table.overflow, nullptr, 0);
+			});
+
+			// The same call site may appear in multiple tables
+			std::qsort(callSites, callSiteCount, sizeof(MemoryManager::CallSiteStatistics), CompareCallSites);
+
+			std::size_t mergedCount = 0;
+			for (std::size_t i = 0; i < callSiteCount; ++i)
+			{
+				if (mergedCount > 0 && CompareCallSites(&callSites[mergedCount - 1], &callSites[i]) == 0)
+				{
+					MemoryManager::CallSiteStatistics& statistics = callSites[mergedCount - 1];
+					statistics.allocatedSize += callSites[i].allocatedSize;
+					statistics.allocationCount += callSites[i].allocationCount;
+					statistics.freeCount += callSites[i].freeCount;
+					statistics.freedSize += callSites[i].freedSize;
+				}
+				else
+					callSites[mergedCount++] = callSites[i];
+			}
+
+			*count = mergedCount;
+			return callSites;
+		}
+
+		void SumStatistics(UInt64* allocationCount, UInt64* allocatedSize, UInt64* freeCount, UInt64* freedSize)
+		{
+			*allocationCount = 0;
+			*allocatedSize = 0;
+			*freeCount = 0;
+			*freedSize = 0;
+
+			auto AddCallSite = [&](const CallSite& callSite)
+			{
+				*allocationCount += callSite.allocationCount.load(std::memory_order_relaxed);
+				*allocatedSize += callSite.allocatedSize.load(std::memory_order_relaxed);
+				*freeCount += callSite.freeCount.load(std::memory_order_relaxed);
+				*freedSize += callSite.freedSize.load(std::memory_order_relaxed);
+			};
+
+			ForEachStatisticsTable([&](StatisticsTable& table)
+			{
+				for (const CallSite& callSite : table.callSites)
+					AddCallSite(callSite);
+
+				AddCallSite(table.overflow);
+			});
+		}
 	}
 	
 	/*!
 	* \ingroup core
 	* \class Nz::MemoryManager
 	* \brief Core class that represents a manager for the memory
+	*
+	* By default, every allocation is tracked in a global list (protected by a mutex) to report leaks when the application exits, and can be logged.
+	* The statistics mode (see EnableAllocationStatistics) is meant to be used under load instead: allocations are only counted per call site, in tables local to each thread, which are merged when queried.
 	*/
 
 	/*!
@@ -104,12 +341,6 @@ namespace Nz
 		if (!s_initialized)
 			Initialize();
 
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		EnterCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_lock(&s_mutex);
-		#endif
-
 		Block* ptr = static_cast<Block*>(std::malloc(size+sizeof(Block)));
 		if (!ptr)
 		{
@@ -134,6 +365,31 @@ namespace Nz
 		ptr->size = size;
 		ptr->magic = s_allocatedId;
 
+		if (s_allocationFilling)
+		{
+			UInt8* data = reinterpret_cast<UInt8*>(ptr) + sizeof(Block);
+			std::memset(data, 0xFF, size);
+		}
+
+		if (s_allocationStatistics.load(std::memory_order_relaxed))
+		{
+			// Blocks allocated in statistics mode are not part of the leak list
+			ptr->prev = nullptr;
+			ptr->next = nullptr;
+
+			CallSite* callSite = FindCallSite(file, line);
+			callSite->allocatedSize.fetch_add(size, std::memory_order_relaxed);
+			callSite->allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+			return reinterpret_cast<UInt8*>(ptr) + sizeof(Block);
+		}
+
+		#if defined(NAZARA_PLATFORM_WINDOWS)
+		EnterCriticalSection(&s_mutex);
+		#elif defined(NAZARA_PLATFORM_POSIX)
+		pthread_mutex_lock(&s_mutex);
+		#endif
+
 		ptr->prev = s_list.prev;
 		ptr->next = &s_list;
 		s_list.prev->next = ptr;
@@ -143,12 +399,6 @@ namespace Nz
 		s_allocatedSize += size;
 		s_allocationCount++;
 
-		if (s_allocationFilling)
-		{
-			UInt8* data = reinterpret_cast<UInt8*>(ptr) + sizeof(Block);
-			std::memset(data, 0xFF, size);
-		}
-
 		if (s_allocationLogging)
 		{
 			char timeStr[23];
@@ -195,6 +445,21 @@ namespace Nz
 		s_allocationLogging = logAllocations;
 	}
 
+	/*!
+	* \brief Enables the statistics mode
+	*
+	* \param allocationStatistics If true, allocations are no longer tracked individually (nor logged) but counted per call site without any global lock
+	*
+	* \remark Blocks allocated before the call are still tracked, and so reported as leaks if never freed
+	* \remark Allocation filling has a cost, consider disabling it with the statistics mode
+	* \see GetCallSiteStatistics
+	*/
+
+	void MemoryManager::EnableAllocationStatistics(bool allocationStatistics)
+	{
+		s_allocationStatistics.store(allocationStatistics, std::memory_order_relaxed);
+	}
+
 	/*!
 	* \brief Frees the pointer
 	*
@@ -227,14 +492,15 @@ namespace Nz
 			return;
 		}
 
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		EnterCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_lock(&s_mutex);
-		#endif
-
 		if (ptr->array != multi)
 		{
+			// Reporting goes through the log file, which is shared with every other thread
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			EnterCriticalSection(&s_mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_lock(&s_mutex);
+			#endif
+
 			char timeStr[23];
 			TimeInfo(timeStr);
 
@@ -247,14 +513,43 @@ namespace Nz
 				std::fprintf(log, "%s Warning: %s at unknown position\n", timeStr, error);
 
 			std::fclose(log);
+
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			LeaveCriticalSection(&s_mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_unlock(&s_mutex);
+			#endif
 		}
 
 		ptr->magic = s_freedId;
-		ptr->prev->next = ptr->next;
-		ptr->next->prev = ptr->prev;
 
-		s_allocatedBlock--;
-		s_allocatedSize -= ptr->size;
+		if (ptr->prev)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			EnterCriticalSection(&s_mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_lock(&s_mutex);
+			#endif
+
+			ptr->prev->next = ptr->next;
+			ptr->next->prev = ptr->prev;
+
+			s_allocatedBlock--;
+			s_allocatedSize -= ptr->size;
+
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			LeaveCriticalSection(&s_mutex);
+			#elif defined(NAZARA_PLATFORM_POSIX)
+			pthread_mutex_unlock(&s_mutex);
+			#endif
+		}
+		else
+		{
+			// Allocated in statistics mode
+			CallSite* callSite = FindCallSite(ptr->file, ptr->line);
+			callSite->freeCount.fetch_add(1, std::memory_order_relaxed);
+			callSite->freedSize.fetch_add(ptr->size, std::memory_order_relaxed);
+		}
 
 		if (s_allocationFilling)
 		{
@@ -266,12 +561,6 @@ namespace Nz
 
 		s_nextFreeFile = nullptr;
 		s_nextFreeLine = 0;
-
-		#if defined(NAZARA_PLATFORM_WINDOWS)
-		LeaveCriticalSection(&s_mutex);
-		#elif defined(NAZARA_PLATFORM_POSIX)
-		pthread_mutex_unlock(&s_mutex);
-		#endif
 	}
 
 	/*!
@@ -281,7 +570,10 @@ namespace Nz
 
 	unsigned int MemoryManager::GetAllocatedBlockCount()
 	{
-		return s_allocatedBlock;
+		UInt64 allocationCount, allocatedSize, freeCount, freedSize;
+		SumStatistics(&allocationCount, &allocatedSize, &freeCount, &freedSize);
+
+		return s_allocatedBlock + static_cast<unsigned int>(allocationCount - freeCount);
 	}
 
 	/*!
@@ -291,7 +583,10 @@ namespace Nz
 
 	std::size_t MemoryManager::GetAllocatedSize()
 	{
-		return s_allocatedSize;
+		UInt64 allocationCount, allocatedSize, freeCount, freedSize;
+		SumStatistics(&allocationCount, &allocatedSize, &freeCount, &freedSize);
+
+		return s_allocatedSize + static_cast<std::size_t>(allocatedSize - freedSize);
 	}
 
 	/*!
@@ -301,7 +596,49 @@ namespace Nz
 
 	unsigned int MemoryManager::GetAllocationCount()
 	{
-		return s_allocationCount;
+		UInt64 allocationCount, allocatedSize, freeCount, freedSize;
+		SumStatistics(&allocationCount, &allocatedSize, &freeCount, &freedSize);
+
+		return s_allocationCount + static_cast<unsigned int>(allocationCount);
+	}
+
+	/*!
+	* \brief Gets the statistics of every call site which allocated memory in statistics mode
+	*
+	* \param statistics Pointer to a vector which will be filled with the statistics, sorted by file and line
+	*
+	* \remark Frame counters are relative to the last call to NextFrame
+	* \see EnableAllocationStatistics
+	*/
+
+	void MemoryManager::GetCallSiteStatistics(std::vector<CallSiteStatistics>* statistics)
+	{
+		std::size_t callSiteCount;
+		CallSiteStatistics* callSites = CollectStatistics(&callSiteCount);
+
+		{
+			std::lock_guard<std::mutex> lock(s_frameMutex);
+			for (std::size_t i = 0; i < callSiteCount; ++i)
+			{
+				CallSiteStatistics& callSite = callSites[i];
+
+				const void* previous = std::bsearch(&callSite, s_frameSnapshot, s_frameSnapshotSize, sizeof(CallSiteStatistics), CompareCallSites);
+				if (previous)
+				{
+					const CallSiteStatistics& previousCallSite = *static_cast<const CallSiteStatistics*>(previous);
+					callSite.frameAllocatedSize = callSite.allocatedSize - previousCallSite.allocatedSize;
+					callSite.frameAllocationCount = callSite.allocationCount - previousCallSite.allocationCount;
+				}
+				else
+				{
+					callSite.frameAllocatedSize = callSite.allocatedSize;
+					callSite.frameAllocationCount = callSite.allocationCount;
+				}
+			}
+		}
+
+		statistics->assign(callSites, callSites + callSiteCount);
+		std::free(callSites);
 	}
 
 	/*!
@@ -324,6 +661,34 @@ namespace Nz
 		return s_allocationLogging;
 	}
 
+	/*!
+	* \brief Checks whether the statistics mode is enabled
+	* \return true if allocations are counted per call site
+	*/
+
+	bool MemoryManager::IsAllocationStatisticsEnabled()
+	{
+		return s_allocationStatistics.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Starts a new frame for the call site statistics
+	*
+	* Frame counters returned by GetCallSiteStatistics are relative to the last call to this function.
+	*/
+
+	void MemoryManager::NextFrame()
+	{
+		std::size_t callSiteCount;
+		CallSiteStatistics* callSites = CollectStatistics(&callSiteCount);
+
+		std::lock_guard<std::mutex> lock(s_frameMutex);
+		std::free(s_frameSnapshot);
+
+		s_frameSnapshot = callSites;
+		s_frameSnapshotSize = callSiteCount;
+	}
+
 	/*!
 	* \brief Sets the next free
 	*
@@ -426,6 +791,32 @@ namespace Nz
 			std::fprintf(log, "\n%u blocks leaked (%zu bytes)", s_allocatedBlock, s_allocatedSize);
 		}
 
+		std::size_t callSiteCount;
+		CallSiteStatistics* callSites = CollectStatistics(&callSiteCount);
+
+		bool headerWritten = false;
+		for (std::size_t i = 0; i < callSiteCount; ++i)
+		{
+			const CallSiteStatistics& callSite = callSites[i];
+			if (callSite.allocationCount != callSite.freeCount)
+			{
+				if (!headerWritten)
+				{
+					std::fputs("\n\nBlocks allocated in statistics mode and never freed, per call site:\n", log);
+					headerWritten = true;
+				}
+
+				unsigned long long blockCount = callSite.allocationCount - callSite.freeCount;
+				unsigned long long size = callSite.allocatedSize - callSite.freedSize;
+				if (callSite.file)
+					std::fprintf(log, "-%s:%u -> %llu blocks (%llu bytes)\n", callSite.file, callSite.line, blockCount, size);
+				else
+					std::fprintf(log, "-unknown position -> %llu blocks (%llu bytes)\n", blockCount, size);
+			}
+		}
+
+		std::free(callSites);
+
 		std::fclose(log);
 	}
 }
@@ -29,6 +29,25 @@ namespace Nz
 		pthread_join(m_handle, nullptr);
 	}
 
+	void ThreadImpl::SetAffinity(UInt64 cpuMask)
+	{
+#if defined(NAZARA_PLATFORM_LINUX)
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		for (unsigned int i = 0; i < 64 && i < CPU_SETSIZE; ++i)
+		{
+			if (cpuMask & (UInt64(1) << i))
+				CPU_SET(i, &cpuSet);
+		}
+
+		int error = pthread_setaffinity_np(m_handle, sizeof(cpu_set_t), &cpuSet);
+		if (error != 0)
+			NazaraError("Failed to set thread affinity: " + Error::GetLastSystemError(error));
+#else
+		NazaraWarning("Setting thread affinity is not supported on this platform");
+#endif
+	}
+
 	void ThreadImpl::SetName(const Nz::String& name)
 	{
 #ifdef __GNUC__
@@ -0,0 +1,306 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct ZoneEvent
+		{
+			std::atomic<const char*> name;
+			std::atomic<UInt64> start;
+			std::atomic<UInt64> end;
+		};
+
+		// Ring buffer written by its thread only, and read when exporting
+		struct ThreadBuffer
+		{
+			ThreadBuffer(std::size_t eventCount) :
+			events(new ZoneEvent[eventCount]),
+			capacity(eventCount),
+			clearIndex(0),
+			writeIndex(0),
+			inUse(true)
+			{
+			}
+
+			std::unique_ptr<ZoneEvent[]> events;
+			std::size_t capacity;
+			std::atomic<UInt64> clearIndex;
+			std::atomic<UInt64> writeIndex;
+			std::atomic<bool> inUse;
+			String name;
+			unsigned int threadId;
+		};
+
+		struct ThreadBufferOwner
+		{
+			~ThreadBufferOwner();
+
+			ThreadBuffer* buffer = nullptr;
+		};
+
+		Mutex s_bufferMutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+		std::size_t s_bufferSize = 16 * 1024;
+		unsigned int s_nextThreadId = 0;
+		thread_local ThreadBuffer* s_threadBuffer = nullptr;
+		thread_local ThreadBufferOwner s_threadBufferOwner;
+
+		ThreadBufferOwner::~ThreadBufferOwner()
+		{
+			// Our buffer may be reused by another thread
+			if (buffer)
+				buffer->inUse.store(false, std::memory_order_release);
+
+			s_threadBuffer = nullptr;
+		}
+
+		ThreadBuffer* GetThreadBuffer()
+		{
+			if (s_threadBuffer)
+				return s_threadBuffer;
+
+			LockGuard lock(s_bufferMutex);
+
+			ThreadBuffer* buffer = nullptr;
+			for (auto& bufferPtr : s_buffers)
+			{
+				if (!bufferPtr->inUse.load(std::memory_order_acquire) && bufferPtr->capacity == s_bufferSize)
+				{
+					// Events of the exited thread are dropped
+					buffer = bufferPtr.get();
+					buffer->clearIndex.store(buffer->writeIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					buffer->inUse.store(true, std::memory_order_relaxed);
+					buffer->name.Clear();
+					break;
+				}
+			}
+
+			if (!buffer)
+			{
+				s_buffers.emplace_back(new ThreadBuffer(s_bufferSize));
+				buffer = s_buffers.back().get();
+			}
+
+			buffer->threadId = s_nextThreadId++;
+
+			s_threadBuffer = buffer;
+			s_threadBufferOwner.buffer = buffer;
+
+			return buffer;
+		}
+
+		void WriteJsonString(StringStream& stream, const char* str)
+		{
+			stream << '"';
+			for (; *str; ++str)
+			{
+				char c = *str;
+				if (c == '"' || c == '\\')
+					stream << '\\' << c;
+				else if (static_cast<unsigned char>(c) < 0x20)
+					stream << ' ';
+				else
+					stream << c;
+			}
+			stream << '"';
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Profiler
+	* \brief Core class that records the duration of zones (see NazaraProfileZone) and exports them
+	*
+	* Each thread records its zones in its own ring buffer, without any lock, keeping only the most recent ones once it is full.
+	* While disabled, a zone only costs a branch (and nothing if NAZARA_CORE_PROFILER is disabled).
+	*
+	* Recorded zones can be exported in the Chrome trace event format, to be inspected with chrome://tracing or similar tools.
+	*/
+
+	/*!
+	* \brief Forgets every recorded zone
+	*/
+	void Profiler::Clear()
+	{
+		LockGuard lock(s_bufferMutex);
+
+		for (auto& bufferPtr : s_buffers)
+			bufferPtr->clearIndex.store(bufferPtr->writeIndex.load(std::memory_order_acquire), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Enables or disables the recording of zones
+	*
+	* \param enable Should the zones be recorded
+	*
+	* \remark Zones started while the profiler was disabled are not recorded
+	*/
+	void Profiler::Enable(bool enable)
+	{
+		s_enabled.store(enable, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Exports recorded zones in the Chrome trace event format to a file
+	* \return true If the file was written successfully
+	*
+	* \param filePath Path of the file, which will be truncated
+	*/
+	bool Profiler::ExportChromeTrace(const String& filePath)
+	{
+		File file(filePath);
+		if (!file.Open(OpenMode_WriteOnly | OpenMode_Truncate))
+		{
+			NazaraError("Failed to open \"" + filePath + '"');
+			return false;
+		}
+
+		return ExportChromeTrace(file);
+	}
+
+	/*!
+	* \brief Exports recorded zones in the Chrome trace event format to a stream
+	* \return true If the trace was written successfully
+	*
+	* \param stream Stream to write the trace to
+	*
+	* \remark Threads may keep recording zones while exporting
+	*/
+	bool Profiler::ExportChromeTrace(Stream& stream)
+	{
+		StringStream trace;
+		trace << "{\"traceEvents\":[";
+
+		bool first = true;
+		auto NextEvent = [&]()
+		{
+			if (!first)
+				trace << ",\n";
+
+			first = false;
+		};
+
+		{
+			LockGuard lock(s_bufferMutex);
+
+			for (auto& bufferPtr : s_buffers)
+			{
+				ThreadBuffer& buffer = *bufferPtr;
+
+				if (!buffer.name.IsEmpty())
+				{
+					NextEvent();
+					trace << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer.threadId << ",\"args\":{\"name\":";
+					WriteJsonString(trace, buffer.name.GetConstBuffer());
+					trace << "}}";
+				}
+
+				UInt64 writeIndex = buffer.writeIndex.load(std::memory_order_acquire);
+				UInt64 firstIndex = std::max<UInt64>(buffer.clearIndex.load(std::memory_order_relaxed), (writeIndex > buffer.capacity) ? writeIndex - buffer.capacity : 0);
+
+				struct Zone
+				{
+					const char* name;
+					UInt64 start;
+					UInt64 end;
+				};
+
+				std::vector<Zone> zones;
+				zones.reserve(static_cast<std::size_t>(writeIndex - firstIndex));
+				for (UInt64 i = firstIndex; i < writeIndex; ++i)
+				{
+					const ZoneEvent& event = buffer.events[i % buffer.capacity];
+					zones.push_back({event.name.load(std::memory_order_relaxed), event.start.load(std::memory_order_relaxed), event.end.load(std::memory_order_relaxed)});
+				}
+
+				// The thread may have overwritten (or be overwriting) the oldest events while we were reading them
+				std::atomic_thread_fence(std::memory_order_acquire);
+				UInt64 lastWriteIndex = buffer.writeIndex.load(std::memory_order_relaxed);
+				UInt64 validIndex = (lastWriteIndex >= buffer.capacity) ? lastWriteIndex - buffer.capacity + 1 : 0;
+
+				for (UInt64 i = std::max(firstIndex, validIndex); i < writeIndex; ++i)
+				{
+					const Zone& zone = zones[static_cast<std::size_t>(i - firstIndex)];
+
+					NextEvent();
+					trace << "{\"name\":";
+					WriteJsonString(trace, zone.name);
+					trace << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer.threadId << ",\"ts\":" << zone.start << ",\"dur\":" << (zone.end - zone.start) << '}';
+				}
+			}
+		}
+
+		trace << "],\"displayTimeUnit\":\"ms\"}\n";
+
+		return stream.Write(trace.ToString());
+	}
+
+	/*!
+	* \brief Gets the number of zones each thread can keep
+	* \return Size of the ring buffer of each thread
+	*/
+	std::size_t Profiler::GetBufferSize()
+	{
+		LockGuard lock(s_bufferMutex);
+		return s_bufferSize;
+	}
+
+	/*!
+	* \brief Sets the number of zones each thread can keep
+	*
+	* \param eventCount Size of the ring buffer of each thread
+	*
+	* \remark This only affects the threads which did not record any zone yet
+	*/
+	void Profiler::SetBufferSize(std::size_t eventCount)
+	{
+		NazaraAssert(eventCount > 0, "Buffer size must be over zero");
+
+		LockGuard lock(s_bufferMutex);
+		s_bufferSize = eventCount;
+	}
+
+	/*!
+	* \brief Sets the name of the calling thread in the exported traces
+	*
+	* \param name Name of the thread
+	*/
+	void Profiler::SetThreadName(const String& name)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+
+		LockGuard lock(s_bufferMutex);
+		buffer->name = name;
+	}
+
+	void Profiler::RecordZone(const char* name, UInt64 start, UInt64 end)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+
+		UInt64 index = buffer->writeIndex.load(std::memory_order_relaxed);
+
+		ZoneEvent& event = buffer->events[index % buffer->capacity];
+		event.name.store(name, std::memory_order_relaxed);
+		event.start.store(start, std::memory_order_relaxed);
+		event.end.store(end, std::memory_order_relaxed);
+
+		buffer->writeIndex.store(index + 1, std::memory_order_release);
+	}
+
+	std::atomic<bool> Profiler::s_enabled(false);
+}
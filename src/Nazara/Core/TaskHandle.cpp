@@ -0,0 +1,111 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskHandle.hpp>
+#include <Nazara/Core/TaskPool.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::TaskHandle
+	* \brief Core class that represents a reference to a task (or a batch of tasks) submitted to a TaskPool
+	*
+	* A handle can be copied freely and stays valid after the task completion, which allows independent subsystems to wait on their own work instead of waiting on the whole scheduler.
+	*/
+
+	/*!
+	* \brief Constructs a TaskHandle object by copy
+	*
+	* \param handle TaskHandle to copy into this
+	*/
+	TaskHandle::TaskHandle(const TaskHandle& handle) :
+	m_counter(handle.m_counter)
+	{
+		if (m_counter)
+			m_counter->referenceCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Releases the task reference
+	*/
+	TaskHandle::~TaskHandle()
+	{
+		if (m_counter)
+			Release(m_counter);
+	}
+
+	/*!
+	* \brief Checks whether the task (or every task of the batch) was executed
+	* \return true If every referenced task was executed or if the handle is invalid
+	*/
+	bool TaskHandle::IsDone() const
+	{
+		return !m_counter || m_counter->remainingTasks.load(std::memory_order_acquire) == 0;
+	}
+
+	/*!
+	* \brief Waits for the task (or every task of the batch) to be executed
+	*
+	* The calling thread executes pending tasks while waiting instead of just blocking, which makes it safe to call from a task.
+	*
+	* \remark If the task was added by the calling thread and was not submitted yet, this submits it (as would TaskPool::Run)
+	* \remark The pool of the task must still exist
+	*/
+	void TaskHandle::Wait() const
+	{
+		if (!IsDone())
+			m_counter->owner->WaitForCounter(m_counter);
+	}
+
+	/*!
+	* \brief Copies the other handle into this
+	* \return A reference to this
+	*
+	* \param handle TaskHandle to copy into this
+	*/
+	TaskHandle& TaskHandle::operator=(const TaskHandle& handle)
+	{
+		TaskHandle copy(handle);
+		std::swap(m_counter, copy.m_counter);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the other handle into this
+	* \return A reference to this
+	*
+	* \param handle TaskHandle to move into this
+	*/
+	TaskHandle& TaskHandle::operator=(TaskHandle&& handle) noexcept
+	{
+		std::swap(m_counter, handle.m_counter);
+
+		return *this;
+	}
+
+	/*!
+	* \brief Decrements the reference count of a counter, deleting it if it was the last reference
+	*
+	* \param counter Counter to release
+	*/
+	void TaskHandle::Release(Counter* counter)
+	{
+		if (counter->referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete counter;
+	}
+
+	TaskHandle::Counter::Counter(std::size_t taskCount, unsigned int references, TaskPool* pool) :
+	successorLock(false),
+	remainingTasks(taskCount),
+	referenceCount(references),
+	owner(pool)
+	{
+	}
+
+	TaskHandle::Counter::~Counter() = default;
+}
@@ -0,0 +1,781 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskPool.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct Task : TaskHandle::Counter
+		{
+			Task(TaskPool* pool, Functor* taskFunctor) :
+			Counter(1, 1, pool),
+			remainingPredecessors(1),
+			batch(nullptr),
+			functor(taskFunctor)
+			{
+			}
+
+			~Task()
+			{
+				delete functor;
+			}
+
+			std::atomic<unsigned int> remainingPredecessors; // Plus one until the task is submitted
+			TaskHandle::Counter* batch;
+			Functor* functor;
+		};
+
+		// Work-stealing deque (Chase & Lev, "Dynamic Circular Work-Stealing Deque", with the memory orders from Lê et al.)
+		// Only the owner may push/pop at the bottom, any thread may steal from the top
+		class TaskDeque
+		{
+			public:
+				TaskDeque() :
+				m_bottom(0),
+				m_top(0)
+				{
+					m_buffers.emplace_back(new Buffer(InitialCapacity));
+					m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+				}
+
+				bool IsEmpty() const
+				{
+					Int64 top = m_top.load(std::memory_order_acquire);
+					Int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+					return bottom <= top;
+				}
+
+				Task* Pop()
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+					Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+					m_bottom.store(bottom, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+
+					Int64 top = m_top.load(std::memory_order_relaxed);
+					if (top > bottom)
+					{
+						// Empty
+						m_bottom.store(bottom + 1, std::memory_order_relaxed);
+						return nullptr;
+					}
+
+					Task* task = buffer->Get(bottom);
+					if (top == bottom)
+					{
+						// Last task, we have to race against thieves
+						if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+							task = nullptr;
+
+						m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					}
+
+					return task;
+				}
+
+				void Push(Task* task)
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+					Int64 top = m_top.load(std::memory_order_acquire);
+					Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+					if (bottom - top > buffer->capacity - 1)
+						buffer = Grow(buffer, bottom, top);
+
+					buffer->Put(bottom, task);
+					std::atomic_thread_fence(std::memory_order_release);
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+
+				Task* Steal()
+				{
+					Int64 top = m_top.load(std::memory_order_acquire);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					Int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+					if (top >= bottom)
+						return nullptr;
+
+					Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+					Task* task = buffer->Get(top);
+					if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						return nullptr; // Lost the race against another thief or the owner
+
+					return task;
+				}
+
+			private:
+				struct Buffer
+				{
+					Buffer(Int64 size) :
+					capacity(size),
+					tasks(new std::atomic<Task*>[static_cast<std::size_t>(size)])
+					{
+					}
+
+					Task* Get(Int64 index) const
+					{
+						return tasks[static_cast<std::size_t>(index & (capacity - 1))].load(std::memory_order_relaxed);
+					}
+
+					void Put(Int64 index, Task* task)
+					{
+						tasks[static_cast<std::size_t>(index & (capacity - 1))].store(task, std::memory_order_relaxed);
+					}
+
+					Int64 capacity;
+					std::unique_ptr<std::atomic<Task*>[]> tasks;
+				};
+
+				Buffer* Grow(Buffer* buffer, Int64 bottom, Int64 top)
+				{
+					// Old buffers are kept alive until the deque destruction as thieves may still be reading them
+					m_buffers.emplace_back(new Buffer(buffer->capacity * 2));
+					Buffer* newBuffer = m_buffers.back().get();
+					for (Int64 i = top; i < bottom; ++i)
+						newBuffer->Put(i, buffer->Get(i));
+
+					m_buffer.store(newBuffer, std::memory_order_release);
+
+					return newBuffer;
+				}
+
+				static constexpr Int64 InitialCapacity = 256;
+
+				std::atomic<Int64> m_bottom;
+				std::atomic<Int64> m_top;
+				std::atomic<Buffer*> m_buffer;
+				std::vector<std::unique_ptr<Buffer>> m_buffers;
+		};
+
+		struct Worker
+		{
+			TaskDeque queue;
+			Thread thread;
+			TaskPoolImpl* pool;
+			unsigned int index;
+		};
+
+		// How many times a thread looks for a task before going to sleep
+		constexpr unsigned int s_spinCount = 64;
+
+		// Tasks added by a thread but not submitted yet (of every pool)
+		thread_local std::vector<Task*> s_pendingTasks;
+		thread_local Worker* s_currentWorker = nullptr;
+
+		void LockSuccessors(TaskHandle::Counter* counter)
+		{
+			while (counter->successorLock.exchange(true, std::memory_order_acquire))
+				Thread::Sleep(0);
+		}
+
+		void UnlockSuccessors(TaskHandle::Counter* counter)
+		{
+			counter->successorLock.store(false, std::memory_order_release);
+		}
+	}
+
+	class TaskPoolImpl
+	{
+		public:
+			TaskPoolImpl(TaskPool* owner, unsigned int workerCount, const String& workerName, UInt64 affinityMask);
+			~TaskPoolImpl();
+
+			bool IsCurrentWorker() const;
+			bool IsIdle() const;
+
+			void Submit(std::vector<Task*>& tasks);
+			template<typename F> TaskHandle::Counter* SubmitPending(F&& filter);
+
+			template<typename P> void WaitUntil(P&& predicate);
+
+			UInt64 affinityMask;
+			String workerName;
+			TaskPool* owner;
+			unsigned int workerCount;
+
+		private:
+			void CompleteTask(Task* task);
+			void DiscardTask(Task* task);
+			void Enqueue(Task** tasks, std::size_t count);
+			void ExecuteTask(Task* task);
+			Task* FindTask();
+			bool HasQueuedTasks() const;
+			void NotifyWaiters();
+			Task* PopInjectedTask();
+			void ReleaseTask(Task* task);
+			void ResolveSuccessors(TaskHandle::Counter* counter);
+			Task* StealTask(unsigned int firstVictim);
+			void WorkerProc(Worker* worker);
+
+			std::atomic<std::size_t> m_injectedTaskCount;
+			std::atomic<std::size_t> m_remainingTaskCount;
+			std::atomic<unsigned int> m_sleepingWorkerCount;
+			std::atomic<unsigned int> m_waiterCount;
+			std::atomic<bool> m_shouldFinish;
+			std::deque<Task*> m_injectedTasks;
+			std::unique_ptr<Worker[]> m_workers;
+			ConditionVariable m_waitCondition;
+			ConditionVariable m_wakeCondition;
+			Mutex m_injectionMutex;
+			Mutex m_waitMutex;
+			Mutex m_wakeMutex;
+	};
+
+	/*!
+	* \ingroup core
+	* \class Nz::TaskPool
+	* \brief Core class that represents a pool of worker threads executing tasks
+	*
+	* Each worker owns a lock-free work-stealing deque: tasks submitted from a worker (for example by another task) go into its own deque, idle workers steal from the others.
+	* Tasks submitted from outside the pool go through a shared queue, which is only locked once per call to Run.
+	*
+	* A task may declare predecessors (see AddTaskAfter), it will then be enqueued by the worker finishing the last of them.
+	* This allows the stages of a frame to be expressed as a task graph, without any global barrier between the stages.
+	*
+	* Multiple pools can coexist, for example a small one for latency-critical work next to a bigger one for background work.
+	* TaskScheduler gives access to a default pool.
+	*/
+
+	/*!
+	* \brief Constructs a TaskPool object and starts its workers
+	*
+	* \param workerCount Number of worker threads, zero to use one worker per logical processor
+	* \param workerName Debugging name of the worker threads (suffixed by the worker index and truncated to 15 characters)
+	* \param affinityMask Bitmask of the logical processors the workers are allowed to run on, zero for no restriction
+	*/
+	TaskPool::TaskPool(unsigned int workerCount, const String& workerName, UInt64 affinityMask)
+	{
+		if (workerCount == 0)
+			workerCount = HardwareInfo::GetProcessorCount();
+
+		m_impl = new TaskPoolImpl(this, workerCount, workerName, affinityMask);
+	}
+
+	/*!
+	* \brief Stops the workers and destroys the pool
+	*
+	* \remark Tasks which were not executed yet are discarded (their handles are considered done)
+	*/
+	TaskPool::~TaskPool()
+	{
+		delete m_impl;
+	}
+
+	/*!
+	* \brief Gets the affinity mask of the workers
+	* \return Bitmask of the logical processors the workers are allowed to run on (zero if unrestricted)
+	*/
+	UInt64 TaskPool::GetAffinityMask() const
+	{
+		return m_impl->affinityMask;
+	}
+
+	/*!
+	* \brief Gets the debugging name of the workers
+	* \return Worker name (without the worker index)
+	*/
+	const String& TaskPool::GetWorkerName() const
+	{
+		return m_impl->workerName;
+	}
+
+	/*!
+	* \brief Gets the number of workers
+	* \return Number of worker threads of this pool
+	*/
+	unsigned int TaskPool::GetWorkerCount() const
+	{
+		return m_impl->workerCount;
+	}
+
+	/*!
+	* \brief Checks whether the calling thread is one of the workers of this pool
+	* \return true If the calling thread is a worker of this pool
+	*/
+	bool TaskPool::IsWorkerThread() const
+	{
+		return m_impl->IsCurrentWorker();
+	}
+
+	/*!
+	* \brief Submits the pending tasks added by the calling thread to this pool
+	* \return Handle which can be used to wait for every task submitted by this call
+	*/
+	TaskHandle TaskPool::Run()
+	{
+		return TaskHandle(m_impl->SubmitPending([](Task* /*task*/) { return true; }));
+	}
+
+	/*!
+	* \brief Submits some of the pending tasks added by the calling thread to this pool
+	* \return Handle which can be used to wait for every task submitted by this call
+	*
+	* \param tasks Handles of the pending tasks to submit, the other ones stay pending
+	* \param taskCount Number of handles
+	*
+	* \remark Pending predecessors of these tasks are not submitted, they must be part of the handles or be submitted later
+	*/
+	TaskHandle TaskPool::Run(const TaskHandle* tasks, std::size_t taskCount)
+	{
+		return TaskHandle(m_impl->SubmitPending([tasks, taskCount](Task* task)
+		{
+			for (std::size_t i = 0; i < taskCount; ++i)
+			{
+				if (tasks[i].m_counter == task)
+					return true;
+			}
+
+			return false;
+		}));
+	}
+
+	/*!
+	* \brief Waits for every submitted task to be done
+	*
+	* The calling thread executes tasks while waiting.
+	*
+	* \remark Calling this from a task is undefined behaviour (as the task would wait on itself), wait on a TaskHandle instead
+	*/
+	void TaskPool::WaitForTasks()
+	{
+		// Tasks added by this thread are part of the ones we're waiting for
+		Run();
+
+		m_impl->WaitUntil([this]() { return m_impl->IsIdle(); });
+	}
+
+	/*!
+	* \brief Adds a task on the pending list of the calling thread
+	* \return Handle referencing the task
+	*
+	* \param taskFunctor Functor represeting a task to be done
+	* \param predecessors Handles of the tasks which must be done before this one starts
+	* \param predecessorCount Number of handles
+	*
+	* \remark Tasks may add other tasks, but must call Run to submit them
+	*/
+	TaskHandle TaskPool::AddTaskFunctor(Functor* taskFunctor, const TaskHandle* predecessors, std::size_t predecessorCount)
+	{
+		Task* task = new Task(this, taskFunctor);
+		task->referenceCount.fetch_add(1, std::memory_order_relaxed); // For the returned handle
+
+		for (std::size_t i = 0; i < predecessorCount; ++i)
+		{
+			TaskHandle::Counter* predecessor = predecessors[i].m_counter;
+			if (!predecessor)
+				continue;
+
+			NazaraAssert(predecessor->owner == this, "Predecessors must belong to the same pool");
+
+			LockSuccessors(predecessor);
+			if (predecessor->remainingTasks.load(std::memory_order_acquire) > 0)
+			{
+				// The predecessor keeps a reference on us until it is done
+				task->referenceCount.fetch_add(1, std::memory_order_relaxed);
+				task->remainingPredecessors.fetch_add(1, std::memory_order_relaxed);
+				predecessor->successors.push_back(task);
+			}
+			UnlockSuccessors(predecessor);
+		}
+
+		s_pendingTasks.push_back(task);
+
+		return TaskHandle(task);
+	}
+
+	/*!
+	* \brief Waits for a task counter to reach zero, executing tasks in the meantime
+	*
+	* \param counter Counter to wait on
+	*/
+	void TaskPool::WaitForCounter(const TaskHandle::Counter* counter)
+	{
+		// The task may be one we didn't submit yet
+		for (Task* task : s_pendingTasks)
+		{
+			if (task == counter)
+			{
+				Run();
+				break;
+			}
+		}
+
+		m_impl->WaitUntil([counter]() { return counter->remainingTasks.load(std::memory_order_acquire) == 0; });
+	}
+
+	TaskPoolImpl::TaskPoolImpl(TaskPool* pool, unsigned int count, const String& name, UInt64 mask) :
+	affinityMask(mask),
+	workerName(name),
+	owner(pool),
+	workerCount(count),
+	m_injectedTaskCount(0),
+	m_remainingTaskCount(0),
+	m_sleepingWorkerCount(0),
+	m_waiterCount(0),
+	m_shouldFinish(false)
+	{
+		m_workers.reset(new Worker[workerCount]);
+
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			Worker& worker = m_workers[i];
+			worker.index = i;
+			worker.pool = this;
+			worker.thread = Thread([this, &worker]() { WorkerProc(&worker); });
+
+			String threadName = workerName + " #" + String::Number(i);
+			if (threadName.GetSize() > 15)
+				threadName.Resize(15);
+
+			worker.thread.SetName(threadName);
+
+			if (affinityMask != 0)
+				worker.thread.SetAffinity(affinityMask);
+		}
+	}
+
+	TaskPoolImpl::~TaskPoolImpl()
+	{
+		{
+			LockGuard lock(m_wakeMutex);
+			m_shouldFinish = true;
+			m_wakeCondition.SignalAll();
+		}
+
+		for (unsigned int i = 0; i < workerCount; ++i)
+			m_workers[i].thread.Join();
+
+		// Tasks of this pool added by the calling thread but never submitted, their submitted successors become ready
+		std::size_t remainingCount = 0;
+		for (Task* task : s_pendingTasks)
+		{
+			if (task->owner == owner)
+			{
+				task->remainingTasks.store(0, std::memory_order_release);
+				ResolveSuccessors(task);
+				TaskHandle::Release(task);
+			}
+			else
+				s_pendingTasks[remainingCount++] = task;
+		}
+		s_pendingTasks.resize(remainingCount);
+
+		// Discarding a task may enqueue its successors, which we'll discard as well
+		while (Task* task = FindTask())
+			DiscardTask(task);
+	}
+
+	bool TaskPoolImpl::IsCurrentWorker() const
+	{
+		return s_currentWorker && s_currentWorker->pool == this;
+	}
+
+	bool TaskPoolImpl::IsIdle() const
+	{
+		return m_remainingTaskCount.load(std::memory_order_acquire) == 0;
+	}
+
+	void TaskPoolImpl::Submit(std::vector<Task*>& tasks)
+	{
+		// Tasks waiting on predecessors will be enqueued by the last of them
+		std::size_t readyTaskCount = 0;
+		for (Task* task : tasks)
+		{
+			if (task->remainingPredecessors.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				tasks[readyTaskCount++] = task;
+		}
+
+		m_remainingTaskCount.fetch_add(tasks.size(), std::memory_order_relaxed);
+
+		if (readyTaskCount > 0)
+			Enqueue(tasks.data(), readyTaskCount);
+	}
+
+	template<typename F>
+	TaskHandle::Counter* TaskPoolImpl::SubmitPending(F&& filter)
+	{
+		std::vector<Task*> tasks;
+
+		// Extract our tasks from the pending list of this thread, which may contain tasks of other pools
+		std::size_t remainingCount = 0;
+		for (Task* task : s_pendingTasks)
+		{
+			if (task->owner == owner && filter(task))
+				tasks.push_back(task);
+			else
+				s_pendingTasks[remainingCount++] = task;
+		}
+		s_pendingTasks.resize(remainingCount);
+
+		if (tasks.empty())
+			return nullptr;
+
+		std::size_t taskCount = tasks.size();
+
+		// Every task keeps a reference on the batch counter, plus the returned handle
+		TaskHandle::Counter* batch = new TaskHandle::Counter(taskCount, static_cast<unsigned int>(taskCount + 1), owner);
+		for (Task* task : tasks)
+			task->batch = batch;
+
+		Submit(tasks);
+
+		return batch;
+	}
+
+	template<typename P>
+	void TaskPoolImpl::WaitUntil(P&& predicate)
+	{
+		unsigned int spinCount = 0;
+		while (!predicate())
+		{
+			// Help the workers instead of blocking
+			if (Task* task = FindTask())
+			{
+				ExecuteTask(task);
+
+				spinCount = 0;
+				continue;
+			}
+
+			if (++spinCount < s_spinCount)
+			{
+				Thread::Sleep(0);
+				continue;
+			}
+
+			m_waiterCount.fetch_add(1, std::memory_order_seq_cst);
+			{
+				LockGuard lock(m_waitMutex);
+				if (!predicate())
+					m_waitCondition.Wait(&m_waitMutex, 1); // The timeout allows us to look for new tasks to help with
+			}
+			m_waiterCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	void TaskPoolImpl::CompleteTask(Task* task)
+	{
+		bool notify = false;
+
+		if (TaskHandle::Counter* batch = task->batch)
+		{
+			if (batch->remainingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				ResolveSuccessors(batch);
+				notify = true;
+			}
+		}
+
+		task->remainingTasks.store(0, std::memory_order_release);
+		ResolveSuccessors(task);
+
+		if (task->referenceCount.load(std::memory_order_relaxed) > 1)
+			notify = true; // Someone holds a handle on this task
+
+		if (m_remainingTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			notify = true;
+
+		if (notify)
+			NotifyWaiters();
+	}
+
+	void TaskPoolImpl::DiscardTask(Task* task)
+	{
+		CompleteTask(task);
+		ReleaseTask(task);
+	}
+
+	void TaskPoolImpl::Enqueue(Task** tasks, std::size_t count)
+	{
+		if (IsCurrentWorker())
+		{
+			// Workers can use their own queue without any lock
+			for (std::size_t i = 0; i < count; ++i)
+				s_currentWorker->queue.Push(tasks[i]);
+		}
+		else
+		{
+			LockGuard lock(m_injectionMutex);
+			m_injectedTasks.insert(m_injectedTasks.end(), tasks, tasks + count);
+			m_injectedTaskCount.fetch_add(count, std::memory_order_relaxed);
+		}
+
+		// Pairs with the fence of a worker going to sleep: either it sees our tasks or we see it sleeping
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_sleepingWorkerCount.load(std::memory_order_relaxed) > 0)
+		{
+			LockGuard lock(m_wakeMutex);
+			if (count > 1)
+				m_wakeCondition.SignalAll();
+			else
+				m_wakeCondition.Signal();
+		}
+	}
+
+	void TaskPoolImpl::ExecuteTask(Task* task)
+	{
+		task->functor->Run();
+
+		CompleteTask(task);
+		ReleaseTask(task);
+	}
+
+	Task* TaskPoolImpl::FindTask()
+	{
+		unsigned int firstVictim = 0;
+		if (IsCurrentWorker())
+		{
+			if (Task* task = s_currentWorker->queue.Pop())
+				return task;
+
+			firstVictim = s_currentWorker->index + 1;
+		}
+
+		if (Task* task = PopInjectedTask())
+			return task;
+
+		return StealTask(firstVictim);
+	}
+
+	bool TaskPoolImpl::HasQueuedTasks() const
+	{
+		if (m_injectedTaskCount.load(std::memory_order_relaxed) > 0)
+			return true;
+
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			if (!m_workers[i].queue.IsEmpty())
+				return true;
+		}
+
+		return false;
+	}
+
+	void TaskPoolImpl::NotifyWaiters()
+	{
+		if (m_waiterCount.load(std::memory_order_seq_cst) > 0)
+		{
+			LockGuard lock(m_waitMutex);
+			m_waitCondition.SignalAll();
+		}
+	}
+
+	Task* TaskPoolImpl::PopInjectedTask()
+	{
+		if (m_injectedTaskCount.load(std::memory_order_relaxed) == 0)
+			return nullptr;
+
+		LockGuard lock(m_injectionMutex);
+		if (m_injectedTasks.empty())
+			return nullptr;
+
+		Task* task = m_injectedTasks.front();
+		m_injectedTasks.pop_front();
+		m_injectedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+
+		return task;
+	}
+
+	void TaskPoolImpl::ReleaseTask(Task* task)
+	{
+		if (TaskHandle::Counter* batch = task->batch)
+			TaskHandle::Release(batch);
+
+		TaskHandle::Release(task);
+	}
+
+	void TaskPoolImpl::ResolveSuccessors(TaskHandle::Counter* counter)
+	{
+		// Must be called after the counter reached zero, no successor can be added from this point
+		std::vector<TaskHandle::Counter*> successors;
+
+		LockSuccessors(counter);
+		std::swap(successors, counter->successors);
+		UnlockSuccessors(counter);
+
+		if (successors.empty())
+			return;
+
+		std::vector<Task*> readyTasks;
+		for (TaskHandle::Counter* successor : successors)
+		{
+			Task* task = static_cast<Task*>(successor);
+			if (task->remainingPredecessors.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				readyTasks.push_back(task);
+		}
+
+		if (!readyTasks.empty())
+			Enqueue(readyTasks.data(), readyTasks.size());
+
+		// Release the references we kept on the successors
+		for (TaskHandle::Counter* successor : successors)
+			TaskHandle::Release(successor);
+	}
+
+	Task* TaskPoolImpl::StealTask(unsigned int firstVictim)
+	{
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			Worker& victim = m_workers[(firstVictim + i) % workerCount];
+			if (&victim == s_currentWorker)
+				continue;
+
+			if (Task* task = victim.queue.Steal())
+				return task;
+		}
+
+		return nullptr;
+	}
+
+	void TaskPoolImpl::WorkerProc(Worker* worker)
+	{
+		s_currentWorker = worker;
+
+		unsigned int spinCount = 0;
+		while (!m_shouldFinish.load(std::memory_order_relaxed))
+		{
+			if (Task* task = FindTask())
+			{
+				ExecuteTask(task);
+
+				spinCount = 0;
+				continue;
+			}
+
+			if (++spinCount < s_spinCount)
+			{
+				Thread::Sleep(0);
+				continue;
+			}
+
+			LockGuard lock(m_wakeMutex);
+			m_sleepingWorkerCount.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (!HasQueuedTasks() && !m_shouldFinish.load(std::memory_order_relaxed))
+				m_wakeCondition.Wait(&m_wakeMutex);
+
+			m_sleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+			spinCount = 0;
+		}
+
+		s_currentWorker = nullptr;
+	}
+}
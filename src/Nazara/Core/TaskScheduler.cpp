@@ -3,35 +3,49 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
-
-#if defined(NAZARA_PLATFORM_WINDOWS)
-	#include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
-#elif defined(NAZARA_PLATFORM_POSIX)
-	#include <Nazara/Core/Posix/TaskSchedulerImpl.hpp>
-#else
-	#error Lack of implementation: Task Scheduler
-#endif
-
+#include <atomic>
+#include <mutex>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
 	namespace
 	{
-		std::vector<Functor*> s_pendingWorks;
+		std::atomic<TaskPool*> s_defaultPool(nullptr);
+		std::mutex s_defaultPoolMutex; //< Serializes the creation and destruction of the default pool
 		unsigned int s_workerCount = 0;
 	}
 
 	/*!
 	* \ingroup core
 	* \class Nz::TaskScheduler
-	* \brief Core class that represents a pool of threads
+	* \brief Core class giving access to the default task pool
+	*
+	* The default pool is created on first use (or by Initialize) and destroyed with the Core module, its first use may happen concurrently from several threads.
+	* Use TaskPool directly to run independent pools (with their own worker count, names and affinity).
 	*
-	* \remark Initialized should be called first
+	* \see TaskPool
 	*/
 
+	/*!
+	* \brief Gets the default pool, initializing it if required
+	* \return Pointer to the default pool, or nullptr if it failed to initialize
+	*/
+
+	TaskPool* TaskScheduler::GetPool()
+	{
+		if (!Initialize())
+		{
+			NazaraError("Failed to initialize Task Scheduler");
+			return nullptr;
+		}
+
+		return s_defaultPool.load(std::memory_order_acquire);
+	}
+
 	/*!
 	* \brief Gets the number of threads
 	* \return Number of threads, if none, the number of simulatenous threads on the processor is returned
@@ -39,6 +53,9 @@ namespace Nz
 
 	unsigned int TaskScheduler::GetWorkerCount()
 	{
+		if (TaskPool* pool = s_defaultPool.load(std::memory_order_acquire))
+			return pool->GetWorkerCount();
+
 		return (s_workerCount > 0) ? s_workerCount : HardwareInfo::GetProcessorCount();
 	}
 
@@ -49,28 +66,33 @@ namespace Nz
 
 	bool TaskScheduler::Initialize()
 	{
-		return TaskSchedulerImpl::Initialize(GetWorkerCount());
+		if (s_defaultPool.load(std::memory_order_acquire))
+			return true; // Already initialized
+
+		std::lock_guard<std::mutex> lock(s_defaultPoolMutex);
+
+		// Another thread may have created it while we were waiting for the lock
+		if (s_defaultPool.load(std::memory_order_relaxed))
+			return true;
+
+		s_defaultPool.store(new TaskPool(GetWorkerCount()), std::memory_order_release);
+		return true;
 	}
 
 	/*!
-	* \brief Runs the pending works
+	* \brief Submits the pending tasks added by the calling thread to the workers
+	* \return Handle which can be used to wait for every task submitted by this call
 	*
 	* \remark Produce a NazaraError if the class is not initialized
 	*/
 
-	void TaskScheduler::Run()
+	TaskHandle TaskScheduler::Run()
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Task Scheduler");
-			return;
-		}
+		TaskPool* pool = GetPool();
+		if (!pool)
+			return TaskHandle();
 
-		if (!s_pendingWorks.empty())
-		{
-			TaskSchedulerImpl::Run(&s_pendingWorks[0], s_pendingWorks.size());
-			s_pendingWorks.clear();
-		}
+		return pool->Run();
 	}
 
 	/*!
@@ -83,8 +105,8 @@ namespace Nz
 
 	void TaskScheduler::SetWorkerCount(unsigned int workerCount)
 	{
-		#ifdef NAZARA_CORE_SAFE
-		if (TaskSchedulerImpl::IsInitialized())
+		#if NAZARA_CORE_SAFE
+		if (s_defaultPool.load(std::memory_order_acquire))
 		{
 			NazaraError("Worker count cannot be set while initialized");
 			return;
@@ -96,48 +118,53 @@ namespace Nz
 
 	/*!
 	* \brief Uninitializes the TaskScheduler class
+	*
+	* \remark Tasks which were not executed yet are discarded (their handles are considered done)
 	*/
 
 	void TaskScheduler::Uninitialize()
 	{
-		if (TaskSchedulerImpl::IsInitialized())
-			TaskSchedulerImpl::Uninitialize();
+		std::lock_guard<std::mutex> lock(s_defaultPoolMutex);
+
+		delete s_defaultPool.exchange(nullptr, std::memory_order_acq_rel);
 	}
 
 	/*!
-	* \brief Waits for tasks to be done
+	* \brief Waits for every submitted task to be done
+	*
+	* The calling thread executes tasks while waiting.
 	*
 	* \remark Produce a NazaraError if the class is not initialized
+	* \remark Calling this from a task is undefined behaviour (as the task would wait on itself), wait on a TaskHandle instead
 	*/
 
 	void TaskScheduler::WaitForTasks()
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Task Scheduler");
-			return;
-		}
-
-		TaskSchedulerImpl::WaitForTasks();
+		if (TaskPool* pool = GetPool())
+			pool->WaitForTasks();
 	}
 
 	/*!
-	* \brief Adds a task on the pending list
+	* \brief Adds a task on the pending list of the calling thread
+	* \return Handle referencing the task
 	*
 	* \param taskFunctor Functor represeting a task to be done
+	* \param predecessors Handles of the tasks which must be done before this one starts
+	* \param predecessorCount Number of handles
 	*
 	* \remark Produce a NazaraError if the class is not initialized
-	* \remark A task containing a call on this class is undefined behaviour
+	* \remark Tasks may add other tasks, but must call Run to submit them
 	*/
 
-	void TaskScheduler::AddTaskFunctor(Functor* taskFunctor)
+	TaskHandle TaskScheduler::AddTaskFunctor(Functor* taskFunctor, const TaskHandle* predecessors, std::size_t predecessorCount)
 	{
-		if (!Initialize())
+		TaskPool* pool = GetPool();
+		if (!pool)
 		{
-			NazaraError("Failed to initialize Task Scheduler");
-			return;
+			delete taskFunctor;
+			return TaskHandle();
 		}
 
-		s_pendingWorks.push_back(taskFunctor);
+		return pool->AddTaskFunctor(taskFunctor, predecessors, predecessorCount);
 	}
 }
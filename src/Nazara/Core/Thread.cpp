@@ -117,6 +117,21 @@ namespace Nz
 		m_impl = nullptr;
 	}
 
+	/*!
+	* \brief Restricts the processors the thread is allowed to run on
+	*
+	* \param cpuMask Bitmask of allowed logical processors (bit N for the N-th processor)
+	*
+	* \remark Not supported on every platform (a warning is produced in that case)
+	*/
+	void Thread::SetAffinity(UInt64 cpuMask)
+	{
+		NazaraAssert(m_impl, "Invalid thread");
+		NazaraAssert(cpuMask != 0, "Affinity mask must allow at least one processor");
+
+		m_impl->SetAffinity(cpuMask);
+	}
+
 	/*!
 	* \brief Changes the debugging name associated to a thread
 	*
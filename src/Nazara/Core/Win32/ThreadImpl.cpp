@@ -46,6 +46,12 @@ namespace Nz
 		CloseHandle(m_handle);
 	}
 
+	void ThreadImpl::SetAffinity(UInt64 cpuMask)
+	{
+		if (SetThreadAffinityMask(m_handle, static_cast<DWORD_PTR>(cpuMask)) == 0)
+			NazaraError("Failed to set thread affinity: " + Error::GetLastSystemError());
+	}
+
 	void ThreadImpl::SetName(const Nz::String& name)
 	{
 		SetThreadName(m_threadId, name.GetConstBuffer());
@@ -24,6 +24,7 @@ namespace Nz
 
 			void Detach();
 			void Join();
+			void SetAffinity(UInt64 cpuMask);
 			void SetName(const Nz::String& name);
 
 			static void SetCurrentName(const Nz::String& name);
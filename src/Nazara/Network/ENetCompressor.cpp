@@ -0,0 +1,25 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ENetCompressor
+	* \brief Network class that represents a datagram compressor used by an ENetHost
+	*
+	* Compress is called on every outgoing datagram (without its header) and must return the compressed size,
+	* or 0 if the datagram couldn't be made smaller than maxOutputSize, in which case it is sent uncompressed.
+	* Decompress is called on every datagram flagged as compressed and must return its original size, or 0 on failure.
+	*
+	* Both hosts of a connection must use the same compressor, datagrams flagged as compressed are dropped by hosts without one.
+	*
+	* \remark This class is abstract
+	*/
+
+	ENetCompressor::~ENetCompressor() = default;
+}
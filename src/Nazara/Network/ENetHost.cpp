@@ -14,10 +14,13 @@
 
 #include <Nazara/Network/ENetHost.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Hash/CRC32C.hpp>
 #include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <algorithm>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
@@ -156,7 +159,8 @@ namespace Nz
 		if (!InitSocket(address))
 			return false;
 
-		m_address = address;
+		// Report the port picked by the system if none was specified
+		m_address = (m_socket.GetBoundAddress().IsValid()) ? m_socket.GetBoundAddress() : address;
 		m_randomSeed = *reinterpret_cast<UInt32*>(this);
 		m_randomSeed += s_randomGenerator();
 		m_randomSeed = (m_randomSeed << 16) | (m_randomSeed >> 16);
@@ -173,6 +177,30 @@ namespace Nz
 		m_receivedData = nullptr;
 		m_receivedDataLength = 0;
 
+		// Incoming datagrams use the first half of the storage, outgoing ones the second half
+		constexpr std::size_t batchSize = ENetConstants::ENetHost_DatagramBatchSize;
+
+		m_datagramBuffers.resize(2 * batchSize);
+		m_datagramData.resize(2 * batchSize * ENetConstants::ENetProtocol_MaximumMTU);
+		m_incomingDatagrams.resize(batchSize);
+		m_outgoingDatagrams.resize(batchSize);
+
+		for (std::size_t i = 0; i < 2 * batchSize; ++i)
+		{
+			NetBuffer& buffer = m_datagramBuffers[i];
+			buffer.data = &m_datagramData[i * ENetConstants::ENetProtocol_MaximumMTU];
+			buffer.dataLength = ENetConstants::ENetProtocol_MaximumMTU;
+
+			NetDatagram& datagram = (i < batchSize) ? m_incomingDatagrams[i] : m_outgoingDatagrams[i - batchSize];
+			datagram.buffers = &buffer;
+			datagram.bufferCount = 1;
+			datagram.dataLength = 0;
+		}
+
+		m_incomingDatagramCount = 0;
+		m_incomingDatagramIndex = 0;
+		m_outgoingDatagramCount = 0;
+
 		m_totalSentData = 0;
 		m_totalSentPackets = 0;
 		m_totalReceivedData = 0;
@@ -200,6 +228,8 @@ namespace Nz
 
 	int ENetHost::Service(ENetEvent* event, UInt32 timeout)
 	{
+		NazaraProfileZone("ENetHost::Service");
+
 		if (event)
 		{
 			event->type = ENetEventType::None;
@@ -267,6 +297,13 @@ namespace Nz
 			if (ENetTimeGreaterEqual(m_serviceTime, timeout))
 				return 0;
 
+			// What's left of the last received batch doesn't make the socket readable, handle it before waiting
+			if (m_incomingDatagramIndex < m_incomingDatagramCount)
+			{
+				m_serviceTime = GetElapsedMilliseconds();
+				continue;
+			}
+
 			for (;;)
 			{
 				m_serviceTime = GetElapsedMilliseconds();
@@ -280,7 +317,7 @@ namespace Nz
 
 			m_serviceTime = GetElapsedMilliseconds();
 		}
-		while (m_poller.IsReadyToRead(m_socket));
+		while (m_incomingDatagramIndex < m_incomingDatagramCount || m_poller.IsReadyToRead(m_socket));
 
 		return 0;
 	}
@@ -318,6 +355,12 @@ namespace Nz
 		m_socket.SetReceiveBufferSize(ENetConstants::ENetHost_ReceiveBufferSize);
 		m_socket.SetSendBufferSize(ENetConstants::ENetHost_SendBufferSize);
 
+		if (m_isReusePortEnabled && !m_socket.EnableReusePort(true))
+		{
+			NazaraError("Failed to share port: " + String(ErrorToString(m_socket.GetLastError())));
+			return false;
+		}
+
 		if (!address.IsLoopback())
 		{
 			if (m_socket.Bind(address) != SocketState_Bound)
@@ -484,6 +527,11 @@ namespace Nz
 		peerID &= ~(ENetProtocolHeaderFlag_Mask | ENetProtocolHeaderSessionMask);
 
 		std::size_t headerSize = (flags & ENetProtocolHeaderFlag_SentTime) ? sizeof(ENetProtocolHeader) : NazaraOffsetOf(ENetProtocolHeader, sentTime);
+		if (m_isChecksumEnabled)
+			headerSize += sizeof(UInt32);
+
+		if (m_receivedDataLength < headerSize)
+			return false;
 
 		ENetPeer* peer;
 		if (peerID == ENetConstants::ENetProtocol_MaximumPeerId)
@@ -507,9 +555,43 @@ namespace Nz
 			}
 		}
 
-		// Compression handling
+		if (flags & ENetProtocolHeaderFlag_Compressed)
+		{
+			if (!m_compressor)
+				return false;
+
+			std::size_t compressedSize = m_receivedDataLength - headerSize;
+			std::size_t originalSize = m_compressor->Decompress(peer, m_receivedData + headerSize, compressedSize, m_packetData[1].data() + headerSize, m_packetData[1].size() - headerSize);
+			if (originalSize == 0 || originalSize > m_packetData[1].size() - headerSize)
+				return false;
+
+			std::memcpy(m_packetData[1].data(), header, headerSize);
+			header = reinterpret_cast<ENetProtocolHeader*>(m_packetData[1].data());
 
-		// Checksum
+			m_receivedData = m_packetData[1].data();
+			m_receivedDataLength = headerSize + originalSize;
+
+			if (peer)
+			{
+				peer->m_compressionStats.compressedDataReceived += compressedSize;
+				peer->m_compressionStats.uncompressedDataReceived += originalSize;
+			}
+		}
+
+		if (m_isChecksumEnabled)
+		{
+			UInt8* checksumPtr = m_receivedData + headerSize - sizeof(UInt32);
+
+			UInt32 desiredChecksum;
+			std::memcpy(&desiredChecksum, checksumPtr, sizeof(UInt32));
+
+			// The checksum is computed with the connection id in place of itself
+			UInt32 seed = (peer) ? peer->m_connectID : 0;
+			std::memcpy(checksumPtr, &seed, sizeof(UInt32));
+
+			if (HashCRC32C::Compute(m_receivedData, m_receivedDataLength) != NetToHost(desiredChecksum))
+				return false;
+		}
 
 		if (peer)
 		{
@@ -688,13 +770,28 @@ namespace Nz
 				}
 			}
 
+			UInt8* receivedData = m_packetData[0].data();
+
 			if (shouldReceive)
 			{
-				if (!m_socket.Receive(m_packetData[0].data(), m_packetData[0].size(), &m_receivedAddress, &receivedLength))
-					return -1; //< Error
+				// Datagrams are received by batches, what's left of a batch is handled before asking the socket for more
+				if (m_incomingDatagramIndex >= m_incomingDatagramCount)
+				{
+					m_incomingDatagramIndex = 0;
+					if (!m_socket.ReceiveDatagrams(m_incomingDatagrams.data(), m_incomingDatagrams.size(), &m_incomingDatagramCount))
+					{
+						m_incomingDatagramCount = 0;
+						return -1; //< Error
+					}
 
-				if (receivedLength == 0)
-					return 0;
+					if (m_incomingDatagramCount == 0)
+						return 0;
+				}
+
+				const NetDatagram& datagram = m_incomingDatagrams[m_incomingDatagramIndex++];
+				m_receivedAddress = datagram.address;
+				receivedData = static_cast<UInt8*>(datagram.buffers[0].data);
+				receivedLength = datagram.dataLength;
 
 				if (m_isSimulationEnabled)
 				{
@@ -707,7 +804,7 @@ namespace Nz
 						PendingIncomingPacket pendingPacket;
 						pendingPacket.deliveryTime = m_serviceTime + delay;
 						pendingPacket.from = m_receivedAddress;
-						pendingPacket.data.Reset(0, m_packetData[0].data(), receivedLength);
+						pendingPacket.data.Reset(0, receivedData, receivedLength);
 
 						auto it = std::upper_bound(m_pendingIncomingPackets.begin(), m_pendingIncomingPackets.end(), pendingPacket, [] (const PendingIncomingPacket& first, const PendingIncomingPacket& second)
 						{
@@ -720,7 +817,7 @@ namespace Nz
 				}
 			}
 
-			m_receivedData = m_packetData[0].data();
+			m_receivedData = receivedData;
 			m_receivedDataLength = receivedLength;
 
 			m_totalReceivedData += receivedLength;
@@ -732,7 +829,8 @@ namespace Nz
 				return 1;
 		}
 
-		return -1;
+		// Enough datagrams for this call, the others will be received by the next one
+		return 0;
 	}
 
 	void ENetHost::NotifyConnect(ENetPeer* peer, ENetEvent* event, bool incoming)
@@ -774,6 +872,43 @@ namespace Nz
 		}
 	}
 
+	bool ENetHost::QueueOutgoingDatagram(const IpAddress& to)
+	{
+		if (m_outgoingDatagramCount >= m_outgoingDatagrams.size())
+		{
+			if (!SendOutgoingDatagrams())
+				return false;
+
+			// The send buffer is still full, drop the oldest datagram to make room (ENet resends lost reliable commands)
+			if (m_outgoingDatagramCount >= m_outgoingDatagrams.size())
+			{
+				std::rotate(m_outgoingDatagrams.begin(), m_outgoingDatagrams.begin() + 1, m_outgoingDatagrams.end());
+				m_outgoingDatagramCount--;
+			}
+		}
+
+		// Temporary buffers point to the header (on the stack) and to commands which may be freed right after, copy them
+		NetDatagram& datagram = m_outgoingDatagrams[m_outgoingDatagramCount++];
+		datagram.address = to;
+
+		NetBuffer& datagramBuffer = datagram.buffers[0];
+		UInt8* datagramData = static_cast<UInt8*>(datagramBuffer.data);
+
+		std::size_t dataLength = 0;
+		for (std::size_t i = 0; i < m_bufferCount; ++i)
+		{
+			const NetBuffer& buffer = m_buffers[i];
+			NazaraAssert(dataLength + buffer.dataLength <= ENetConstants::ENetProtocol_MaximumMTU, "Datagram exceeds maximum MTU");
+
+			std::memcpy(datagramData + dataLength, buffer.data, buffer.dataLength);
+			dataLength += buffer.dataLength;
+		}
+
+		datagramBuffer.dataLength = dataLength;
+
+		return true;
+	}
+
 	void ENetHost::SendAcknowledgements(ENetPeer* peer)
 	{
 		auto it = peer->m_acknowledgements.begin();
@@ -887,11 +1022,7 @@ namespace Nz
 			if (peer->m_sentReliableCommands.empty())
 				peer->m_nextTimeout = m_serviceTime + outgoingCommand->roundTripTimeout;
 
-			peer->m_sentReliableCommands.emplace_back(std::move(*outgoingCommand));
-			peer->m_outgoingReliableCommands.erase(outgoingCommand);
-
-			outgoingCommand = peer->m_sentReliableCommands.end();
-			--outgoingCommand;
+			peer->m_sentReliableCommands.splice(peer->m_sentReliableCommands.end(), peer->m_outgoingReliableCommands, outgoingCommand);
 
 			outgoingCommand->sentTime = m_serviceTime;
 
@@ -933,6 +1064,8 @@ namespace Nz
 		std::array<UInt8, sizeof(ENetProtocolHeader) + sizeof(UInt32)> headerData;
 		ENetProtocolHeader* header = reinterpret_cast<ENetProtocolHeader*>(headerData.data());
 
+		std::size_t checksumSize = (m_isChecksumEnabled) ? sizeof(UInt32) : 0;
+
 		m_continueSending = true;
 
 		while (m_continueSending)
@@ -948,7 +1081,7 @@ namespace Nz
 				m_headerFlags = 0;
 				m_commandCount = 0;
 				m_bufferCount = 1;
-				m_packetSize = sizeof(ENetProtocolHeader);
+				m_packetSize = sizeof(ENetProtocolHeader) + checksumSize;
 
 				if (!currentPeer->m_acknowledgements.empty())
 					SendAcknowledgements(currentPeer);
@@ -956,7 +1089,7 @@ namespace Nz
 				if (checkForTimeouts && !currentPeer->m_sentReliableCommands.empty() && ENetTimeGreaterEqual(m_serviceTime, currentPeer->m_nextTimeout) && currentPeer->CheckTimeouts(event))
 				{
 					if (event && event->type != ENetEventType::None)
-						return 1;
+						return (SendOutgoingDatagrams()) ? 1 : -1;
 					else
 						continue;
 				}
@@ -1002,6 +1135,23 @@ namespace Nz
 					currentPeer->m_packetsLost = 0;
 				}
 
+				std::size_t compressedSize = 0;
+				if (m_compressor)
+				{
+					std::size_t originalSize = m_packetSize - sizeof(ENetProtocolHeader) - checksumSize;
+
+					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, originalSize, m_packetData[1].data(), originalSize);
+					if (compressedSize > 0 && compressedSize < originalSize)
+						m_headerFlags |= ENetProtocolHeaderFlag_Compressed;
+					else
+					{
+						compressedSize = 0;
+						currentPeer->m_compressionStats.incompressibleDatagrams++;
+					}
+
+					currentPeer->m_compressionStats.compressedDataSent += (compressedSize > 0) ? compressedSize : originalSize;
+					currentPeer->m_compressionStats.uncompressedDataSent += originalSize;
+				}
 
 				m_buffers[0].data = headerData.data();
 				if (m_headerFlags & ENetProtocolHeaderFlag_SentTime)
@@ -1018,6 +1168,30 @@ namespace Nz
 
 				header->peerID = HostToNet(static_cast<UInt16>(currentPeer->m_outgoingPeerID | m_headerFlags));
 
+				if (m_isChecksumEnabled)
+				{
+					// Computed on the uncompressed datagram, with the connection id in place of the checksum
+					UInt8* checksumPtr = headerData.data() + m_buffers[0].dataLength;
+					m_buffers[0].dataLength += sizeof(UInt32);
+
+					UInt32 seed = (currentPeer->m_outgoingPeerID < ENetConstants::ENetProtocol_MaximumPeerId) ? currentPeer->m_connectID : 0;
+					std::memcpy(checksumPtr, &seed, sizeof(UInt32));
+
+					UInt32 checksum = 0;
+					for (std::size_t i = 0; i < m_bufferCount; ++i)
+						checksum = HashCRC32C::Compute(m_buffers[i].data, m_buffers[i].dataLength, checksum);
+
+					checksum = HostToNet(checksum);
+					std::memcpy(checksumPtr, &checksum, sizeof(UInt32));
+				}
+
+				if (compressedSize > 0)
+				{
+					m_buffers[1].data = m_packetData[1].data();
+					m_buffers[1].dataLength = compressedSize;
+					m_bufferCount = 2;
+				}
+
 				currentPeer->m_lastSendTime = m_serviceTime;
 
 				// Simulate network by adding delay to packet sending and losing some packets
@@ -1056,21 +1230,17 @@ namespace Nz
 					}
 				}
 
-				if (sendNow)
-				{
-					std::size_t sentLength = 0;
-
-					if (!m_socket.SendMultiple(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount, &sentLength))
-						return -1;
-
-					m_totalSentData += sentLength;
-				}
+				if (sendNow && !QueueOutgoingDatagram(currentPeer->GetAddress()))
+					return -1;
 
 				currentPeer->RemoveSentUnreliableCommands();
 				m_totalSentPackets++;
 			}
 		}
 
+		if (!SendOutgoingDatagrams())
+			return -1;
+
 		if (!m_pendingOutgoingPackets.empty())
 		{
 			auto it = m_pendingOutgoingPackets.begin();
@@ -1089,6 +1259,31 @@ namespace Nz
 		return 0;
 	}
 
+	bool ENetHost::SendOutgoingDatagrams()
+	{
+		if (m_outgoingDatagramCount == 0)
+			return true;
+
+		std::size_t sentCount;
+		bool success = m_socket.SendDatagrams(m_outgoingDatagrams.data(), m_outgoingDatagramCount, &sentCount);
+
+		if (!success)
+		{
+			m_outgoingDatagramCount = 0;
+			return false;
+		}
+
+		for (std::size_t i = 0; i < sentCount; ++i)
+			m_totalSentData += m_outgoingDatagrams[i].buffers[0].dataLength;
+
+		// The send buffer got full, keep the unsent datagrams (each one owning its buffer) queued for the next flush
+		auto firstDatagram = m_outgoingDatagrams.begin();
+		std::rotate(firstDatagram, firstDatagram + sentCount, firstDatagram + m_outgoingDatagramCount);
+		m_outgoingDatagramCount -= sentCount;
+
+		return true;
+	}
+
 	void ENetHost::SendUnreliableOutgoingCommands(ENetPeer* peer)
 	{
 		auto currentCommand = peer->m_outgoingUnreliableCommands.begin();
@@ -1154,10 +1349,10 @@ namespace Nz
 				m_packetSize += packetBuffer.dataLength;
 
 				// In order to keep the packet buffer alive until we send it, place it into a temporary queue
-				peer->m_sentUnreliableCommands.emplace_back(std::move(*outgoingCommand));
+				peer->m_sentUnreliableCommands.splice(peer->m_sentUnreliableCommands.end(), peer->m_outgoingUnreliableCommands, outgoingCommand);
 			}
-
-			peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
+			else
+				peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
 
 			++m_bufferCount;
 			++m_commandCount;
@@ -0,0 +1,214 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t LastLiterals = 5;    //< The last bytes of a block are always literals
+		constexpr std::size_t MatchLimit = 12;     //< The last match must start at least this many bytes before the end of the block
+		constexpr std::size_t MinMatch = 4;
+		constexpr std::size_t MaxOffset = 0xFFFF;
+
+		UInt32 Read32(const UInt8* ptr)
+		{
+			UInt32 value;
+			std::memcpy(&value, ptr, sizeof(UInt32));
+
+			return value;
+		}
+
+		bool WriteLength(std::size_t length, UInt8*& output, const UInt8* outputEnd)
+		{
+			for (; length >= 0xFF; length -= 0xFF)
+			{
+				if (output >= outputEnd)
+					return false;
+
+				*output++ = 0xFF;
+			}
+
+			if (output >= outputEnd)
+				return false;
+
+			*output++ = static_cast<UInt8>(length);
+			return true;
+		}
+
+		bool WriteSequence(const UInt8* literals, std::size_t literalLength, std::size_t offset, std::size_t matchLength, UInt8*& output, const UInt8* outputEnd)
+		{
+			if (output >= outputEnd)
+				return false;
+
+			UInt8* token = output++;
+			*token = static_cast<UInt8>(std::min<std::size_t>(literalLength, 0xF) << 4);
+			if (literalLength >= 0xF && !WriteLength(literalLength - 0xF, output, outputEnd))
+				return false;
+
+			if (literalLength > static_cast<std::size_t>(outputEnd - output))
+				return false;
+
+			std::memcpy(output, literals, literalLength);
+			output += literalLength;
+
+			// The last sequence only has literals
+			if (matchLength == 0)
+				return true;
+
+			if (outputEnd - output < 2)
+				return false;
+
+			*output++ = static_cast<UInt8>(offset & 0xFF);
+			*output++ = static_cast<UInt8>(offset >> 8);
+
+			matchLength -= MinMatch;
+			*token |= static_cast<UInt8>(std::min<std::size_t>(matchLength, 0xF));
+			if (matchLength >= 0xF && !WriteLength(matchLength - 0xF, output, outputEnd))
+				return false;
+
+			return true;
+		}
+
+		bool ReadLength(std::size_t& length, const UInt8*& input, const UInt8* inputEnd)
+		{
+			UInt8 byte;
+			do
+			{
+				if (input >= inputEnd)
+					return false;
+
+				byte = *input++;
+				length += byte;
+			}
+			while (byte == 0xFF);
+
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetLZ4Compressor
+	* \brief Network class that compresses ENet datagrams using the LZ4 block format
+	*
+	* Datagrams are small and are compressed independently from each other, a fast greedy parser is used
+	* which works well on redundant data such as entity state updates.
+	*/
+
+	std::size_t ENetLZ4Compressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (totalInputSize > m_inputBuffer.size())
+			return 0;
+
+		// Matches are searched in a contiguous input
+		std::size_t inputSize = 0;
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			std::memcpy(&m_inputBuffer[inputSize], buffers[i].data, buffers[i].dataLength);
+			inputSize += buffers[i].dataLength;
+		}
+
+		const UInt8* input = m_inputBuffer.data();
+		const UInt8* inputEnd = input + inputSize;
+		const UInt8* anchor = input;
+
+		UInt8* outputPtr = output;
+		const UInt8* outputEnd = output + maxOutputSize;
+
+		if (inputSize > MatchLimit)
+		{
+			m_hashTable.fill(0);
+
+			const UInt8* matchStartLimit = inputEnd - MatchLimit;
+			const UInt8* matchEndLimit = inputEnd - LastLiterals;
+
+			const UInt8* current = input + 1;
+			while (current <= matchStartLimit)
+			{
+				UInt32 sequence = Read32(current);
+				UInt32 hash = (sequence * 2654435761U) >> (32 - HashLog);
+
+				const UInt8* match = input + m_hashTable[hash];
+				m_hashTable[hash] = static_cast<UInt16>(current - input);
+
+				if (static_cast<std::size_t>(current - match) > MaxOffset || Read32(match) != sequence)
+				{
+					current++;
+					continue;
+				}
+
+				std::size_t matchLength = MinMatch;
+				while (current + matchLength < matchEndLimit && current[matchLength] == match[matchLength])
+					matchLength++;
+
+				if (!WriteSequence(anchor, current - anchor, current - match, matchLength, outputPtr, outputEnd))
+					return 0;
+
+				current += matchLength;
+				anchor = current;
+			}
+		}
+
+		if (!WriteSequence(anchor, inputEnd - anchor, 0, 0, outputPtr, outputEnd))
+			return 0;
+
+		return outputPtr - output;
+	}
+
+	std::size_t ENetLZ4Compressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		const UInt8* inputEnd = input + inputSize;
+		UInt8* outputPtr = output;
+		const UInt8* outputEnd = output + maxOutputSize;
+
+		while (input < inputEnd)
+		{
+			UInt8 token = *input++;
+
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 0xF && !ReadLength(literalLength, input, inputEnd))
+				return 0;
+
+			if (literalLength > static_cast<std::size_t>(inputEnd - input) || literalLength > static_cast<std::size_t>(outputEnd - outputPtr))
+				return 0;
+
+			std::memcpy(outputPtr, input, literalLength);
+			input += literalLength;
+			outputPtr += literalLength;
+
+			// The last sequence ends the block right after its literals
+			if (input == inputEnd)
+				break;
+
+			if (inputEnd - input < 2)
+				return 0;
+
+			std::size_t offset = input[0] | (input[1] << 8);
+			input += 2;
+
+			if (offset == 0 || offset > static_cast<std::size_t>(outputPtr - output))
+				return 0;
+
+			std::size_t matchLength = token & 0xF;
+			if (matchLength == 0xF && !ReadLength(matchLength, input, inputEnd))
+				return 0;
+
+			matchLength += MinMatch;
+			if (matchLength > static_cast<std::size_t>(outputEnd - outputPtr))
+				return 0;
+
+			// Matches may overlap their output, copy byte by byte
+			const UInt8* match = outputPtr - offset;
+			for (std::size_t i = 0; i < matchLength; ++i)
+				*outputPtr++ = *match++;
+		}
+
+		return outputPtr - output;
+	}
+}
@@ -3,7 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/ENetPacket.hpp>
-#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
@@ -13,12 +13,12 @@ namespace Nz
 	{
 		if (m_packet)
 		{
-			if (--m_packet->referenceCount == 0)
+			if (m_packet->referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
 				m_packet->owner->Delete(m_packet);
 		}
 
 		m_packet = packet;
 		if (m_packet)
-			m_packet->referenceCount++;
+			m_packet->referenceCount.fetch_add(1, std::memory_order_relaxed);
 	}
 }
@@ -16,10 +16,26 @@
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetHost.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <iterator>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
+	m_host(host),
+	m_dispatchedCommands(host->m_commandPool),
+	m_outgoingReliableCommands(host->m_commandPool),
+	m_outgoingUnreliableCommands(host->m_commandPool),
+	m_sentReliableCommands(host->m_commandPool),
+	m_sentUnreliableCommands(host->m_commandPool),
+	m_incomingSessionID(0xFF),
+	m_outgoingSessionID(0xFF),
+	m_incomingPeerID(peerId),
+	m_isSimulationEnabled(false)
+	{
+		Reset();
+	}
+
 	void ENetPeer::Disconnect(UInt32 data)
 	{
 		if (m_state == ENetPeerState::Disconnecting ||
@@ -130,6 +146,7 @@ namespace Nz
 		m_outgoingBandwidthThrottleEpoch = 0;
 		m_incomingDataTotal = 0;
 		m_outgoingDataTotal = 0;
+		m_compressionStats = CompressionStats();
 		m_lastSendTime = 0;
 		m_lastReceiveTime = 0;
 		m_nextTimeout = 0;
@@ -199,6 +216,8 @@ namespace Nz
 		Channel& channel = m_channels[channelId];
 
 		UInt16 fragmentLength = static_cast<UInt16>(m_mtu - sizeof(ENetProtocolHeader) - sizeof(ENetProtocolSendFragment));
+		if (m_host->IsChecksumEnabled())
+			fragmentLength -= sizeof(UInt32);
 
 		UInt32 packetSize = static_cast<UInt32>(packetRef->data.GetDataSize());
 		if (packetSize > fragmentLength)
@@ -317,8 +336,9 @@ namespace Nz
 			command.roundTripTimeout = m_roundTripTime + 4 * m_roundTripTimeVariance;
 			command.roundTripTimeoutLimit = m_timeoutLimit * command.roundTripTimeout;
 
-			m_outgoingReliableCommands.emplace_front(std::move(command));
-			it = m_sentReliableCommands.erase(it);
+			auto next = std::next(it);
+			m_outgoingReliableCommands.splice(m_outgoingReliableCommands.begin(), m_sentReliableCommands, it);
+			it = next;
 
 			// Okay this should just never procs, I don't see how it would be possible
 			/*if (currentCommand == enet_list_begin(&peer->sentReliableCommands) &&
@@ -371,9 +391,9 @@ namespace Nz
 
 	void ENetPeer::DispatchIncomingUnreliableCommands(Channel& channel)
 	{
-		std::list<IncomingCommmand>::iterator currentCommand;
-		std::list<IncomingCommmand>::iterator droppedCommand;
-		std::list<IncomingCommmand>::iterator startCommand;
+		IncomingCommandList::iterator currentCommand;
+		IncomingCommandList::iterator droppedCommand;
+		IncomingCommandList::iterator startCommand;
 
 		for (droppedCommand = startCommand = currentCommand = channel.incomingUnreliableCommands.begin();
 		     currentCommand != channel.incomingUnreliableCommands.end();
@@ -876,7 +896,7 @@ namespace Nz
 		RemoveSentReliableCommand(1, 0xFF);
 
 		if (channelCount < m_channels.size())
-			m_channels.resize(channelCount);
+			m_channels.erase(m_channels.begin() + channelCount, m_channels.end());
 
 		m_outgoingPeerID = NetToHost(command->verifyConnect.outgoingPeerID);
 		m_incomingSessionID = command->verifyConnect.incomingSessionID;
@@ -897,7 +917,7 @@ namespace Nz
 
 	void ENetPeer::InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand)
 	{
-		m_channels.resize(channelCount);
+		m_channels.resize(channelCount, Channel(m_host->m_commandPool));
 		m_address = address;
 
 		m_connectID = incomingCommand.connectID;
@@ -938,7 +958,7 @@ namespace Nz
 
 	void ENetPeer::InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize)
 	{
-		m_channels.resize(channelCount);
+		m_channels.resize(channelCount, Channel(m_host->m_commandPool));
 
 		m_address = address;
 		m_connectID = connectId;
@@ -970,7 +990,7 @@ namespace Nz
 
 	ENetProtocolCommand ENetPeer::RemoveSentReliableCommand(UInt16 reliableSequenceNumber, UInt8 channelId)
 	{
-		std::list<OutgoingCommand>* commandList = nullptr;
+		OutgoingCommandList* commandList = nullptr;
 
 		bool found = false;
 		auto currentCommand = m_sentReliableCommands.begin();
@@ -1120,8 +1140,8 @@ namespace Nz
 				return discardCommand();
 		}
 
-		std::list<IncomingCommmand>* commandList = nullptr;
-		std::list<IncomingCommmand>::reverse_iterator currentCommand;
+		IncomingCommandList* commandList = nullptr;
+		IncomingCommandList::reverse_iterator currentCommand;
 
 		switch (command.header.command & ENetProtocolCommand_Mask)
 		{
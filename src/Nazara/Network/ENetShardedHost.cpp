@@ -0,0 +1,339 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <algorithm>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ENetShardedHost
+	* \brief Network class that spreads the peers of a server among several ENetHost, each one serviced by its own thread
+	*
+	* Every shard owns an ENetHost (and thus its socket and socket poller) bound to the same port, the system balances incoming
+	* datagrams between them according to their source address so a remote host always talks to the same shard.
+	* Socket I/O, acknowledgements, fragment reassembly and throttling of each shard run on its thread, while events are
+	* delivered to the user thread through lock-free queues and packets sent by the user are forwarded the same way.
+	*
+	* Every other function must be called from the same (user) thread, and peers returned by events must not be used directly
+	* as they belong to the shard threads: use the functions of this class taking a peer instead.
+	*
+	* \remark On systems unable to balance a port between sockets (such as Windows), a single shard is used
+	*/
+
+	/*!
+	* \brief Sends a packet to every connected peer of every shard
+	* \return Number of shards the packet was forwarded to, less than GetShardCount() if the queue of a shard was full
+	*
+	* \param channelId Channel to send the packet on
+	* \param flags Packet flags
+	* \param packet Packet to send
+	*/
+
+	std::size_t ENetShardedHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet)
+	{
+		std::size_t acceptedCount = 0;
+		for (std::size_t i = 0; i < m_shards.size(); ++i)
+		{
+			Command command;
+			command.type = CommandType::Broadcast;
+			command.channelId = channelId;
+			command.flags = flags;
+
+			// Shards have their own packet pool, the last one can take the original packet
+			if (i == m_shards.size() - 1)
+				command.packet = std::move(packet);
+			else
+				command.packet.Reset(packet.GetNetCode(), (packet.GetDataSize() > 0) ? packet.GetConstData() + NetPacket::HeaderSize : nullptr, packet.GetDataSize());
+
+			if (PushCommand(*m_shards[i], std::move(command)))
+				acceptedCount++;
+		}
+
+		return acceptedCount;
+	}
+
+	/*!
+	* \brief Pops the next event reported by one of the shards
+	* \return true If an event was retrieved
+	*
+	* Shards are polled in turn so a busy one can't starve the others.
+	*
+	* \param event Event to fill
+	*/
+
+	bool ENetShardedHost::CheckEvents(ENetEvent* event)
+	{
+		if (!event)
+			return false;
+
+		for (std::size_t i = 0; i < m_shards.size(); ++i)
+		{
+			Shard& shard = *m_shards[m_nextShard];
+			m_nextShard = (m_nextShard + 1) % m_shards.size();
+
+			if (shard.events.TryPop(event))
+			{
+				if (event->type == ENetEventType::Disconnect)
+					shard.knownGenerations[event->peer->GetPeerId()]++;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/*!
+	* \brief Creates the host and starts the shard threads
+	* \return true If the host was created
+	*
+	* \param address Address to listen on, with a zero port to let the system pick one
+	* \param peerCount Maximum number of peers of each shard
+	* \param channelCount Maximum number of channels of each peer
+	* \param shardCount Number of shards, zero to use one per hardware thread
+	*
+	* \remark Produces a NazaraAssert if address is invalid
+	*/
+
+	bool ENetShardedHost::Create(const IpAddress& address, std::size_t peerCount, std::size_t channelCount, std::size_t shardCount)
+	{
+		NazaraAssert(address.IsValid(), "Invalid listening address");
+
+		Destroy();
+
+		if (shardCount == 0)
+			shardCount = std::max(Thread::HardwareConcurrency(), 1U);
+
+		if (shardCount > 1)
+		{
+			UdpSocket socket(address.GetProtocol());
+			if (!socket.EnableReusePort())
+			{
+				NazaraWarning("This system can't balance a port between sockets, falling back to a single shard");
+				shardCount = 1;
+			}
+		}
+
+		IpAddress shardAddress = address;
+		m_shards.reserve(shardCount);
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			std::unique_ptr<Shard> shard = std::make_unique<Shard>(peerCount);
+			shard->host.EnableReusePort(shardCount > 1);
+
+			if (!shard->host.Create(shardAddress, peerCount, channelCount))
+			{
+				NazaraError("Failed to create shard #" + String::Number(i));
+				m_shards.clear();
+				return false;
+			}
+
+			// Next shards have to bind the port picked by the system for the first one
+			shardAddress = shard->host.GetBoundAddress();
+
+			m_shards.emplace_back(std::move(shard));
+		}
+
+		m_address = shardAddress;
+		m_nextShard = 0;
+		m_isRunning.store(true, std::memory_order_release);
+
+		for (std::size_t i = 0; i < m_shards.size(); ++i)
+		{
+			Shard* shard = m_shards[i].get();
+
+			shard->thread = Thread([this, shard]() { RunShard(*shard); });
+			shard->thread.SetName("ENet shard #" + String::Number(i));
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Stops the shard threads and destroys their hosts
+	*
+	* Peers are dropped without being notified, like ENetHost::Destroy does.
+	*/
+
+	void ENetShardedHost::Destroy()
+	{
+		m_isRunning.store(false, std::memory_order_release);
+
+		for (const auto& shard : m_shards)
+		{
+			if (shard->thread.IsJoinable())
+				shard->thread.Join();
+		}
+
+		m_shards.clear();
+	}
+
+	/*!
+	* \brief Asks a peer to disconnect
+	* \return true If the request was forwarded to the shard of the peer
+	*
+	* A Disconnect event is reported once the peer acknowledged it (or timed out).
+	*
+	* \param peer Peer to disconnect, as reported by an event
+	* \param data User data sent to the peer
+	*/
+
+	bool ENetShardedHost::Disconnect(ENetPeer* peer, UInt32 data)
+	{
+		Shard* shard = GetShard(peer);
+		if (!shard)
+			return false;
+
+		Command command;
+		command.type = CommandType::Disconnect;
+		command.peer = peer;
+		command.data = data;
+		command.generation = shard->knownGenerations[peer->GetPeerId()];
+
+		return PushCommand(*shard, std::move(command));
+	}
+
+	/*!
+	* \brief Sends a packet to a peer
+	* \return true If the packet was forwarded to the shard of the peer
+	*
+	* The packet is sent by the shard thread, or silently dropped if the peer disconnected in the meantime.
+	*
+	* \param peer Peer to send the packet to, as reported by an event
+	* \param channelId Channel to send the packet on
+	* \param flags Packet flags
+	* \param packet Packet to send
+	*/
+
+	bool ENetShardedHost::Send(ENetPeer* peer, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet)
+	{
+		Shard* shard = GetShard(peer);
+		if (!shard)
+			return false;
+
+		Command command;
+		command.type = CommandType::Send;
+		command.peer = peer;
+		command.channelId = channelId;
+		command.flags = flags;
+		command.packet = std::move(packet);
+		command.generation = shard->knownGenerations[peer->GetPeerId()];
+
+		return PushCommand(*shard, std::move(command));
+	}
+
+	ENetShardedHost::Shard* ENetShardedHost::GetShard(const ENetPeer* peer)
+	{
+		NazaraAssert(peer, "Invalid peer");
+
+		for (const auto& shard : m_shards)
+		{
+			if (peer->GetHost() == &shard->host)
+				return shard.get();
+		}
+
+		NazaraError("Peer doesn't belong to this host");
+		return nullptr;
+	}
+
+	void ENetShardedHost::ProcessCommands(Shard& shard)
+	{
+		Command command;
+		while (shard.commands.TryPop(&command))
+		{
+			switch (command.type)
+			{
+				case CommandType::Broadcast:
+					shard.host.Broadcast(command.channelId, command.flags, std::move(command.packet));
+					break;
+
+				case CommandType::Disconnect:
+				case CommandType::Send:
+				{
+					// The peer disconnected (and its slot may have been reused) since the user got it
+					if (shard.peerGenerations[command.peer->GetPeerId()] != command.generation)
+						break;
+
+					if (command.type == CommandType::Disconnect)
+						command.peer->Disconnect(command.data);
+					else
+						command.peer->Send(command.channelId, command.flags, std::move(command.packet));
+
+					break;
+				}
+			}
+		}
+	}
+
+	bool ENetShardedHost::PushCommand(Shard& shard, Command&& command)
+	{
+		if (!shard.commands.TryPush(std::move(command)))
+		{
+			NazaraWarning("Command queue of shard is full, the shard thread can't keep up");
+			return false;
+		}
+
+		return true;
+	}
+
+	void ENetShardedHost::RunShard(Shard& shard)
+	{
+		ENetEvent event;
+		bool hasPendingEvent = false;
+
+		while (m_isRunning.load(std::memory_order_acquire))
+		{
+			ProcessCommands(shard);
+
+			// Events have to be reported in order, the host isn't serviced until the user makes room for the last one
+			if (hasPendingEvent)
+			{
+				if (!shard.events.TryPush(std::move(event)))
+				{
+					Thread::Sleep(1);
+					continue;
+				}
+
+				hasPendingEvent = false;
+			}
+
+			int serviceResult = shard.host.Service(&event, ServiceTimeout);
+			if (serviceResult < 0)
+			{
+				// Errors happen before waiting on the socket, don't spin while they last
+				Thread::Sleep(1);
+				continue;
+			}
+			else if (serviceResult == 0)
+				continue;
+
+			do
+			{
+				if (event.type == ENetEventType::Disconnect)
+					shard.peerGenerations[event.peer->GetPeerId()]++;
+
+				if (!shard.events.TryPush(std::move(event)))
+				{
+					hasPendingEvent = true;
+					break;
+				}
+			}
+			while (shard.host.CheckEvents(&event));
+		}
+	}
+
+	ENetShardedHost::Shard::Shard(std::size_t peerCount) :
+	commands(CommandQueueSize),
+	events(EventQueueSize),
+	knownGenerations(peerCount, 0),
+	peerGenerations(peerCount, 0)
+	{
+	}
+}
@@ -9,6 +9,7 @@
 #include <Nazara/Network/Posix/IpAddressImpl.hpp>
 #include <netinet/tcp.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <poll.h>
@@ -18,6 +19,20 @@
 
 namespace Nz
 {
+	namespace
+	{
+		#ifdef NAZARA_PLATFORM_LINUX
+		using MessageHeader = mmsghdr;
+		#else
+		// Mirrors mmsghdr on platforms lacking recvmmsg/sendmmsg, where datagrams are handled one at a time
+		struct MessageHeader
+		{
+			msghdr msg_hdr;
+			unsigned int msg_len;
+		};
+		#endif
+	}
+
 	constexpr int SOCKET_ERROR = -1;
 
 	SocketHandle SocketImpl::Accept(SocketHandle handle, IpAddress* address, SocketError* error)
@@ -503,6 +518,103 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackAllocation bufferMemory = NazaraStackAllocation(bufferCount * sizeof(iovec));
+		StackAllocation messageMemory = NazaraStackAllocation(datagramCount * sizeof(MessageHeader));
+		StackAllocation nameMemory = NazaraStackAllocation(datagramCount * sizeof(IpAddressImpl::SockAddrBuffer));
+
+		struct iovec* sysBuffers = static_cast<struct iovec*>(bufferMemory.GetPtr());
+		MessageHeader* messages = static_cast<MessageHeader*>(messageMemory.GetPtr());
+		IpAddressImpl::SockAddrBuffer* nameBuffers = static_cast<IpAddressImpl::SockAddrBuffer*>(nameMemory.GetPtr());
+
+		struct iovec* datagramBuffers = sysBuffers;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				datagramBuffers[j].iov_base = datagram.buffers[j].data;
+				datagramBuffers[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			struct msghdr& msgHdr = messages[i].msg_hdr;
+			msgHdr.msg_name = nameBuffers[i].data();
+			msgHdr.msg_namelen = static_cast<socklen_t>(nameBuffers[i].size());
+			msgHdr.msg_iov = datagramBuffers;
+			msgHdr.msg_iovlen = datagram.bufferCount;
+			msgHdr.msg_control = nullptr;
+			msgHdr.msg_controllen = 0;
+			msgHdr.msg_flags = 0;
+
+			datagramBuffers += datagram.bufferCount;
+		}
+
+		#ifdef NAZARA_PLATFORM_LINUX
+		// Read every datagram already there with one call, without waiting for more than the first one
+		int messageCount = recvmmsg(handle, messages, static_cast<unsigned int>(datagramCount), MSG_WAITFORONE, nullptr);
+		#else
+		int messageCount = 0;
+		while (messageCount < static_cast<int>(datagramCount))
+		{
+			// Only the first read may block
+			ssize_t byteRead = recvmsg(handle, &messages[messageCount].msg_hdr, (messageCount > 0) ? MSG_DONTWAIT : 0);
+			if (byteRead == SOCKET_ERROR)
+			{
+				if (messageCount == 0)
+					messageCount = SOCKET_ERROR;
+
+				break;
+			}
+
+			messages[messageCount++].msg_len = static_cast<unsigned int>(byteRead);
+		}
+		#endif
+
+		if (messageCount == SOCKET_ERROR)
+		{
+			int errorCode = GetLastErrorCode();
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			switch (errorCode)
+			{
+				case EWOULDBLOCK:
+					messageCount = 0;
+					break;
+
+				default:
+				{
+					if (error)
+						*error = TranslateErrnoToResolveError(errorCode);
+
+					return false; //< Error
+				}
+			}
+		}
+
+		for (int i = 0; i < messageCount; ++i)
+		{
+			datagrams[i].address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffers[i].data()));
+			datagrams[i].dataLength = messages[i].msg_len;
+		}
+
+		if (received)
+			*received = static_cast<std::size_t>(messageCount);
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -598,6 +710,86 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackAllocation bufferMemory = NazaraStackAllocation(bufferCount * sizeof(iovec));
+		StackAllocation messageMemory = NazaraStackAllocation(datagramCount * sizeof(MessageHeader));
+		StackAllocation nameMemory = NazaraStackAllocation(datagramCount * sizeof(IpAddressImpl::SockAddrBuffer));
+
+		struct iovec* sysBuffers = static_cast<struct iovec*>(bufferMemory.GetPtr());
+		MessageHeader* messages = static_cast<MessageHeader*>(messageMemory.GetPtr());
+		IpAddressImpl::SockAddrBuffer* nameBuffers = static_cast<IpAddressImpl::SockAddrBuffer*>(nameMemory.GetPtr());
+
+		struct iovec* datagramBuffers = sysBuffers;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+			NazaraAssert(datagram.address.IsValid(), "Invalid ip address");
+
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				datagramBuffers[j].iov_base = datagram.buffers[j].data;
+				datagramBuffers[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			struct msghdr& msgHdr = messages[i].msg_hdr;
+			msgHdr.msg_name = nameBuffers[i].data();
+			msgHdr.msg_namelen = IpAddressImpl::ToSockAddr(datagram.address, nameBuffers[i].data());
+			msgHdr.msg_iov = datagramBuffers;
+			msgHdr.msg_iovlen = datagram.bufferCount;
+			msgHdr.msg_control = nullptr;
+			msgHdr.msg_controllen = 0;
+			msgHdr.msg_flags = 0;
+
+			datagramBuffers += datagram.bufferCount;
+		}
+
+		std::size_t messageCount = 0;
+		while (messageCount < datagramCount)
+		{
+			#ifdef NAZARA_PLATFORM_LINUX
+			int messageSent = sendmmsg(handle, &messages[messageCount], static_cast<unsigned int>(datagramCount - messageCount), MSG_NOSIGNAL);
+			#else
+			int messageSent = (sendmsg(handle, &messages[messageCount].msg_hdr, MSG_NOSIGNAL) == SOCKET_ERROR) ? SOCKET_ERROR : 1;
+			#endif
+
+			if (messageSent == SOCKET_ERROR)
+			{
+				int errorCode = GetLastErrorCode();
+				if (errorCode == EAGAIN)
+					errorCode = EWOULDBLOCK;
+
+				if (errorCode == EWOULDBLOCK)
+					break; //< Send buffer is full, the remaining datagrams are left to the caller
+
+				if (sent)
+					*sent = messageCount;
+
+				if (error)
+					*error = TranslateErrnoToResolveError(errorCode);
+
+				return false; //< Error
+			}
+
+			messageCount += messageSent;
+		}
+
+		if (sent)
+			*sent = messageCount;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -806,6 +998,34 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+
+		#ifdef SO_REUSEPORT
+		int option = reusePort ? 1 : 0;
+		if (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&option), sizeof(option)) == SOCKET_ERROR)
+		{
+			if (error)
+				*error = TranslateErrnoToResolveError(GetLastErrorCode());
+
+			return false; //< Error
+		}
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+		#else
+		NazaraUnused(reusePort);
+
+		if (error)
+			*error = SocketError_NotSupported;
+
+		return false;
+		#endif
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
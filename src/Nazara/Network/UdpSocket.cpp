@@ -65,6 +65,35 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Allows other sockets to bind the same port
+	* \return true If the socket is now in the requested mode
+	*
+	* When several sockets of the same process bind the same address with this option, incoming datagrams are balanced
+	* between them by the system according to their source address, which keeps every remote host on the same socket.
+	*
+	* \param reusePort Should the port be shared
+	*
+	* \remark This must be called before binding the socket
+	* \remark This is only supported on systems providing SO_REUSEPORT with load balancing (such as Linux), it fails with SocketError_NotSupported otherwise
+	* \remark Produces a NazaraAssert if socket is invalid
+	*/
+
+	bool UdpSocket::EnableReusePort(bool reusePort)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+
+		if (m_isReusePortEnabled != reusePort)
+		{
+			if (!SocketImpl::SetReusePort(m_handle, reusePort, &m_lastError))
+				return false;
+
+			m_isReusePortEnabled = reusePort;
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Gets the maximum datagram size allowed
 	* \return Number of bytes
@@ -118,6 +147,29 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives multiple datagrams at once
+	* \return true If no error occurred
+	*
+	* \param datagrams Datagrams to fill, each one scattering its data into its buffers, the sender address and the datagram size are written into them
+	* \param datagramCount Maximum number of datagrams to receive
+	* \param received Optional argument to get the number of datagrams received (0 if none was waiting on a non-blocking socket)
+	*
+	* On Linux, every datagram waiting (up to datagramCount) is read with a single system call (recvmmsg),
+	* other platforms read them one at a time. A blocking socket only waits for the first datagram.
+	*
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark Produces a NazaraAssert if datagrams are invalid
+	*/
+
+	bool UdpSocket::ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		return SocketImpl::ReceiveDatagrams(m_handle, datagrams, datagramCount, received, &m_lastError);
+	}
+
 	/*!
 	* \brief Receives the packet available
 	* \return true If packet received
@@ -196,6 +248,32 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sends multiple datagrams at once
+	* \return true If no error occurred
+	*
+	* \param datagrams Datagrams to send, each one gathering its buffers, to its own address (which must match socket protocol)
+	* \param datagramCount Number of datagrams to send
+	* \param sent Optional argument to get the number of datagrams sent
+	*
+	* On Linux, datagrams are sent with as few system calls as possible (sendmmsg), other platforms send them one at a time.
+	* If the send buffer of a non-blocking socket gets full, sending stops there and sent is less than datagramCount: the remaining datagrams (starting at datagrams[*sent]) were not sent and can be sent again later.
+	*
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark Produces a NazaraAssert if datagrams are invalid
+	*/
+
+	bool UdpSocket::SendDatagrams(const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			NazaraAssert(datagrams[i].address.GetProtocol() == m_protocol, "IP Address has a different protocol than the socket");
+
+		return SocketImpl::SendDatagrams(m_handle, datagrams, datagramCount, sent, &m_lastError);
+	}
+
 	/*!
 	* \brief Sends multiple buffers as one datagram
 	* \return true If data were sent
@@ -266,5 +344,6 @@ namespace Nz
 
 		m_boundAddress = IpAddress::Invalid;
 		m_isBroadCastingEnabled = false;
+		m_isReusePortEnabled = false;
 	}
 }
@@ -7,6 +7,7 @@
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
 #include <Nazara/Network/Win32/IpAddressImpl.hpp>
+#include <algorithm>
 
 #if defined(NAZARA_COMPILER_MINGW) && __GNUC__ < 5
 // Some compilers (olders versions of MinGW) are lacking Mstcpip.h which defines the following struct/#define
@@ -531,6 +532,71 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t maxBufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			maxBufferCount = std::max(maxBufferCount, datagrams[i].bufferCount);
+
+		StackAllocation memory = NazaraStackAllocation(maxBufferCount * sizeof(WSABUF));
+		WSABUF* winBuffers = static_cast<WSABUF*>(memory.GetPtr());
+
+		// Windows has no batched receive, read datagrams one at a time until there's no more waiting
+		std::size_t datagramReceived = 0;
+		for (; datagramReceived < datagramCount; ++datagramReceived)
+		{
+			NetDatagram& datagram = datagrams[datagramReceived];
+
+			// Only the first read may block
+			if (datagramReceived > 0)
+			{
+				u_long available = 0;
+				if (ioctlsocket(handle, FIONREAD, &available) == SOCKET_ERROR || available == 0)
+					break;
+			}
+
+			for (std::size_t i = 0; i < datagram.bufferCount; ++i)
+			{
+				winBuffers[i].buf = static_cast<CHAR*>(datagram.buffers[i].data);
+				winBuffers[i].len = static_cast<ULONG>(datagram.buffers[i].dataLength);
+			}
+
+			IpAddressImpl::SockAddrBuffer nameBuffer;
+			int bufferLength = static_cast<int>(nameBuffer.size());
+
+			DWORD byteRead;
+			DWORD flags = 0;
+			if (WSARecvFrom(handle, winBuffers, static_cast<DWORD>(datagram.bufferCount), &byteRead, &flags, reinterpret_cast<sockaddr*>(nameBuffer.data()), &bufferLength, nullptr, nullptr) == SOCKET_ERROR)
+			{
+				int errorCode = WSAGetLastError();
+				if (errorCode == WSAEWOULDBLOCK)
+					break;
+
+				if (datagramReceived > 0)
+					break; //< Report what we already received, the error will happen again on the next call
+
+				if (error)
+					*error = TranslateWSAErrorToSocketError(errorCode);
+
+				return false; //< Error
+			}
+
+			datagram.address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffer.data()));
+			datagram.dataLength = byteRead;
+		}
+
+		if (received)
+			*received = datagramReceived;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -622,6 +688,39 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// Windows has no batched send, send datagrams one at a time
+		std::size_t datagramSent = 0;
+		for (; datagramSent < datagramCount; ++datagramSent)
+		{
+			const NetDatagram& datagram = datagrams[datagramSent];
+
+			int byteSent;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, error))
+			{
+				if (sent)
+					*sent = datagramSent;
+
+				return false; //< Error
+			}
+
+			if (byteSent == 0)
+				break; //< Send buffer is full, the remaining datagrams are left to the caller
+		}
+
+		if (sent)
+			*sent = datagramSent;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -808,6 +907,19 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraUnused(handle);
+		NazaraUnused(reusePort);
+
+		// SO_REUSEADDR allows several sockets to bind the same port on Windows but doesn't balance datagrams between them
+		if (error)
+			*error = SocketError_NotSupported;
+
+		return false;
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
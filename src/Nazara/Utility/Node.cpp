@@ -3,10 +3,18 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Node.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Const getters may update the derived data of the same nodes from several threads (Nazara mutexes are recursive)
+		Mutex s_derivedMutex;
+	}
+
 	Node::Node() :
 	m_initialRotation(Quaternionf::Identity()),
 	m_rotation(Quaternionf::Identity()),
@@ -651,12 +659,22 @@ namespace Nz
 
 	void Node::InvalidateNode()
 	{
-		m_derivedUpdated = false;
-		m_transformMatrixUpdated = false;
+		// A node cannot be up to date while its parent is not, an invalidated node has invalidated its childs already
+		// (they are invalidated again once the node has been updated), but its own listeners are always notified
+		if (m_derivedUpdated)
+		{
+			m_derivedUpdated = false;
+			m_transformMatrixUpdated = false;
 
-		for (Node* node : m_childs)
-			node->InvalidateNode();
+			for (Node* node : m_childs)
+				node->InvalidateNode();
+		}
 
+		OnInvalidation();
+	}
+
+	void Node::OnInvalidation()
+	{
 		OnNodeInvalidation(this);
 	}
 
@@ -676,6 +694,10 @@ namespace Nz
 
 	void Node::UpdateDerived() const
 	{
+		LockGuard lock(s_derivedMutex);
+		if (m_derivedUpdated.load(std::memory_order_relaxed))
+			return; // Updated by another thread while we were waiting
+
 		if (m_parent)
 		{
 			if (!m_parent->m_derivedUpdated)
@@ -705,15 +727,19 @@ namespace Nz
 			m_derivedScale = m_initialScale * m_scale;
 		}
 
-		m_derivedUpdated = true;
+		m_derivedUpdated.store(true, std::memory_order_release);
 	}
 
 	void Node::UpdateTransformMatrix() const
 	{
+		LockGuard lock(s_derivedMutex);
+		if (m_transformMatrixUpdated.load(std::memory_order_relaxed))
+			return; // Updated by another thread while we were waiting
+
 		if (!m_derivedUpdated)
 			UpdateDerived();
 
 		m_transformMatrix.MakeTransform(m_derivedPosition, m_derivedRotation, m_derivedScale);
-		m_transformMatrixUpdated = true;
+		m_transformMatrixUpdated.store(true, std::memory_order_release);
 	}
 }
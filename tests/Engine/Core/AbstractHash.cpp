@@ -2,6 +2,7 @@
 #include <Catch/catch.hpp>
 
 #include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Hash/CRC32C.hpp>
 
 #include <array>
 
@@ -24,4 +25,40 @@ SCENARIO("AbstractHash", "[CORE][ABSTRACTHASH]")
 			}
 		}
 	}
+
+	GIVEN("The hash CRC32C")
+	{
+		std::unique_ptr<Nz::AbstractHash> CRC32C = Nz::AbstractHash::Get(Nz::HashType_CRC32C);
+		CRC32C->Begin();
+
+		WHEN("We introduce the standard check string")
+		{
+			const char check[] = "123456789";
+			CRC32C->Append(reinterpret_cast<const Nz::UInt8*>(check), 9);
+
+			THEN("We should get the reference value")
+			{
+				Nz::ByteArray byteArray = CRC32C->End();
+				std::array<Nz::UInt8, 4> expected{ { 0xE3, 0x06, 0x92, 0x83 } };
+				CHECK(byteArray == Nz::ByteArray(expected.data(), expected.size()));
+				CHECK(Nz::HashCRC32C::Compute(check, 9) == 0xE3069283);
+			}
+		}
+
+		WHEN("We compute it on data split in several parts")
+		{
+			std::array<Nz::UInt8, 1000> data;
+			for (std::size_t i = 0; i < data.size(); ++i)
+				data[i] = static_cast<Nz::UInt8>(i * 7);
+
+			Nz::UInt32 crc = Nz::HashCRC32C::Compute(data.data(), 3);
+			crc = Nz::HashCRC32C::Compute(data.data() + 3, 500, crc);
+			crc = Nz::HashCRC32C::Compute(data.data() + 503, data.size() - 503, crc);
+
+			THEN("It should match the one computed at once")
+			{
+				CHECK(crc == Nz::HashCRC32C::Compute(data.data(), data.size()));
+			}
+		}
+	}
 }
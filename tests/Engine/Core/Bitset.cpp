@@ -2,8 +2,10 @@
 #include <Nazara/Core/Bitset.hpp>
 #include <Catch/catch.hpp>
 #include <array>
+#include <random>
 #include <string>
 #include <iostream>
+#include <vector>
 
 template<typename Block> void Check(const char* title);
 template<typename Block> void CheckAppend(const char* title);
@@ -115,6 +117,101 @@ void CheckBitOps(const char* title)
 				}
 			}
 		}
+
+		GIVEN("Two large bitsets of different sizes")
+		{
+			// Large enough to go through the SIMD paths, with a remainder
+			constexpr std::size_t firstSize = 1000;
+			constexpr std::size_t secondSize = 700;
+
+			std::mt19937 generator(42);
+			std::bernoulli_distribution distribution(0.3);
+
+			Nz::Bitset<Block> first(firstSize, false);
+			for (std::size_t i = 0; i < firstSize; ++i)
+				first.Set(i, distribution(generator));
+
+			Nz::Bitset<Block> second(secondSize, false);
+			for (std::size_t i = 0; i < secondSize; ++i)
+				second.Set(i, distribution(generator));
+
+			WHEN("We perform operators")
+			{
+				Nz::Bitset<Block> andBitset = first & second;
+				Nz::Bitset<Block> orBitset = first | second;
+				Nz::Bitset<Block> xorBitset = first ^ second;
+				Nz::Bitset<Block> notBitset = ~first;
+
+				THEN("They should match a bit by bit computation")
+				{
+					std::size_t expectedCount = 0;
+					bool expectedIntersection = false;
+					for (std::size_t i = 0; i < firstSize; ++i)
+					{
+						bool a = first.Test(i);
+						bool b = (i < secondSize) ? second.Test(i) : false;
+
+						CHECK(andBitset.Test(i) == (a && b));
+						CHECK(orBitset.Test(i) == (a || b));
+						CHECK(xorBitset.Test(i) == (a != b));
+						CHECK(notBitset.Test(i) == !a);
+
+						if (a)
+							expectedCount++;
+
+						if (a && b)
+							expectedIntersection = true;
+					}
+
+					CHECK(first.Count() == expectedCount);
+					CHECK(notBitset.Count() == firstSize - expectedCount);
+					CHECK(first.Intersects(second) == expectedIntersection);
+					CHECK(!first.Intersects(notBitset));
+					CHECK((first & notBitset).TestNone());
+				}
+			}
+
+			WHEN("We iterate on enabled bits")
+			{
+				std::vector<std::size_t> expectedBits;
+				for (std::size_t i = first.FindFirst(); i != first.npos; i = first.FindNext(i))
+					expectedBits.push_back(i);
+
+				std::vector<std::size_t> bits;
+				first.ForEachSetBit([&](std::size_t bit) { bits.push_back(bit); });
+
+				THEN("We should get the same bits as with FindFirst/FindNext")
+				{
+					CHECK(expectedBits.size() == first.Count());
+					CHECK(bits == expectedBits);
+				}
+			}
+
+			WHEN("We reset and set bits while iterating")
+			{
+				Nz::Bitset<Block> bitset(firstSize, false);
+				bitset.Set(10, true);
+				bitset.Set(11, true);
+				bitset.Set(500, true);
+
+				std::vector<std::size_t> bits;
+				bitset.ForEachSetBit([&](std::size_t bit)
+				{
+					bits.push_back(bit);
+					if (bit == 10)
+					{
+						bitset.Reset(11);
+						bitset.Set(12, true);
+						bitset.Set(900, true);
+					}
+				});
+
+				THEN("Changes after the current bit should be taken into account")
+				{
+					CHECK(bits == std::vector<std::size_t>({10, 12, 500, 900}));
+				}
+			}
+		}
 	}
 }
 
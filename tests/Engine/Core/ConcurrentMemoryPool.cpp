@@ -0,0 +1,143 @@
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Math/Vector2.hpp>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+SCENARIO("ConcurrentMemoryPool", "[CORE][CONCURRENTMEMORYPOOL]")
+{
+	GIVEN("A ConcurrentMemoryPool of Nz::Vector2<int> with small chunks")
+	{
+		Nz::ConcurrentMemoryPool memoryPool(sizeof(Nz::Vector2<int>), 64);
+
+		WHEN("We construct a Nz::Vector2<int>")
+		{
+			Nz::Vector2<int>* vector2 = memoryPool.New<Nz::Vector2<int>>(1, 2);
+
+			THEN("Memory is available and belongs to the pool")
+			{
+				vector2->x = 3;
+				CHECK(*vector2 == Nz::Vector2<int>(3, 2));
+				CHECK(memoryPool.IsOwnerOf(vector2));
+
+				memoryPool.Delete(vector2);
+			}
+		}
+
+		WHEN("We allocate more blocks than a chunk holds")
+		{
+			std::set<void*> blocks;
+			for (unsigned int i = 0; i < memoryPool.GetBlocksPerChunk() * 3; ++i)
+				blocks.insert(memoryPool.Allocate());
+
+			THEN("The pool grows and every block is distinct")
+			{
+				CHECK(blocks.size() == memoryPool.GetBlocksPerChunk() * 3);
+				CHECK(memoryPool.GetChunkCount() >= 3);
+
+				for (void* block : blocks)
+					memoryPool.Free(block);
+			}
+		}
+
+		WHEN("We free blocks and allocate again")
+		{
+			std::vector<void*> blocks;
+			for (unsigned int i = 0; i < 1000; ++i)
+				blocks.push_back(memoryPool.Allocate());
+
+			std::size_t chunkCount = memoryPool.GetChunkCount();
+
+			for (void* block : blocks)
+				memoryPool.Free(block);
+
+			for (void*& block : blocks)
+				block = memoryPool.Allocate();
+
+			THEN("Blocks are reused")
+			{
+				CHECK(memoryPool.GetChunkCount() == chunkCount);
+
+				for (void* block : blocks)
+					memoryPool.Free(block);
+			}
+		}
+
+		WHEN("Another pool checks ownership of our blocks")
+		{
+			Nz::ConcurrentMemoryPool otherPool(sizeof(Nz::Vector2<int>), 64);
+			void* block = memoryPool.Allocate();
+
+			THEN("It does not claim them")
+			{
+				CHECK_FALSE(otherPool.IsOwnerOf(block));
+				memoryPool.Free(block);
+			}
+		}
+	}
+
+	GIVEN("A ConcurrentMemoryPool shared between threads")
+	{
+		Nz::ConcurrentMemoryPool memoryPool(sizeof(int), 128);
+
+		WHEN("Threads free blocks allocated by other threads")
+		{
+			constexpr unsigned int threadCount = 4;
+			constexpr unsigned int blockPerThread = 2000;
+
+			std::vector<std::vector<int*>> allocated(threadCount);
+			std::vector<std::thread> threads;
+			for (unsigned int i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([&, i]()
+				{
+					for (unsigned int j = 0; j < blockPerThread; ++j)
+						allocated[i].push_back(memoryPool.New<int>(static_cast<int>(i * blockPerThread + j)));
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			threads.clear();
+
+			std::atomic<bool> valuesPreserved(true);
+			for (unsigned int i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([&, i]()
+				{
+					const std::vector<int*>& blocks = allocated[(i + 1) % threadCount];
+					for (unsigned int j = 0; j < blocks.size(); ++j)
+					{
+						if (*blocks[j] != static_cast<int>(((i + 1) % threadCount) * blockPerThread + j))
+							valuesPreserved = false;
+
+						memoryPool.Delete(blocks[j]);
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			THEN("No block was given twice and they can be reused")
+			{
+				CHECK(valuesPreserved);
+
+				std::size_t chunkCount = memoryPool.GetChunkCount();
+
+				std::vector<void*> blocks;
+				for (unsigned int i = 0; i < threadCount * blockPerThread; ++i)
+					blocks.push_back(memoryPool.Allocate());
+
+				CHECK(memoryPool.GetChunkCount() == chunkCount);
+
+				for (void* block : blocks)
+					memoryPool.Free(block);
+			}
+		}
+	}
+}
@@ -0,0 +1,145 @@
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/FrameAllocator.hpp>
+#include <Catch/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+SCENARIO("FrameArena", "[CORE][FRAMEARENA]")
+{
+	GIVEN("A FrameArena with small blocks")
+	{
+		Nz::FrameArena arena(256);
+
+		CHECK(arena.GetCapacity() == 0);
+		CHECK(arena.GetUsedSize() == 0);
+
+		WHEN("We allocate with different alignments")
+		{
+			void* first = arena.Allocate(3, 1);
+			void* second = arena.Allocate(8, 8);
+			void* third = arena.Allocate(16, 64);
+
+			THEN("Pointers are aligned and follow each other")
+			{
+				CHECK(reinterpret_cast<std::uintptr_t>(second) % 8 == 0);
+				CHECK(reinterpret_cast<std::uintptr_t>(third) % 64 == 0);
+				CHECK(static_cast<Nz::UInt8*>(second) >= static_cast<Nz::UInt8*>(first) + 3);
+				CHECK(static_cast<Nz::UInt8*>(third) >= static_cast<Nz::UInt8*>(second) + 8);
+			}
+		}
+
+		WHEN("We allocate more than a block can hold")
+		{
+			int* values = arena.AllocateArray<int>(1000);
+			for (int i = 0; i < 1000; ++i)
+				values[i] = i;
+
+			for (int i = 0; i < 10; ++i)
+				arena.New<int>(i);
+
+			THEN("The arena grows")
+			{
+				CHECK(arena.GetCapacity() >= 1000 * sizeof(int));
+				CHECK(values[999] == 999);
+			}
+
+			AND_WHEN("We reset it and allocate the same amount")
+			{
+				std::size_t capacity = arena.GetCapacity();
+				void* first = values;
+
+				arena.Reset();
+				CHECK(arena.GetUsedSize() == 0);
+
+				int* newValues = arena.AllocateArray<int>(1000);
+				for (int i = 0; i < 10; ++i)
+					arena.New<int>(i);
+
+				THEN("Memory is reused")
+				{
+					CHECK(arena.GetCapacity() == capacity);
+					CHECK(newValues == first);
+				}
+			}
+		}
+
+		WHEN("We allocate an array too big to be represented")
+		{
+			Nz::ErrorFlags flags(Nz::ErrorFlag_Silent);
+
+			std::size_t count = std::numeric_limits<std::size_t>::max() / sizeof(int) + 1;
+
+			THEN("Allocation fails instead of returning a too small block")
+			{
+				CHECK(arena.AllocateArray<int>(count) == nullptr);
+				CHECK(arena.GetUsedSize() == 0);
+			}
+		}
+
+		WHEN("We release it")
+		{
+			arena.Allocate(100);
+			arena.Release();
+
+			THEN("It holds no memory anymore")
+			{
+				CHECK(arena.GetCapacity() == 0);
+				CHECK(arena.GetUsedSize() == 0);
+			}
+		}
+
+		WHEN("We move it into another arena")
+		{
+			int* value = arena.New<int>(42);
+
+			Nz::FrameArena movedArena(std::move(arena));
+
+			THEN("The memory belongs to the new arena and the moved one starts over")
+			{
+				CHECK(*value == 42);
+				CHECK(movedArena.GetCapacity() == 256);
+				CHECK(movedArena.GetUsedSize() >= sizeof(int));
+				CHECK(arena.GetCapacity() == 0);
+				CHECK(arena.GetUsedSize() == 0);
+
+				int* otherValue = arena.New<int>(1);
+				CHECK(*value == 42);
+				CHECK(*otherValue == 1);
+				CHECK(arena.GetCapacity() == 256);
+			}
+
+			AND_WHEN("We move it back")
+			{
+				arena = std::move(movedArena);
+
+				THEN("Allocations continue after the previous ones")
+				{
+					int* otherValue = arena.New<int>(1);
+					CHECK(otherValue != value);
+					CHECK(*value == 42);
+					CHECK(movedArena.GetCapacity() == 0);
+					CHECK(movedArena.GetUsedSize() == 0);
+				}
+			}
+		}
+
+		WHEN("A vector uses a FrameAllocator")
+		{
+			Nz::FrameVector<int> vector{Nz::FrameAllocator<int>(arena)};
+			for (int i = 0; i < 100; ++i)
+				vector.push_back(i);
+
+			THEN("Its memory comes from the arena")
+			{
+				CHECK(vector.size() == 100);
+				CHECK(vector[42] == 42);
+				CHECK(arena.GetUsedSize() >= 100 * sizeof(int));
+				CHECK(&vector.get_allocator().GetArena() == &arena);
+				CHECK(Nz::FrameAllocator<float>(arena) == vector.get_allocator());
+			}
+		}
+	}
+}
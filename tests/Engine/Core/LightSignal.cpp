@@ -0,0 +1,124 @@
+#include <Nazara/Core/LightSignal.hpp>
+#include <Catch/catch.hpp>
+#include <array>
+#include <vector>
+
+namespace
+{
+	struct Incrementer
+	{
+		void increment(int* inc)
+		{
+			*inc += 1;
+		}
+	};
+
+	void increment(int* inc)
+	{
+		*inc += 1;
+	}
+}
+
+SCENARIO("LightSignal", "[CORE][LIGHTSIGNAL]")
+{
+	GIVEN("A light signal")
+	{
+		Nz::LightSignal<int*> signal;
+
+		WHEN("We connect different callbacks")
+		{
+			Incrementer incrementer;
+			std::array<int, 16> bigCapture = {};
+
+			Nz::LightSignal<int*>::ConnectionGuard functionConnection = signal.Connect(increment);
+			Nz::LightSignal<int*>::ConnectionGuard lambdaConnection = signal.Connect([](int* inc) { *inc += 1; });
+			Nz::LightSignal<int*>::ConnectionGuard methodConnection = signal.Connect(incrementer, &Incrementer::increment);
+			Nz::LightSignal<int*>::ConnectionGuard heapConnection = signal.Connect([bigCapture](int* inc) { *inc += 1 + bigCapture[0]; });
+
+			THEN("The call of signal with inc = 0 must return 4")
+			{
+				int inc = 0;
+				signal(&inc);
+				CHECK(inc == 4);
+			}
+
+			AND_THEN("When we disconnect one function, there should be only three listeners")
+			{
+				lambdaConnection.Disconnect();
+				CHECK(!lambdaConnection.IsConnected());
+
+				int inc = 0;
+				signal(&inc);
+				CHECK(inc == 3);
+			}
+
+			AND_THEN("Moving connections should keep them connected")
+			{
+				std::vector<Nz::LightSignal<int*>::ConnectionGuard> connections;
+				connections.emplace_back(std::move(methodConnection));
+				connections.emplace_back(std::move(heapConnection));
+				connections.reserve(100);
+
+				CHECK(!methodConnection.IsConnected());
+				CHECK(connections[0].IsConnected());
+
+				int inc = 0;
+				signal(&inc);
+				CHECK(inc == 4);
+
+				connections.clear();
+
+				inc = 0;
+				signal(&inc);
+				CHECK(inc == 2);
+			}
+
+			AND_THEN("Destroying the signal should disconnect everything")
+			{
+				Nz::LightSignal<int*> movedSignal(std::move(signal));
+				CHECK(signal.IsEmpty());
+
+				int inc = 0;
+				movedSignal(&inc);
+				CHECK(inc == 4);
+
+				movedSignal.Clear();
+				CHECK(!functionConnection.IsConnected());
+				CHECK(!heapConnection.IsConnected());
+			}
+		}
+
+		WHEN("Listeners are disconnected and connected while the signal is fired")
+		{
+			int inc = 0;
+
+			Nz::LightSignal<int*>::ConnectionGuard first;
+			Nz::LightSignal<int*>::ConnectionGuard second;
+			Nz::LightSignal<int*>::ConnectionGuard third;
+			Nz::LightSignal<int*>::ConnectionGuard late;
+
+			first.Connect(signal, [&](int* value)
+			{
+				*value += 1;
+
+				// Disconnect ourselves and the next listener, and connect a new one at the end
+				first.Disconnect();
+				second.Disconnect();
+				late.Connect(signal, [](int* lateValue) { *lateValue += 100; });
+			});
+			second.Connect(signal, [](int* value) { *value += 10; });
+			third.Connect(signal, [](int* value) { *value += 1000; });
+
+			signal(&inc);
+
+			THEN("Only remaining and new listeners should be called")
+			{
+				CHECK(inc == 1101);
+
+				inc = 0;
+				signal(&inc);
+				CHECK(inc == 1100);
+			}
+		}
+	}
+}
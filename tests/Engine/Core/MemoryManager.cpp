@@ -0,0 +1,90 @@
+#include <Nazara/Core/MemoryManager.hpp>
+#include <Catch/catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const Nz::MemoryManager::CallSiteStatistics* FindCallSite(const std::vector<Nz::MemoryManager::CallSiteStatistics>& statistics, const char* file, unsigned int line)
+	{
+		auto it = std::find_if(statistics.begin(), statistics.end(), [&](const Nz::MemoryManager::CallSiteStatistics& callSite)
+		{
+			return callSite.file && std::strcmp(callSite.file, file) == 0 && callSite.line == line;
+		});
+
+		return (it != statistics.end()) ? &*it : nullptr;
+	}
+}
+
+SCENARIO("MemoryManager", "[CORE][MEMORYMANAGER]")
+{
+	GIVEN("The memory manager in statistics mode")
+	{
+		bool wasFilling = Nz::MemoryManager::IsAllocationFillingEnabled();
+		Nz::MemoryManager::EnableAllocationFilling(false);
+		Nz::MemoryManager::EnableAllocationStatistics(true);
+		Nz::MemoryManager::NextFrame();
+
+		const char* file = "MemoryManagerTest.cpp";
+
+		WHEN("We allocate and free memory from multiple threads")
+		{
+			std::vector<void*> blocks;
+			for (unsigned int i = 0; i < 10; ++i)
+				blocks.push_back(Nz::MemoryManager::Allocate(32, false, file, 1));
+
+			std::thread thread([&]()
+			{
+				for (unsigned int i = 0; i < 5; ++i)
+					Nz::MemoryManager::Free(blocks[i]);
+
+				Nz::MemoryManager::Free(Nz::MemoryManager::Allocate(100, false, file, 2));
+			});
+			thread.join();
+
+			THEN("Statistics are merged per call site")
+			{
+				std::vector<Nz::MemoryManager::CallSiteStatistics> statistics;
+				Nz::MemoryManager::GetCallSiteStatistics(&statistics);
+
+				const Nz::MemoryManager::CallSiteStatistics* first = FindCallSite(statistics, file, 1);
+				REQUIRE(first);
+				CHECK(first->frameAllocationCount == 10);
+				CHECK(first->frameAllocatedSize == 320);
+				CHECK(first->allocationCount - first->freeCount == 5);
+				CHECK(first->allocatedSize - first->freedSize == 160);
+
+				const Nz::MemoryManager::CallSiteStatistics* second = FindCallSite(statistics, file, 2);
+				REQUIRE(second);
+				CHECK(second->frameAllocationCount == 1);
+				CHECK(second->allocationCount == second->freeCount);
+			}
+
+			AND_WHEN("A new frame starts")
+			{
+				Nz::MemoryManager::NextFrame();
+				Nz::MemoryManager::Free(Nz::MemoryManager::Allocate(8, false, file, 1));
+
+				THEN("Frame counters only count the allocations of this frame")
+				{
+					std::vector<Nz::MemoryManager::CallSiteStatistics> statistics;
+					Nz::MemoryManager::GetCallSiteStatistics(&statistics);
+
+					const Nz::MemoryManager::CallSiteStatistics* first = FindCallSite(statistics, file, 1);
+					REQUIRE(first);
+					CHECK(first->frameAllocationCount == 1);
+					CHECK(first->frameAllocatedSize == 8);
+				}
+			}
+
+			for (unsigned int i = 5; i < 10; ++i)
+				Nz::MemoryManager::Free(blocks[i]);
+		}
+
+		Nz::MemoryManager::EnableAllocationStatistics(false);
+		Nz::MemoryManager::EnableAllocationFilling(wasFilling);
+	}
+}
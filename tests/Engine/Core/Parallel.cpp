@@ -0,0 +1,70 @@
+#include <Nazara/Core/Parallel.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+SCENARIO("Parallel", "[CORE][PARALLEL]")
+{
+	GIVEN("An array of integers")
+	{
+		std::vector<int> values(100000);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			values[i] = static_cast<int>(i);
+
+		WHEN("We double each value with ParallelFor")
+		{
+			std::atomic<std::size_t> processedCount(0);
+
+			Nz::ParallelFor(0, values.size(), 128, [&](std::size_t first, std::size_t last)
+			{
+				for (std::size_t i = first; i < last; ++i)
+					values[i] *= 2;
+
+				processedCount += last - first;
+			});
+
+			THEN("Each value was processed exactly once")
+			{
+				CHECK(processedCount == values.size());
+
+				bool valid = true;
+				for (std::size_t i = 0; i < values.size(); ++i)
+					valid &= (values[i] == static_cast<int>(i * 2));
+
+				CHECK(valid);
+			}
+		}
+
+		WHEN("We sum the values with ParallelReduce")
+		{
+			long long sum = Nz::ParallelReduce(0, values.size(), 128, 0LL, [&](std::size_t first, std::size_t last)
+			{
+				long long partialSum = 0;
+				for (std::size_t i = first; i < last; ++i)
+					partialSum += values[i];
+
+				return partialSum;
+			}, [](long long lhs, long long rhs) { return lhs + rhs; });
+
+			THEN("We get the right result")
+			{
+				long long count = static_cast<long long>(values.size());
+				CHECK(sum == count * (count - 1) / 2);
+			}
+		}
+
+		WHEN("We use an empty range")
+		{
+			bool called = false;
+			Nz::ParallelFor(10, 10, 1, [&](std::size_t, std::size_t) { called = true; });
+			int result = Nz::ParallelReduce(10, 10, 1, 42, [](std::size_t, std::size_t) { return 0; }, [](int lhs, int rhs) { return lhs + rhs; });
+
+			THEN("Nothing is executed")
+			{
+				CHECK_FALSE(called);
+				CHECK(result == 42);
+			}
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#include <Nazara/Core/PoolAllocator.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Catch/catch.hpp>
+
+#include <array>
+#include <iterator>
+#include <vector>
+
+SCENARIO("PoolAllocator", "[CORE][POOLALLOCATOR]")
+{
+	GIVEN("A ConcurrentMemoryPool large enough for list nodes")
+	{
+		Nz::ConcurrentMemoryPool memoryPool(64, 64);
+
+		WHEN("Lists use a PoolAllocator")
+		{
+			Nz::PoolList<int> first{Nz::PoolAllocator<int>(memoryPool)};
+			Nz::PoolList<int> second{Nz::PoolAllocator<int>(memoryPool)};
+			int count = static_cast<int>(memoryPool.GetBlocksPerChunk() * 2);
+			for (int i = 0; i < count; ++i)
+				first.push_back(i);
+
+			second.splice(second.end(), first, std::next(first.begin(), 10), first.end());
+
+			THEN("Their nodes come from the pool and can be moved between them")
+			{
+				CHECK(first.size() == 10);
+				CHECK(second.size() == static_cast<std::size_t>(count - 10));
+				CHECK(second.front() == 10);
+				CHECK(memoryPool.GetChunkCount() >= 2);
+				CHECK(first.get_allocator() == second.get_allocator());
+			}
+		}
+
+		WHEN("Allocations don't fit in a block")
+		{
+			Nz::PoolAllocator<std::array<int, 32>> arrayAllocator(memoryPool);
+			Nz::PoolAllocator<int> intAllocator(arrayAllocator);
+
+			std::vector<std::array<int, 32>*> arrays;
+			std::vector<int*> integers;
+			for (unsigned int i = 0; i < 100; ++i)
+			{
+				arrays.push_back(arrayAllocator.allocate(1));
+				integers.push_back(intAllocator.allocate(3));
+			}
+
+			THEN("They fall back to the global operator new")
+			{
+				CHECK(memoryPool.GetChunkCount() == 0);
+
+				for (std::array<int, 32>* array : arrays)
+					arrayAllocator.deallocate(array, 1);
+
+				for (int* integer : integers)
+					intAllocator.deallocate(integer, 3);
+			}
+		}
+	}
+}
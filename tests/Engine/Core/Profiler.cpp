@@ -0,0 +1,108 @@
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Catch/catch.hpp>
+
+#include <thread>
+
+namespace
+{
+	Nz::String ExportTrace()
+	{
+		Nz::ByteArray data;
+		Nz::MemoryStream stream(&data);
+		REQUIRE(Nz::Profiler::ExportChromeTrace(stream));
+
+		return data.ToString();
+	}
+}
+
+SCENARIO("Profiler", "[CORE][PROFILER]")
+{
+	GIVEN("A cleared profiler")
+	{
+		Nz::Profiler::Clear();
+
+		WHEN("We profile zones while disabled")
+		{
+			Nz::Profiler::Enable(false);
+			{
+				Nz::ProfilerZone zone("DisabledZone");
+			}
+
+			THEN("Nothing is recorded")
+			{
+				CHECK_FALSE(ExportTrace().Contains("DisabledZone"));
+			}
+		}
+
+		WHEN("We profile nested zones from multiple threads")
+		{
+			Nz::Profiler::Enable(true);
+			{
+				Nz::ProfilerZone outerZone("OuterZone");
+				Nz::ProfilerZone innerZone("Inner\"Zone");
+			}
+
+			std::thread thread([]()
+			{
+				Nz::Profiler::SetThreadName("ProfiledThread");
+
+				Nz::ProfilerZone zone("ThreadZone");
+			});
+			thread.join();
+
+			Nz::Profiler::Enable(false);
+
+			THEN("They are exported in the Chrome trace format")
+			{
+				Nz::String trace = ExportTrace();
+
+				CHECK(trace.StartsWith("{\"traceEvents\":["));
+				CHECK(trace.Contains("{\"name\":\"OuterZone\",\"ph\":\"X\""));
+				CHECK(trace.Contains("\"Inner\\\"Zone\""));
+				CHECK(trace.Contains("\"ThreadZone\""));
+				CHECK(trace.Contains("\"args\":{\"name\":\"ProfiledThread\"}"));
+			}
+
+			AND_WHEN("We clear the profiler")
+			{
+				Nz::Profiler::Clear();
+
+				THEN("Zones are forgotten")
+				{
+					CHECK_FALSE(ExportTrace().Contains("OuterZone"));
+				}
+			}
+		}
+
+		WHEN("A thread records more zones than its buffer can hold")
+		{
+			std::size_t bufferSize = Nz::Profiler::GetBufferSize();
+			Nz::Profiler::SetBufferSize(4);
+			Nz::Profiler::Enable(true);
+
+			std::thread thread([]()
+			{
+				{
+					Nz::ProfilerZone zone("OldestZone");
+				}
+
+				for (int i = 0; i < 4; ++i)
+					Nz::ProfilerZone zone("RecentZone");
+			});
+			thread.join();
+
+			Nz::Profiler::Enable(false);
+			Nz::Profiler::SetBufferSize(bufferSize);
+
+			THEN("Only the most recent ones are kept")
+			{
+				Nz::String trace = ExportTrace();
+
+				CHECK_FALSE(trace.Contains("OldestZone"));
+				CHECK(trace.Contains("RecentZone"));
+			}
+		}
+	}
+}
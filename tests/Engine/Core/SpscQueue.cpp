@@ -0,0 +1,105 @@
+#include <Nazara/Core/SpscQueue.hpp>
+#include <Catch/catch.hpp>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+SCENARIO("SpscQueue", "[CORE][SPSCQUEUE]")
+{
+	GIVEN("A SpscQueue of int")
+	{
+		Nz::SpscQueue<int> queue(5);
+
+		THEN("Its capacity is rounded up to a power of two")
+		{
+			CHECK(queue.GetCapacity() == 8);
+			CHECK(queue.IsEmpty());
+		}
+
+		WHEN("We fill it")
+		{
+			for (int i = 0; i < 8; ++i)
+				REQUIRE(queue.TryPush(i));
+
+			THEN("Pushing fails until a value is popped")
+			{
+				CHECK_FALSE(queue.TryPush(8));
+
+				int value;
+				REQUIRE(queue.TryPop(&value));
+				CHECK(value == 0);
+				CHECK(queue.TryPush(8));
+			}
+
+			THEN("Values are popped in order")
+			{
+				int value;
+				for (int i = 0; i < 8; ++i)
+				{
+					REQUIRE(queue.TryPop(&value));
+					CHECK(value == i);
+				}
+
+				CHECK_FALSE(queue.TryPop(&value));
+				CHECK(queue.IsEmpty());
+			}
+		}
+
+		WHEN("A thread pushes values while another pops them")
+		{
+			constexpr int valueCount = 200000;
+
+			std::thread producer([&queue]()
+			{
+				for (int i = 0; i < valueCount; ++i)
+				{
+					while (!queue.TryPush(i))
+						std::this_thread::yield();
+				}
+			});
+
+			std::vector<int> values;
+			values.reserve(valueCount);
+			while (values.size() < valueCount)
+			{
+				int value;
+				if (queue.TryPop(&value))
+					values.push_back(value);
+				else
+					std::this_thread::yield();
+			}
+
+			producer.join();
+
+			THEN("Every value is received once and in order")
+			{
+				bool inOrder = true;
+				for (int i = 0; i < valueCount; ++i)
+					inOrder &= (values[i] == i);
+
+				CHECK(inOrder);
+				CHECK(queue.IsEmpty());
+			}
+		}
+	}
+
+	GIVEN("A SpscQueue of move-only values")
+	{
+		Nz::SpscQueue<std::unique_ptr<int>> queue(4);
+
+		WHEN("We push and pop one")
+		{
+			REQUIRE(queue.TryPush(std::make_unique<int>(42)));
+
+			std::unique_ptr<int> value;
+			REQUIRE(queue.TryPop(&value));
+
+			THEN("It is moved through the queue")
+			{
+				REQUIRE(value);
+				CHECK(*value == 42);
+			}
+		}
+	}
+}
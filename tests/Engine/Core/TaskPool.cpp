@@ -0,0 +1,134 @@
+#include <Nazara/Core/TaskPool.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+SCENARIO("TaskPool", "[CORE][TASKPOOL]")
+{
+	GIVEN("Two independent pools")
+	{
+		Nz::TaskPool latencyPool(1, "Latency", 1);
+		Nz::TaskPool backgroundPool(2, "Background");
+
+		CHECK(latencyPool.GetWorkerCount() == 1);
+		CHECK(latencyPool.GetAffinityMask() == 1);
+		CHECK(latencyPool.GetWorkerName() == "Latency");
+		CHECK(backgroundPool.GetWorkerCount() == 2);
+		CHECK_FALSE(latencyPool.IsWorkerThread());
+
+		WHEN("We add tasks to each pool")
+		{
+			// Tasks may also be executed by the thread waiting on them, but never by a worker of another pool
+			std::atomic<bool> latencyTaskDone(false);
+			std::atomic<bool> backgroundTaskDone(false);
+			std::atomic<bool> wrongPool(false);
+
+			latencyPool.AddTask([&]()
+			{
+				wrongPool = wrongPool || backgroundPool.IsWorkerThread();
+				latencyTaskDone = true;
+			});
+
+			backgroundPool.AddTask([&]()
+			{
+				wrongPool = wrongPool || latencyPool.IsWorkerThread();
+				backgroundTaskDone = true;
+			});
+
+			Nz::TaskHandle latencyBatch = latencyPool.Run();
+
+			THEN("Running a pool only submits its own tasks")
+			{
+				latencyBatch.Wait();
+				CHECK(latencyTaskDone);
+				CHECK_FALSE(backgroundTaskDone);
+
+				backgroundPool.Run();
+				backgroundPool.WaitForTasks();
+				CHECK(backgroundTaskDone);
+				CHECK_FALSE(wrongPool);
+			}
+		}
+
+		WHEN("We only submit some of our pending tasks")
+		{
+			std::atomic<bool> keptTaskDone(false);
+			std::atomic<int> submittedTaskCount(0);
+
+			backgroundPool.AddTask([&]() { keptTaskDone = true; });
+
+			Nz::TaskHandle tasks[2];
+			tasks[0] = backgroundPool.AddTask([&]() { submittedTaskCount++; });
+			tasks[1] = backgroundPool.AddTaskAfter({tasks[0]}, [&]() { submittedTaskCount++; });
+
+			Nz::TaskHandle group = backgroundPool.Run(tasks, 2);
+
+			THEN("Waiting on them leaves the other tasks pending")
+			{
+				group.Wait();
+				CHECK(submittedTaskCount == 2);
+				CHECK_FALSE(keptTaskDone);
+
+				backgroundPool.WaitForTasks();
+				CHECK(keptTaskDone);
+			}
+		}
+
+		WHEN("We use ParallelFor on a specific pool")
+		{
+			std::atomic<std::size_t> processed(0);
+			Nz::ParallelFor(backgroundPool, 0, 10000, 16, [&](std::size_t first, std::size_t last) { processed += last - first; });
+
+			THEN("The whole range is processed")
+			{
+				CHECK(processed == 10000);
+			}
+		}
+	}
+
+	GIVEN("A pool destroyed while a submitted task waits on a task which was never submitted")
+	{
+		std::shared_ptr<int> sentinel = std::make_shared<int>(42);
+		std::weak_ptr<int> sentinelRef = sentinel;
+
+		std::unique_ptr<Nz::TaskPool> pool = std::make_unique<Nz::TaskPool>(1);
+
+		Nz::TaskHandle first = pool->AddTask([]() {});
+
+		// Run only submits the tasks added by the calling thread, so the successor has to be added by another one
+		std::thread submitter([&pool, &first, sentinel]()
+		{
+			pool->AddTaskAfter({ first }, [sentinel]() {});
+			pool->Run();
+		});
+		submitter.join();
+
+		sentinel.reset();
+		first = Nz::TaskHandle();
+
+		WHEN("The pool is destroyed")
+		{
+			pool.reset();
+
+			THEN("The successor is discarded and released")
+			{
+				CHECK(sentinelRef.expired());
+			}
+		}
+	}
+
+	GIVEN("The default pool")
+	{
+		Nz::TaskPool* defaultPool = Nz::TaskScheduler::GetPool();
+
+		THEN("It is shared with the TaskScheduler")
+		{
+			REQUIRE(defaultPool);
+			CHECK(defaultPool->GetWorkerCount() == Nz::TaskScheduler::GetWorkerCount());
+		}
+	}
+}
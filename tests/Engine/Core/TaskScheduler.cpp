@@ -0,0 +1,180 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("An initialized task scheduler")
+	{
+		REQUIRE(Nz::TaskScheduler::Initialize());
+
+		WHEN("We add a batch of tasks and run them")
+		{
+			std::atomic<int> counter(0);
+
+			std::vector<Nz::TaskHandle> handles;
+			for (int i = 0; i < 1000; ++i)
+				handles.push_back(Nz::TaskScheduler::AddTask([&counter]() { counter++; }));
+
+			Nz::TaskHandle batch = Nz::TaskScheduler::Run();
+
+			THEN("Waiting on the batch handle waits for every task")
+			{
+				REQUIRE(batch.IsValid());
+				batch.Wait();
+
+				CHECK(batch.IsDone());
+				CHECK(counter == 1000);
+				for (const Nz::TaskHandle& handle : handles)
+					CHECK(handle.IsDone());
+			}
+
+			THEN("WaitForTasks waits for every task")
+			{
+				Nz::TaskScheduler::WaitForTasks();
+
+				CHECK(counter == 1000);
+			}
+		}
+
+		WHEN("We wait on a task which was not submitted yet")
+		{
+			int value = 0;
+			Nz::TaskHandle handle = Nz::TaskScheduler::AddTask([&value]() { value = 42; });
+
+			THEN("It gets submitted and executed")
+			{
+				handle.Wait();
+
+				CHECK(handle.IsDone());
+				CHECK(value == 42);
+			}
+		}
+
+		WHEN("Tasks spawn and wait for other tasks")
+		{
+			std::atomic<int> counter(0);
+
+			for (int i = 0; i < 16; ++i)
+			{
+				Nz::TaskScheduler::AddTask([&counter]()
+				{
+					for (int j = 0; j < 16; ++j)
+						Nz::TaskScheduler::AddTask([&counter]() { counter++; });
+
+					Nz::TaskScheduler::Run().Wait();
+				});
+			}
+
+			Nz::TaskScheduler::Run().Wait();
+
+			THEN("Every nested task was executed")
+			{
+				CHECK(counter == 16 * 16);
+			}
+		}
+
+		WHEN("We add tasks depending on other tasks")
+		{
+			std::atomic<int> stage(0);
+			std::atomic<int> firstStageCount(0);
+			std::atomic<bool> orderRespected(true);
+
+			std::vector<Nz::TaskHandle> firstStage;
+			for (int i = 0; i < 8; ++i)
+			{
+				firstStage.push_back(Nz::TaskScheduler::AddTask([&]()
+				{
+					if (stage != 0)
+						orderRespected = false;
+
+					firstStageCount++;
+				}));
+			}
+
+			Nz::TaskHandle secondStage = Nz::TaskScheduler::AddTaskAfter(firstStage.data(), firstStage.size(), [&]()
+			{
+				if (firstStageCount != 8)
+					orderRespected = false;
+
+				stage = 1;
+			});
+
+			Nz::TaskHandle thirdStage = Nz::TaskScheduler::AddTaskAfter({secondStage}, [&]()
+			{
+				if (stage != 1)
+					orderRespected = false;
+
+				stage = 2;
+			});
+
+			Nz::TaskScheduler::Run();
+
+			THEN("They are executed after their predecessors")
+			{
+				thirdStage.Wait();
+
+				CHECK(secondStage.IsDone());
+				CHECK(stage == 2);
+				CHECK(orderRespected);
+			}
+		}
+
+		WHEN("We add a task depending on a previous batch")
+		{
+			std::atomic<int> counter(0);
+			for (int i = 0; i < 100; ++i)
+				Nz::TaskScheduler::AddTask([&counter]() { counter++; });
+
+			Nz::TaskHandle batch = Nz::TaskScheduler::Run();
+
+			int observed = -1;
+			Nz::TaskHandle task = Nz::TaskScheduler::AddTaskAfter({batch, Nz::TaskHandle()}, [&]() { observed = counter; });
+
+			THEN("It is executed once the whole batch is done")
+			{
+				task.Wait();
+
+				CHECK(observed == 100);
+			}
+		}
+
+		WHEN("We use a default handle")
+		{
+			Nz::TaskHandle handle;
+
+			THEN("It is invalid and considered done")
+			{
+				CHECK_FALSE(handle.IsValid());
+				CHECK(handle.IsDone());
+				handle.Wait();
+			}
+		}
+	}
+
+	GIVEN("An uninitialized task scheduler")
+	{
+		Nz::TaskScheduler::Uninitialize();
+
+		WHEN("Several threads ask for the default pool at the same time")
+		{
+			std::vector<Nz::TaskPool*> pools(4, nullptr);
+			std::vector<std::thread> threads;
+			for (std::size_t i = 0; i < pools.size(); ++i)
+				threads.emplace_back([&pools, i]() { pools[i] = Nz::TaskScheduler::GetPool(); });
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			THEN("They all get the same pool")
+			{
+				REQUIRE(pools[0] != nullptr);
+				for (Nz::TaskPool* pool : pools)
+					CHECK(pool == pools[0]);
+			}
+		}
+	}
+}
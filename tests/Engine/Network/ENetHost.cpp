@@ -0,0 +1,242 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+SCENARIO("ENetLZ4Compressor", "[NETWORK][ENETLZ4COMPRESSOR]")
+{
+	GIVEN("A LZ4 compressor")
+	{
+		Nz::ENetLZ4Compressor compressor;
+
+		std::array<Nz::UInt8, 2048> output;
+		std::array<Nz::UInt8, 2048> decompressed;
+
+		WHEN("We compress redundant data split in several buffers")
+		{
+			std::vector<Nz::UInt8> first(600);
+			std::vector<Nz::UInt8> second(400);
+			for (std::size_t i = 0; i < first.size(); ++i)
+				first[i] = static_cast<Nz::UInt8>(i % 24);
+
+			for (std::size_t i = 0; i < second.size(); ++i)
+				second[i] = static_cast<Nz::UInt8>((i % 7 == 0) ? i : 42);
+
+			std::array<Nz::NetBuffer, 2> buffers = { { { first.data(), first.size() }, { second.data(), second.size() } } };
+			std::size_t inputSize = first.size() + second.size();
+
+			std::size_t compressedSize = compressor.Compress(nullptr, buffers.data(), buffers.size(), inputSize, output.data(), inputSize);
+
+			THEN("It should be smaller and decompress to the original data")
+			{
+				REQUIRE(compressedSize > 0);
+				CHECK(compressedSize < inputSize / 2);
+
+				std::size_t decompressedSize = compressor.Decompress(nullptr, output.data(), compressedSize, decompressed.data(), decompressed.size());
+				REQUIRE(decompressedSize == inputSize);
+				CHECK(std::equal(first.begin(), first.end(), decompressed.begin()));
+				CHECK(std::equal(second.begin(), second.end(), decompressed.begin() + first.size()));
+			}
+		}
+
+		WHEN("We compress random data")
+		{
+			std::mt19937 randomGenerator(42);
+			std::uniform_int_distribution<unsigned int> distribution(0, 255);
+
+			std::vector<Nz::UInt8> data(1000);
+			for (Nz::UInt8& byte : data)
+				byte = static_cast<Nz::UInt8>(distribution(randomGenerator));
+
+			Nz::NetBuffer buffer = { data.data(), data.size() };
+
+			THEN("It should fail if the output can't be smaller than the input")
+			{
+				CHECK(compressor.Compress(nullptr, &buffer, 1, data.size(), output.data(), data.size()) == 0);
+			}
+		}
+
+		WHEN("We decompress corrupted data")
+		{
+			std::vector<Nz::UInt8> data(500, 7);
+			Nz::NetBuffer buffer = { data.data(), data.size() };
+
+			std::size_t compressedSize = compressor.Compress(nullptr, &buffer, 1, data.size(), output.data(), data.size());
+			REQUIRE(compressedSize > 0);
+
+			THEN("It should fail instead of reading or writing out of bounds")
+			{
+				// Truncated input
+				CHECK(compressor.Decompress(nullptr, output.data(), compressedSize - 2, decompressed.data(), decompressed.size()) == 0);
+
+				// Output too small
+				CHECK(compressor.Decompress(nullptr, output.data(), compressedSize, decompressed.data(), data.size() - 1) == 0);
+
+				// Offset pointing before the start of the output
+				output[2] = 0xFF;
+				output[3] = 0xFF;
+				CHECK(compressor.Decompress(nullptr, output.data(), compressedSize, decompressed.data(), decompressed.size()) == 0);
+			}
+		}
+	}
+}
+
+SCENARIO("ENetHost compression", "[NETWORK][ENETHOST]")
+{
+	GIVEN("Two connected hosts using compression")
+	{
+		Nz::UInt16 port = 64268;
+
+		Nz::ENetHost serverHost;
+		REQUIRE(serverHost.Create(Nz::NetProtocol_IPv4, port, 1));
+		serverHost.SetCompressor(std::make_unique<Nz::ENetLZ4Compressor>());
+
+		Nz::ENetHost clientHost;
+		REQUIRE(clientHost.Create(Nz::IpAddress::AnyIpV4, 1));
+		clientHost.SetCompressor(std::make_unique<Nz::ENetLZ4Compressor>());
+
+		Nz::ENetPeer* clientPeer = clientHost.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 1);
+		Nz::ENetPeer* serverPeer = nullptr;
+
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 100 && (!serverPeer || !clientPeer->IsConnected()); ++i)
+		{
+			if (serverHost.Service(&event, 1) > 0 && event.type == Nz::ENetEventType::IncomingConnect)
+				serverPeer = event.peer;
+
+			clientHost.Service(&event, 1);
+		}
+
+		REQUIRE(serverPeer);
+		REQUIRE(clientPeer->IsConnected());
+
+		WHEN("The server sends a compressible packet")
+		{
+			std::vector<Nz::UInt8> payload(1000);
+			for (std::size_t i = 0; i < payload.size(); ++i)
+				payload[i] = static_cast<Nz::UInt8>(i % 16);
+
+			serverPeer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, payload.data(), payload.size()));
+			serverHost.Flush();
+
+			Nz::ENetPacketRef receivedPacket;
+			for (unsigned int i = 0; i < 100 && !receivedPacket; ++i)
+			{
+				while (clientHost.Service(&event, 1) > 0)
+				{
+					if (event.type == Nz::ENetEventType::Receive)
+						receivedPacket = event.packet;
+				}
+
+				serverHost.Service(&event, 0);
+			}
+
+			THEN("The client should receive it intact, with fewer bytes on the wire")
+			{
+				REQUIRE(receivedPacket);
+				REQUIRE(receivedPacket->data.GetDataSize() == payload.size());
+				CHECK(std::memcmp(receivedPacket->data.GetConstData() + Nz::NetPacket::HeaderSize, payload.data(), payload.size()) == 0);
+
+				const Nz::ENetPeer::CompressionStats& serverStats = serverPeer->GetCompressionStats();
+				CHECK(serverStats.compressedDataSent < serverStats.uncompressedDataSent);
+				CHECK(serverStats.uncompressedDataSent > payload.size());
+
+				const Nz::ENetPeer::CompressionStats& clientStats = clientPeer->GetCompressionStats();
+				CHECK(clientStats.compressedDataReceived > 0);
+				CHECK(clientStats.compressedDataReceived < clientStats.uncompressedDataReceived);
+			}
+		}
+	}
+}
+
+SCENARIO("ENetHost checksum", "[NETWORK][ENETHOST]")
+{
+	GIVEN("Two connected hosts using checksums")
+	{
+		Nz::UInt16 port = 64269;
+
+		Nz::ENetHost serverHost;
+		REQUIRE(serverHost.Create(Nz::NetProtocol_IPv4, port, 1));
+		serverHost.EnableChecksum();
+
+		Nz::ENetHost clientHost;
+		REQUIRE(clientHost.Create(Nz::IpAddress::AnyIpV4, 1));
+		clientHost.EnableChecksum();
+
+		CHECK(serverHost.IsChecksumEnabled());
+
+		Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port);
+		Nz::ENetPeer* clientPeer = clientHost.Connect(serverAddress, 1);
+		Nz::ENetPeer* serverPeer = nullptr;
+
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 100 && (!serverPeer || !clientPeer->IsConnected()); ++i)
+		{
+			if (serverHost.Service(&event, 1) > 0 && event.type == Nz::ENetEventType::IncomingConnect)
+				serverPeer = event.peer;
+
+			clientHost.Service(&event, 1);
+		}
+
+		REQUIRE(serverPeer);
+		REQUIRE(clientPeer->IsConnected());
+
+		WHEN("The client sends a packet")
+		{
+			std::vector<Nz::UInt8> payload(3000);
+			for (std::size_t i = 0; i < payload.size(); ++i)
+				payload[i] = static_cast<Nz::UInt8>(i * 13);
+
+			clientPeer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, payload.data(), payload.size()));
+			clientHost.Flush();
+
+			Nz::ENetPacketRef receivedPacket;
+			for (unsigned int i = 0; i < 100 && !receivedPacket; ++i)
+			{
+				while (serverHost.Service(&event, 1) > 0)
+				{
+					if (event.type == Nz::ENetEventType::Receive)
+						receivedPacket = event.packet;
+				}
+
+				clientHost.Service(&event, 0);
+			}
+
+			THEN("The server should receive it intact")
+			{
+				REQUIRE(receivedPacket);
+				REQUIRE(receivedPacket->data.GetDataSize() == payload.size());
+				CHECK(std::memcmp(receivedPacket->data.GetConstData() + Nz::NetPacket::HeaderSize, payload.data(), payload.size()) == 0);
+			}
+		}
+
+		WHEN("A host without checksums tries to connect")
+		{
+			Nz::ENetHost otherHost;
+			REQUIRE(otherHost.Create(Nz::IpAddress::AnyIpV4, 1));
+
+			Nz::ENetPeer* otherPeer = otherHost.Connect(serverAddress, 1);
+
+			bool incomingConnection = false;
+			for (unsigned int i = 0; i < 20; ++i)
+			{
+				if (serverHost.Service(&event, 1) > 0 && event.type == Nz::ENetEventType::IncomingConnect)
+					incomingConnection = true;
+
+				otherHost.Service(&event, 1);
+			}
+
+			THEN("Its datagrams should be dropped")
+			{
+				CHECK_FALSE(incomingConnection);
+				CHECK_FALSE(otherPeer->IsConnected());
+			}
+		}
+	}
+}
@@ -0,0 +1,234 @@
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+SCENARIO("ENetShardedHost", "[NETWORK][ENETSHARDEDHOST]")
+{
+	GIVEN("A sharded host and several clients")
+	{
+		constexpr std::size_t clientCount = 4;
+
+		Nz::ENetShardedHost serverHost;
+		REQUIRE(serverHost.Create(Nz::NetProtocol_IPv4, 0, clientCount, 1, 2));
+
+		#ifdef NAZARA_PLATFORM_LINUX
+		CHECK(serverHost.GetShardCount() == 2);
+		#endif
+
+		Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), serverHost.GetBoundAddress().GetPort());
+		REQUIRE(serverAddress.GetPort() != 0);
+
+		// Every client has its own socket, so they may be spread on different shards
+		std::array<Nz::ENetHost, clientCount> clientHosts;
+		std::array<Nz::ENetPeer*, clientCount> clientPeers;
+		for (std::size_t i = 0; i < clientCount; ++i)
+		{
+			REQUIRE(clientHosts[i].Create(Nz::IpAddress::AnyIpV4, 1));
+			clientPeers[i] = clientHosts[i].Connect(serverAddress, 1);
+		}
+
+		// Clients are serviced by the test, the server by its own threads
+		auto ServiceClients = [&](std::array<std::vector<Nz::ENetEvent>, clientCount>* events)
+		{
+			for (std::size_t i = 0; i < clientCount; ++i)
+			{
+				Nz::ENetEvent event;
+				while (clientHosts[i].Service(&event, 1) > 0)
+				{
+					if (events)
+						(*events)[i].push_back(std::move(event));
+				}
+			}
+		};
+
+		std::vector<Nz::ENetPeer*> serverPeers;
+
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 200 && serverPeers.size() < clientCount; ++i)
+		{
+			ServiceClients(nullptr);
+
+			while (serverHost.CheckEvents(&event))
+			{
+				if (event.type == Nz::ENetEventType::IncomingConnect)
+					serverPeers.push_back(event.peer);
+			}
+		}
+
+		for (unsigned int i = 0; i < 20 && !std::all_of(clientPeers.begin(), clientPeers.end(), [](Nz::ENetPeer* peer) { return peer->IsConnected(); }); ++i)
+			ServiceClients(nullptr);
+
+		REQUIRE(serverPeers.size() == clientCount);
+		for (Nz::ENetPeer* clientPeer : clientPeers)
+			REQUIRE(clientPeer->IsConnected());
+
+		WHEN("Every client sends a packet which the server echoes back")
+		{
+			for (std::size_t i = 0; i < clientCount; ++i)
+			{
+				Nz::NetPacket packet(1);
+				packet << static_cast<Nz::UInt32>(i);
+
+				clientPeers[i]->Send(0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+			}
+
+			std::array<std::vector<Nz::ENetEvent>, clientCount> clientEvents;
+			std::size_t echoedPackets = 0;
+			for (unsigned int i = 0; i < 200 && echoedPackets < clientCount; ++i)
+			{
+				ServiceClients(&clientEvents);
+
+				while (serverHost.CheckEvents(&event))
+				{
+					if (event.type == Nz::ENetEventType::Receive)
+					{
+						Nz::NetPacket echo(2, event.packet->data.GetConstData() + Nz::NetPacket::HeaderSize, event.packet->data.GetDataSize());
+						CHECK(serverHost.Send(event.peer, 0, Nz::ENetPacketFlag_Reliable, std::move(echo)));
+						echoedPackets++;
+					}
+				}
+			}
+
+			for (unsigned int i = 0; i < 100 && std::any_of(clientEvents.begin(), clientEvents.end(), [](const std::vector<Nz::ENetEvent>& events) { return events.empty(); }); ++i)
+				ServiceClients(&clientEvents);
+
+			THEN("Every client gets its own packet")
+			{
+				CHECK(echoedPackets == clientCount);
+
+				for (std::size_t i = 0; i < clientCount; ++i)
+				{
+					REQUIRE(clientEvents[i].size() == 1);
+					REQUIRE(clientEvents[i][0].type == Nz::ENetEventType::Receive);
+
+					Nz::NetPacket& packet = clientEvents[i][0].packet->data;
+					Nz::UInt32 value = 0;
+					packet >> value;
+
+					CHECK(value == i);
+				}
+			}
+		}
+
+		WHEN("The server broadcasts a packet")
+		{
+			std::size_t acceptedCount = serverHost.Broadcast(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(3, "Hello", 5));
+
+			std::array<std::vector<Nz::ENetEvent>, clientCount> clientEvents;
+			for (unsigned int i = 0; i < 200 && std::any_of(clientEvents.begin(), clientEvents.end(), [](const std::vector<Nz::ENetEvent>& events) { return events.empty(); }); ++i)
+				ServiceClients(&clientEvents);
+
+			THEN("Every client receives it")
+			{
+				CHECK(acceptedCount == serverHost.GetShardCount());
+
+				for (const std::vector<Nz::ENetEvent>& events : clientEvents)
+				{
+					REQUIRE(events.size() == 1);
+					REQUIRE(events[0].type == Nz::ENetEventType::Receive);
+					CHECK(events[0].packet->data.GetDataSize() == 5);
+				}
+			}
+		}
+
+		WHEN("The server disconnects a client")
+		{
+			Nz::ENetPeer* serverPeer = serverPeers.front();
+			REQUIRE(serverHost.Disconnect(serverPeer, 42));
+
+			bool serverDisconnected = false;
+			for (unsigned int i = 0; i < 200 && !serverDisconnected; ++i)
+			{
+				ServiceClients(nullptr);
+
+				while (serverHost.CheckEvents(&event))
+				{
+					if (event.type == Nz::ENetEventType::Disconnect && event.peer == serverPeer)
+						serverDisconnected = true;
+				}
+			}
+
+			THEN("Both sides see the disconnection")
+			{
+				CHECK(serverDisconnected);
+				CHECK(std::count_if(clientPeers.begin(), clientPeers.end(), [](Nz::ENetPeer* peer) { return peer->IsConnected(); }) == clientCount - 1);
+			}
+		}
+
+		WHEN("A disconnected client reconnects before the server handled its disconnection")
+		{
+			Nz::ENetPeer* serverPeer = serverPeers.front();
+			REQUIRE(serverHost.Disconnect(serverPeer, 42));
+
+			// Server events are left pending, the user thread still considers the peer connected
+			std::size_t clientIndex = clientCount;
+			for (unsigned int i = 0; i < 200 && clientIndex == clientCount; ++i)
+			{
+				ServiceClients(nullptr);
+
+				for (std::size_t j = 0; j < clientCount; ++j)
+				{
+					if (!clientPeers[j]->IsConnected())
+						clientIndex = j;
+				}
+			}
+
+			REQUIRE(clientIndex < clientCount);
+
+			// Its socket is the same, so it reaches the same shard which gives it the slot it just freed
+			clientPeers[clientIndex] = clientHosts[clientIndex].Connect(serverAddress, 1);
+			for (unsigned int i = 0; i < 200 && !clientPeers[clientIndex]->IsConnected(); ++i)
+				ServiceClients(nullptr);
+
+			REQUIRE(clientPeers[clientIndex]->IsConnected());
+
+			// Meant to the previous peer
+			Nz::NetPacket stalePacket(1);
+			stalePacket << Nz::UInt32(1);
+
+			CHECK(serverHost.Send(serverPeer, 0, Nz::ENetPacketFlag_Reliable, std::move(stalePacket)));
+
+			bool serverDisconnected = false;
+			Nz::ENetPeer* reconnectedPeer = nullptr;
+			std::array<std::vector<Nz::ENetEvent>, clientCount> clientEvents;
+			for (unsigned int i = 0; i < 50; ++i)
+			{
+				ServiceClients(&clientEvents);
+
+				while (serverHost.CheckEvents(&event))
+				{
+					if (event.type == Nz::ENetEventType::Disconnect && event.peer == serverPeer)
+						serverDisconnected = true;
+					else if (event.type == Nz::ENetEventType::IncomingConnect)
+						reconnectedPeer = event.peer;
+				}
+			}
+
+			THEN("The new peer doesn't get the packet sent to the previous one, but the next ones")
+			{
+				CHECK(serverDisconnected);
+				REQUIRE(reconnectedPeer == serverPeer);
+				CHECK(clientEvents[clientIndex].empty());
+
+				Nz::NetPacket packet(1);
+				packet << Nz::UInt32(2);
+
+				CHECK(serverHost.Send(reconnectedPeer, 0, Nz::ENetPacketFlag_Reliable, std::move(packet)));
+				for (unsigned int i = 0; i < 200 && clientEvents[clientIndex].empty(); ++i)
+					ServiceClients(&clientEvents);
+
+				REQUIRE(clientEvents[clientIndex].size() == 1);
+				REQUIRE(clientEvents[clientIndex][0].type == Nz::ENetEventType::Receive);
+
+				Nz::UInt32 value = 0;
+				clientEvents[clientIndex][0].packet->data >> value;
+
+				CHECK(value == 2);
+			}
+		}
+	}
+}
@@ -2,6 +2,8 @@
 #include <Nazara/Network/UdpSocket.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Catch/catch.hpp>
+#include <array>
+#include <cstring>
 #include <random>
 
 SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
@@ -42,5 +44,58 @@ SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 				REQUIRE(result == vector123);
 			}
 		}
+
+		WHEN("We send a batch of datagrams from client")
+		{
+			std::array<Nz::UInt32, 3> headers = { {1, 2, 3} };
+			std::array<char, 6> payload = { {'N', 'a', 'z', 'a', 'r', 'a'} };
+
+			std::array<Nz::NetBuffer, 6> sendBuffers;
+			std::array<Nz::NetDatagram, 3> sendDatagrams;
+			for (std::size_t i = 0; i < sendDatagrams.size(); ++i)
+			{
+				// Each datagram is gathered from a header and a part of the payload
+				sendBuffers[i * 2] = { &headers[i], sizeof(Nz::UInt32) };
+				sendBuffers[i * 2 + 1] = { &payload[i * 2], 2 };
+
+				sendDatagrams[i].address = serverIP;
+				sendDatagrams[i].buffers = &sendBuffers[i * 2];
+				sendDatagrams[i].bufferCount = 2;
+			}
+
+			std::size_t sent;
+			REQUIRE(client.SendDatagrams(sendDatagrams.data(), sendDatagrams.size(), &sent));
+			CHECK(sent == sendDatagrams.size());
+
+			THEN("We should get all of them on the server, in a single call")
+			{
+				std::array<std::array<Nz::UInt8, 64>, 4> receiveData;
+				std::array<Nz::NetBuffer, 4> receiveBuffers;
+				std::array<Nz::NetDatagram, 4> receiveDatagrams;
+				for (std::size_t i = 0; i < receiveDatagrams.size(); ++i)
+				{
+					receiveBuffers[i] = { receiveData[i].data(), receiveData[i].size() };
+
+					receiveDatagrams[i].buffers = &receiveBuffers[i];
+					receiveDatagrams[i].bufferCount = 1;
+				}
+
+				std::size_t received;
+				REQUIRE(server.ReceiveDatagrams(receiveDatagrams.data(), receiveDatagrams.size(), &received));
+				REQUIRE(received == sendDatagrams.size());
+
+				for (std::size_t i = 0; i < received; ++i)
+				{
+					CHECK(receiveDatagrams[i].address.GetPort() == clientIP.GetPort());
+					REQUIRE(receiveDatagrams[i].dataLength == sizeof(Nz::UInt32) + 2);
+
+					Nz::UInt32 header;
+					std::memcpy(&header, receiveData[i].data(), sizeof(Nz::UInt32));
+					CHECK(header == headers[i]);
+					CHECK(receiveData[i][sizeof(Nz::UInt32)] == payload[i * 2]);
+					CHECK(receiveData[i][sizeof(Nz::UInt32) + 1] == payload[i * 2 + 1]);
+				}
+			}
+		}
 	}
 }
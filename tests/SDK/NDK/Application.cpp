@@ -1,4 +1,8 @@
 #include <NDK/Application.hpp>
+#include <NDK/Algorithm.hpp>
+#include <NDK/System.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Thread.hpp>
 #include <Catch/catch.hpp>
 
 SCENARIO("Application", "[NDK][APPLICATION]")
@@ -22,4 +26,128 @@ SCENARIO("Application", "[NDK][APPLICATION]")
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+
+namespace
+{
+	class TickSystem : public Ndk::System<TickSystem>
+	{
+		public:
+			TickSystem()
+			{
+				SetUpdateRate(0.f);
+			}
+
+			unsigned int updateCount = 0;
+			float lastElapsedTime = 0.f;
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float elapsedTime) override
+			{
+				lastElapsedTime = elapsedTime;
+				updateCount++;
+			}
+	};
+
+	Ndk::SystemIndex TickSystem::systemIndex;
+
+	class FrameSystem : public Ndk::System<FrameSystem>
+	{
+		public:
+			FrameSystem()
+			{
+				EnableFixedUpdate(false);
+				SetUpdateRate(0.f);
+			}
+
+			unsigned int updateCount = 0;
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+				updateCount++;
+			}
+	};
+
+	Ndk::SystemIndex FrameSystem::systemIndex;
+}
+
+SCENARIO("Application fixed update", "[NDK][APPLICATION]")
+{
+	GIVEN("An application running a world at a fixed rate")
+	{
+		Ndk::InitializeSystem<TickSystem>();
+		Ndk::InitializeSystem<FrameSystem>();
+
+		Ndk::Application& application = *Ndk::Application::Instance();
+		#ifndef NDK_SERVER
+		application.MakeExitOnLastWindowClosed(false);
+		#endif
+
+		Ndk::World& world = application.AddWorld(false);
+		TickSystem& tickSystem = world.AddSystem<TickSystem>();
+		FrameSystem& frameSystem = world.AddSystem<FrameSystem>();
+
+		application.SetFixedUpdateRate(100.f);
+		application.EnableFixedUpdateWait(true);
+		REQUIRE(application.GetFixedUpdateRate() == Approx(100.f));
+		REQUIRE(application.IsFixedUpdateWaitEnabled());
+
+		WHEN("We run the application while waiting for each tick")
+		{
+			REQUIRE(application.Run()); //< Catch up the time elapsed before
+
+			unsigned int tickCount = tickSystem.updateCount;
+			unsigned int frameCount = frameSystem.updateCount;
+
+			Nz::Clock clock;
+			for (unsigned int i = 0; i < 10; ++i)
+				REQUIRE(application.Run());
+
+			float elapsedTime = clock.GetSeconds();
+
+			THEN("The world should be simulated at the fixed rate and presented every frame")
+			{
+				CHECK(tickSystem.updateCount - tickCount >= 10);
+				CHECK(tickSystem.updateCount - tickCount <= static_cast<unsigned int>(elapsedTime * 100.f) + 1);
+				CHECK(tickSystem.lastElapsedTime == Approx(0.01f));
+				CHECK(frameSystem.updateCount - frameCount == 10);
+				CHECK(elapsedTime >= 0.09f);
+
+				CHECK(application.GetInterpolationFactor() >= 0.f);
+				CHECK(application.GetInterpolationFactor() < 1.f);
+				CHECK(world.GetInterpolationFactor() == application.GetInterpolationFactor());
+			}
+		}
+
+		WHEN("The application falls behind")
+		{
+			application.SetMaxFixedUpdates(3);
+			application.Run();
+
+			unsigned int tickCount = tickSystem.updateCount;
+			Nz::Thread::Sleep(100);
+			application.Run();
+
+			THEN("It should not run more ticks than allowed to catch up")
+			{
+				CHECK(tickSystem.updateCount - tickCount == 3);
+				CHECK(application.GetMaxFixedUpdates() == 3);
+			}
+
+			application.SetMaxFixedUpdates(5);
+		}
+
+		application.EnableFixedUpdateWait(false);
+		application.SetFixedUpdateRate(0.f);
+		world.RemoveAllSystems();
+
+		#ifndef NDK_SERVER
+		application.MakeExitOnLastWindowClosed(true);
+		#endif
+	}
+}
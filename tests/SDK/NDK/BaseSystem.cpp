@@ -2,7 +2,9 @@
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
 #include <NDK/World.hpp>
+#include <NDK/Systems/VelocitySystem.hpp>
 #include <Catch/catch.hpp>
+#include <cstring>
 
 namespace
 {
@@ -36,6 +38,17 @@ SCENARIO("BaseSystem", "[NDK][BASESYSTEM]")
 		Ndk::BaseSystem& system = world.AddSystem<TestSystem>();
 		REQUIRE(&system.GetWorld() == &world);
 
+		WHEN("We get the name of the systems")
+		{
+			Ndk::VelocitySystem velocitySystem;
+
+			THEN("Our system has the default name while the ones of the SDK are named")
+			{
+				CHECK(std::strcmp(system.GetName(), "System") == 0);
+				CHECK(std::strcmp(velocitySystem.GetName(), "VelocitySystem") == 0);
+			}
+		}
+
 		WHEN("We add an entity")
 		{
 			Ndk::EntityHandle entity = world.CreateEntity();
@@ -0,0 +1,122 @@
+#include <NDK/ComponentStorage.hpp>
+#include <NDK/Component.hpp>
+#include <NDK/World.hpp>
+#include <Catch/catch.hpp>
+
+namespace
+{
+	class PositionComponent : public Ndk::Component<PositionComponent>
+	{
+		public:
+			PositionComponent(int x) :
+			value(x)
+			{
+			}
+
+			int value;
+
+			static Ndk::ComponentIndex componentIndex;
+	};
+
+	Ndk::ComponentIndex PositionComponent::componentIndex;
+}
+
+SCENARIO("ComponentStorage", "[NDK][COMPONENTSTORAGE]")
+{
+	GIVEN("A world storing position components in chunks of four")
+	{
+		Ndk::World world(false);
+		Ndk::ComponentStorage<PositionComponent>& storage = world.EnableComponentStorage<PositionComponent>(4);
+
+		REQUIRE(world.GetComponentStorage<PositionComponent>() == &storage);
+		REQUIRE(storage.GetComponentsPerChunk() == 4);
+
+		Ndk::World::EntityVector entities = world.CreateEntities(10);
+
+		std::vector<PositionComponent*> components;
+		for (std::size_t i = 0; i < entities.size(); ++i)
+			components.push_back(&entities[i]->AddComponent<PositionComponent>(int(i)));
+
+		WHEN("We look at the storage")
+		{
+			THEN("Components should be packed in chunks")
+			{
+				CHECK(storage.GetComponentCount() == 10);
+				CHECK(storage.GetChunkCount() == 3);
+
+				for (std::size_t i = 1; i < 4; ++i)
+					CHECK(components[i] == components[0] + i);
+			}
+
+			THEN("We can iterate over every component with its owner")
+			{
+				int sum = 0;
+				std::size_t count = 0;
+				storage.ForEach([&](Ndk::EntityId owner, PositionComponent& component)
+				{
+					CHECK(world.GetEntity(owner)->GetComponent<PositionComponent>().value == component.value);
+
+					sum += component.value;
+					count++;
+				});
+
+				CHECK(count == 10);
+				CHECK(sum == 45);
+			}
+		}
+
+		WHEN("We kill an entity and create a new one")
+		{
+			PositionComponent* killedComponent = components[5];
+			entities[5]->Kill();
+			world.Update();
+
+			CHECK(storage.GetComponentCount() == 9);
+
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			PositionComponent& component = entity->AddComponent<PositionComponent>(42);
+
+			THEN("The freed slot should be reused")
+			{
+				CHECK(&component == killedComponent);
+				CHECK(storage.GetComponentCount() == 10);
+				CHECK(storage.GetChunkCount() == 3);
+			}
+		}
+
+		WHEN("We clone an entity")
+		{
+			const Ndk::EntityHandle& clone = world.CloneEntity(entities[3]->GetId());
+
+			THEN("The cloned component should be stored too")
+			{
+				CHECK(storage.GetComponentCount() == 11);
+				CHECK(clone->GetComponent<PositionComponent>().value == 3);
+			}
+		}
+
+		WHEN("We remove a component")
+		{
+			entities[0]->RemoveComponent<PositionComponent>();
+			world.Update();
+
+			THEN("It should leave the storage")
+			{
+				CHECK(!entities[0]->HasComponent<PositionComponent>());
+				CHECK(storage.GetComponentCount() == 9);
+			}
+		}
+
+		WHEN("We add a heap-allocated component")
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			entity->AddComponent(std::unique_ptr<Ndk::BaseComponent>(new PositionComponent(7)));
+
+			THEN("It should not be part of the storage")
+			{
+				CHECK(storage.GetComponentCount() == 10);
+				CHECK(entity->GetComponent<PositionComponent>().value == 7);
+			}
+		}
+	}
+}
@@ -38,4 +38,56 @@ SCENARIO("EntityList", "[NDK][ENTITYLIST]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("A world & a list holding every third entity")
+	{
+		Ndk::World world;
+		Ndk::World::EntityVector entities = world.CreateEntities(200);
+
+		Ndk::EntityList entityList;
+		for (std::size_t i = 0; i < entities.size(); i += 3)
+			entityList.Insert(entities[i]);
+
+		WHEN("We iterate over the whole list")
+		{
+			std::vector<Ndk::EntityId> ids;
+			entityList.ForEach([&](const Ndk::EntityHandle& entity) { ids.push_back(entity->GetId()); });
+
+			THEN("Every entity should be visited once, in order")
+			{
+				REQUIRE(ids.size() == 67);
+				for (std::size_t i = 0; i < ids.size(); ++i)
+					CHECK(ids[i] == entities[i * 3]->GetId());
+
+				CHECK(entityList.GetIdBound() > entities[198]->GetId());
+			}
+		}
+
+		WHEN("We iterate over ranges which do not match the bitset blocks")
+		{
+			std::vector<Ndk::EntityId> ids;
+			for (Ndk::EntityId first = 0; first < entityList.GetIdBound(); first += 50)
+				entityList.ForEach(first, first + 50, [&](const Ndk::EntityHandle& entity) { ids.push_back(entity->GetId()); });
+
+			THEN("Ranges should cover the list without overlapping")
+			{
+				REQUIRE(ids.size() == 67);
+				for (std::size_t i = 0; i < ids.size(); ++i)
+					CHECK(ids[i] == entities[i * 3]->GetId());
+			}
+		}
+
+		WHEN("We iterate over a range inside a single block")
+		{
+			std::vector<Ndk::EntityId> ids;
+			entityList.ForEach(entities[70]->GetId(), entities[76]->GetId(), [&](const Ndk::EntityHandle& entity) { ids.push_back(entity->GetId()); });
+
+			THEN("Only entities of this range should be visited")
+			{
+				REQUIRE(ids.size() == 2);
+				CHECK(ids[0] == entities[72]->GetId());
+				CHECK(ids[1] == entities[75]->GetId());
+			}
+		}
+	}
+}
@@ -0,0 +1,80 @@
+#include <NDK/EntityPrefab.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/Systems/VelocitySystem.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("EntityPrefab", "[NDK][ENTITYPREFAB]")
+{
+	GIVEN("A world and a prefab of moving entities")
+	{
+		Ndk::World world;
+
+		Ndk::EntityPrefab prefab;
+		prefab.AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f::UnitY());
+		prefab.AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitX());
+
+		REQUIRE(prefab.HasComponent<Ndk::NodeComponent>());
+		REQUIRE(prefab.HasComponent<Ndk::VelocityComponent>());
+
+		WHEN("We instantiate many entities from it")
+		{
+			Ndk::World::EntityVector entities = world.CreateEntities(prefab, 100);
+			world.Update();
+
+			THEN("Each entity should have a copy of the prefab components")
+			{
+				REQUIRE(entities.size() == 100);
+				for (const Ndk::EntityHandle& entity : entities)
+				{
+					CHECK(entity->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f::UnitY());
+					CHECK(entity->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitX());
+				}
+
+				entities[0]->GetComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::Zero();
+				CHECK(prefab.GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitX());
+			}
+
+			THEN("Every entity should be part of the matching systems")
+			{
+				CHECK(world.GetSystem<Ndk::VelocitySystem>().GetEntities().size() == 100);
+			}
+		}
+
+		WHEN("We instantiate entities with a component removed from the prefab, along with complete ones")
+		{
+			Ndk::World::EntityVector entities = world.CreateEntities(prefab, 10);
+
+			prefab.RemoveComponent<Ndk::VelocityComponent>();
+			Ndk::EntityHandle entity = world.CreateEntity(prefab);
+			Ndk::World::EntityVector others = world.CreateEntities(Ndk::EntityPrefab(*entities[0]), 10);
+
+			world.Update();
+
+			THEN("Systems should only get the entities they filter")
+			{
+				CHECK(!entity->HasComponent<Ndk::VelocityComponent>());
+				CHECK(others[0]->HasComponent<Ndk::VelocityComponent>());
+
+				const Ndk::EntityList& systemEntities = world.GetSystem<Ndk::VelocitySystem>().GetEntities();
+				CHECK(systemEntities.size() == 20);
+				CHECK(!systemEntities.Has(entity->GetId()));
+			}
+		}
+
+		WHEN("The world stores velocity components")
+		{
+			world.EnableComponentStorage<Ndk::VelocityComponent>();
+
+			Ndk::World::EntityVector entities = world.CreateEntities(prefab, 10);
+
+			THEN("Components of the instances should be next to each other")
+			{
+				Ndk::VelocityComponent* first = &entities[0]->GetComponent<Ndk::VelocityComponent>();
+				for (std::size_t i = 1; i < entities.size(); ++i)
+					CHECK(&entities[i]->GetComponent<Ndk::VelocityComponent>() == first + i);
+			}
+		}
+	}
+}
@@ -0,0 +1,118 @@
+#include <NDK/EntityRef.hpp>
+#include <NDK/ComponentRef.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("EntityRef", "[NDK][ENTITYREF]")
+{
+	GIVEN("A world and a reference to one of its entities")
+	{
+		Ndk::World world(false);
+		Ndk::EntityHandle entity = world.CreateEntity();
+		Ndk::VelocityComponent& velocity = entity->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitX());
+
+		Ndk::EntityRef ref(entity);
+		Ndk::ComponentRef<Ndk::VelocityComponent> velocityRef(velocity);
+
+		WHEN("The entity is alive")
+		{
+			THEN("References should resolve to it")
+			{
+				CHECK(ref.IsValid());
+				CHECK(ref.GetEntity() == entity.GetObject());
+				CHECK(ref->GetId() == entity->GetId());
+				CHECK(ref == Ndk::EntityRef(entity));
+
+				CHECK(velocityRef.GetComponent() == &velocity);
+				CHECK(velocityRef->linearVelocity == Nz::Vector3f::UnitX());
+			}
+		}
+
+		WHEN("We remove the component")
+		{
+			entity->RemoveComponent<Ndk::VelocityComponent>();
+			world.Update();
+
+			THEN("Only the component reference should be invalid")
+			{
+				CHECK(ref.IsValid());
+				CHECK(!velocityRef.IsValid());
+			}
+		}
+
+		WHEN("We remove the component and add another one of the same type")
+		{
+			entity->RemoveComponent<Ndk::VelocityComponent>();
+			world.Update();
+
+			Ndk::VelocityComponent& newVelocity = entity->AddComponent<Ndk::VelocityComponent>();
+
+			THEN("The component reference should not resolve to the new component")
+			{
+				CHECK(!velocityRef.IsValid());
+				CHECK(Ndk::ComponentRef<Ndk::VelocityComponent>(newVelocity).GetComponent() == &newVelocity);
+				CHECK(Ndk::ComponentRef<Ndk::VelocityComponent>(newVelocity) != velocityRef);
+			}
+		}
+
+		WHEN("We replace the component")
+		{
+			entity->AddComponent<Ndk::VelocityComponent>();
+
+			THEN("The component reference should be invalid")
+			{
+				CHECK(!velocityRef.IsValid());
+			}
+		}
+
+		WHEN("We kill the entity and create a new one reusing its identifier")
+		{
+			Ndk::EntityId id = entity->GetId();
+
+			entity->Kill();
+			world.Update();
+
+			CHECK(!ref);
+			CHECK(!velocityRef);
+
+			const Ndk::EntityHandle& newEntity = world.CreateEntity();
+			newEntity->AddComponent<Ndk::VelocityComponent>();
+
+			THEN("The reference should not resolve to the new entity")
+			{
+				REQUIRE(newEntity->GetId() == id);
+				CHECK(world.GetEntityGeneration(id) == ref.GetGeneration() + 1);
+
+				CHECK(!ref.IsValid());
+				CHECK(!velocityRef.IsValid());
+				CHECK(Ndk::EntityRef(newEntity).IsValid());
+			}
+		}
+
+		WHEN("We clear the world")
+		{
+			world.Clear();
+			const Ndk::EntityHandle& newEntity = world.CreateEntity();
+
+			THEN("The reference should not resolve to the new entity")
+			{
+				CHECK(newEntity->GetId() == ref.GetId());
+				CHECK(!ref.IsValid());
+			}
+		}
+
+		WHEN("We make a reference to nothing")
+		{
+			Ndk::EntityRef nullRef;
+			ref.Reset();
+
+			THEN("It should be invalid")
+			{
+				CHECK(!nullRef.IsValid());
+				CHECK(nullRef == ref);
+				CHECK(nullRef.GetWorld() == nullptr);
+			}
+		}
+	}
+}
@@ -2,9 +2,15 @@
 #include <NDK/World.hpp>
 #include <NDK/Components/ListenerComponent.hpp>
 #include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/ParticleEmitterComponent.hpp>
+#include <NDK/Components/ParticleGroupComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/Systems/ParticleSystem.hpp>
 #include <Nazara/Audio/Audio.hpp>
+#include <Nazara/Core/Clock.hpp>
 #include <Catch/catch.hpp>
+#include <atomic>
+#include <thread>
 
 SCENARIO("ListenerSystem", "[NDK][LISTENERSYSTEM]")
 {
@@ -40,4 +46,60 @@ SCENARIO("ListenerSystem", "[NDK][LISTENERSYSTEM]")
 			}
 		}
 	}
+}
+
+SCENARIO("ListenerSystem and ParticleSystem", "[NDK][LISTENERSYSTEM]")
+{
+	GIVEN("A world updating its systems in parallel, with a listener and particles")
+	{
+		Ndk::World world(false);
+		Ndk::ListenerSystem& listenerSystem = world.AddSystem<Ndk::ListenerSystem>();
+		Ndk::ParticleSystem& particleSystem = world.AddSystem<Ndk::ParticleSystem>();
+		world.EnableParallelUpdate();
+
+		Nz::Audio::SetListenerPosition(Nz::Vector3f::Zero());
+
+		Nz::Vector3f listenerPosition = Nz::Vector3f::Unit() * 5.f;
+		Ndk::EntityHandle listener = world.CreateEntity();
+		listener->AddComponent<Ndk::ListenerComponent>();
+		listener->AddComponent<Ndk::NodeComponent>().SetPosition(listenerPosition);
+
+		Ndk::EntityHandle particles = world.CreateEntity();
+		particles->AddComponent<Ndk::NodeComponent>();
+		Ndk::ParticleEmitterComponent& emitter = particles->AddComponent<Ndk::ParticleEmitterComponent>();
+		emitter.SetEmissionCount(1);
+		emitter.SetEmissionRate(1.f);
+
+		Ndk::ParticleGroupComponent& group = particles->AddComponent<Ndk::ParticleGroupComponent>(1, Nz::ParticleLayout_Sprite);
+		group.AddEmitter(particles);
+
+		// Particles are set up while the particle system is being updated, waiting there for the listener only succeeds if both systems run at the same time
+		std::atomic<bool> listenerMovedDuringSetup(false);
+		emitter.SetSetupFunc([&](const Ndk::EntityHandle& /*entity*/, Nz::ParticleMapper& /*mapper*/, unsigned int /*count*/)
+		{
+			Nz::Clock clock;
+			while (clock.GetMilliseconds() < 1000)
+			{
+				if (Nz::Audio::GetListenerPosition() == listenerPosition)
+				{
+					listenerMovedDuringSetup = true;
+					break;
+				}
+
+				std::this_thread::yield();
+			}
+		});
+
+		WHEN("We update the world")
+		{
+			world.Update(1.f);
+
+			THEN("The listener is updated during the update of the particles")
+			{
+				CHECK_FALSE(listenerSystem.ConflictsWith(particleSystem));
+				CHECK(listenerMovedDuringSetup);
+				CHECK(group.GetParticleCount() == 1);
+			}
+		}
+	}
 }
\ No newline at end of file
@@ -40,5 +40,69 @@ SCENARIO("RenderSystem", "[NDK][RenderSystem]")
 				REQUIRE(renderSystem.GetRenderTechnique().GetType() == Nz::RenderTechniqueType_BasicForward);
 			}
 		}
+
+		WHEN("We interpolate the drawable between two ticks of the world")
+		{
+			cameraEntity->Enable(false); //< We only want to check the transformation used for rendering
+
+			Ndk::RenderSystem& renderSystem = world.GetSystem<Ndk::RenderSystem>();
+			renderSystem.EnableInterpolation();
+			REQUIRE(renderSystem.IsInterpolationEnabled());
+			REQUIRE(!renderSystem.IsFixedUpdateEnabled());
+
+			nodeComponentDrawable.SetPosition(Nz::Vector3f::Zero());
+			world.FixedUpdate(1.f / 60.f);
+			world.FrameUpdate(1.f / 60.f, 0.f);
+
+			graphicsComponentDrawable.EnsureBoundingVolumeUpdate();
+			Nz::Vector3f startCenter = graphicsComponentDrawable.GetBoundingVolume().aabb.GetCenter();
+
+			nodeComponentDrawable.SetPosition(Nz::Vector3f::UnitX() * 10.f);
+			world.FixedUpdate(1.f / 60.f);
+			world.FrameUpdate(1.f / 60.f, 0.5f);
+
+			THEN("It should be rendered between both positions, without its node being modified")
+			{
+				graphicsComponentDrawable.EnsureBoundingVolumeUpdate();
+				Nz::Vector3f center = graphicsComponentDrawable.GetBoundingVolume().aabb.GetCenter();
+				CHECK(center.x - startCenter.x == Approx(5.f));
+				CHECK(nodeComponentDrawable.GetPosition() == Nz::Vector3f::UnitX() * 10.f);
+			}
+
+			AND_THEN("Disabling interpolation should render it at its node position")
+			{
+				renderSystem.EnableInterpolation(false);
+
+				graphicsComponentDrawable.EnsureBoundingVolumeUpdate();
+				Nz::Vector3f center = graphicsComponentDrawable.GetBoundingVolume().aabb.GetCenter();
+				CHECK(center.x - startCenter.x == Approx(10.f));
+			}
+		}
+
+		WHEN("We interpolate the drawable of a world updated without fixed ticks")
+		{
+			cameraEntity->Enable(false); //< We only want to check the transformation used for rendering
+
+			Ndk::RenderSystem& renderSystem = world.GetSystem<Ndk::RenderSystem>();
+			renderSystem.EnableInterpolation();
+
+			nodeComponentDrawable.SetPosition(Nz::Vector3f::Zero());
+			world.Update(1.f / 60.f);
+
+			graphicsComponentDrawable.EnsureBoundingVolumeUpdate();
+			Nz::Vector3f startCenter = graphicsComponentDrawable.GetBoundingVolume().aabb.GetCenter();
+
+			nodeComponentDrawable.SetPosition(Nz::Vector3f::UnitX() * 10.f);
+			world.Update(1.f / 60.f);
+
+			THEN("It should follow its node instead of keeping its first state")
+			{
+				CHECK(world.GetTickCount() == 0);
+
+				graphicsComponentDrawable.EnsureBoundingVolumeUpdate();
+				Nz::Vector3f center = graphicsComponentDrawable.GetBoundingVolume().aabb.GetCenter();
+				CHECK(center.x - startCenter.x == Approx(10.f));
+			}
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include <NDK/Systems/ReplicationSystem.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/ReplicationComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("ReplicationSystem", "[NDK][REPLICATIONSYSTEM]")
+{
+	GIVEN("A server world replicated to a client world through ENet")
+	{
+		Nz::UInt16 port = 64267;
+
+		Nz::ENetHost serverHost;
+		REQUIRE(serverHost.Create(Nz::NetProtocol_IPv4, port, 1));
+
+		Nz::ENetHost clientHost;
+		REQUIRE(clientHost.Create(Nz::IpAddress::AnyIpV4, 1));
+
+		Nz::ENetPeer* clientPeer = clientHost.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 1);
+		Nz::ENetPeer* serverPeer = nullptr;
+
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 100 && (!serverPeer || !clientPeer->IsConnected()); ++i)
+		{
+			if (serverHost.Service(&event, 1) > 0 && event.type == Nz::ENetEventType::IncomingConnect)
+				serverPeer = event.peer;
+
+			clientHost.Service(&event, 1);
+		}
+
+		REQUIRE(serverPeer);
+		REQUIRE(clientPeer->IsConnected());
+
+		Ndk::World serverWorld(false);
+		Ndk::ReplicationSystem& serverReplication = serverWorld.AddSystem<Ndk::ReplicationSystem>();
+		serverReplication.SetUpdateRate(0.f);
+		serverReplication.AddPeer(serverPeer);
+		serverReplication.SetPeerViewer(serverPeer, Nz::Vector3f::Zero(), 100.f);
+
+		Ndk::World clientWorld(false);
+		Ndk::ReplicationSystem& clientReplication = clientWorld.AddSystem<Ndk::ReplicationSystem>();
+
+		auto Replicate = [&]()
+		{
+			serverWorld.Update(0.1f);
+			serverHost.Flush();
+
+			for (unsigned int i = 0; i < 10; ++i)
+			{
+				while (clientHost.Service(&event, 1) > 0)
+				{
+					if (event.type == Nz::ENetEventType::Receive)
+						CHECK(clientReplication.HandlePacket(event.packet->data));
+				}
+
+				serverHost.Service(&event, 0);
+			}
+
+			clientWorld.Update(0.f);
+		};
+
+		Ndk::EntityHandle near = serverWorld.CreateEntity();
+		near->AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(10.f, 0.f, 0.f));
+		near->AddComponent<Ndk::ReplicationComponent>();
+		near->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitY());
+
+		Ndk::EntityHandle far = serverWorld.CreateEntity();
+		far->AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(1000.f, 0.f, 0.f));
+		far->AddComponent<Ndk::ReplicationComponent>();
+
+		Ndk::EntityHandle global = serverWorld.CreateEntity();
+		global->AddComponent<Ndk::ReplicationComponent>();
+		global->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitZ());
+
+		Replicate();
+
+		WHEN("The world is replicated")
+		{
+			THEN("Only relevant entities should be replicated, with their components")
+			{
+				const Ndk::EntityHandle& nearCopy = clientReplication.GetRemoteEntity(near->GetId());
+				REQUIRE(nearCopy);
+				REQUIRE(nearCopy->HasComponent<Ndk::NodeComponent>());
+				CHECK(nearCopy->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f(10.f, 0.f, 0.f));
+				CHECK(nearCopy->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitY());
+				CHECK(!nearCopy->HasComponent<Ndk::ReplicationComponent>());
+
+				CHECK(!clientReplication.GetRemoteEntity(far->GetId()));
+
+				const Ndk::EntityHandle& globalCopy = clientReplication.GetRemoteEntity(global->GetId());
+				REQUIRE(globalCopy);
+				CHECK(globalCopy->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitZ());
+			}
+		}
+
+		WHEN("Only a component changes on the server")
+		{
+			Ndk::EntityHandle nearCopy = clientReplication.GetRemoteEntity(near->GetId());
+			REQUIRE(nearCopy);
+			nearCopy->GetComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::Zero();
+
+			near->GetComponent<Ndk::NodeComponent>().Move(Nz::Vector3f::UnitX());
+			Replicate();
+
+			THEN("Only this component should be sent")
+			{
+				CHECK(nearCopy->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f(11.f, 0.f, 0.f));
+				CHECK(nearCopy->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::Zero());
+			}
+		}
+
+		WHEN("Entities move in and out of the viewer range, or are removed")
+		{
+			near->GetComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(500.f, 0.f, 0.f));
+			far->GetComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(0.f, 0.f, 50.f));
+			global->GetComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::UnitX();
+			global->RemoveComponent<Ndk::VelocityComponent>();
+
+			Ndk::EntityHandle nearCopy = clientReplication.GetRemoteEntity(near->GetId());
+			Replicate();
+
+			THEN("The client should follow")
+			{
+				CHECK(!nearCopy);
+				CHECK(!clientReplication.GetRemoteEntity(near->GetId()));
+
+				const Ndk::EntityHandle& farCopy = clientReplication.GetRemoteEntity(far->GetId());
+				REQUIRE(farCopy);
+				CHECK(farCopy->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f(0.f, 0.f, 50.f));
+
+				const Ndk::EntityHandle& globalCopy = clientReplication.GetRemoteEntity(global->GetId());
+				REQUIRE(globalCopy);
+				CHECK(!globalCopy->HasComponent<Ndk::VelocityComponent>());
+			}
+		}
+
+		WHEN("Many entities are created with a low bandwidth")
+		{
+			serverReplication.SetPeerBandwidth(serverPeer, 2000);
+
+			Ndk::World::EntityVector entities = serverWorld.CreateEntities(50);
+			for (const Ndk::EntityHandle& entity : entities)
+			{
+				entity->AddComponent<Ndk::NodeComponent>();
+				entity->AddComponent<Ndk::ReplicationComponent>();
+			}
+
+			auto CountReplicated = [&]()
+			{
+				std::size_t count = 0;
+				for (const Ndk::EntityHandle& entity : entities)
+				{
+					if (clientReplication.GetRemoteEntity(entity->GetId()))
+						count++;
+				}
+
+				return count;
+			};
+
+			Replicate();
+
+			THEN("They should be replicated over several updates")
+			{
+				std::size_t replicatedCount = CountReplicated();
+				CHECK(replicatedCount > 0);
+				CHECK(replicatedCount < 10);
+
+				for (unsigned int i = 0; i < 30; ++i)
+					Replicate();
+
+				CHECK(CountReplicated() == entities.size());
+			}
+		}
+	}
+}
@@ -0,0 +1,112 @@
+#include <NDK/Systems/TransformSystem.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("TransformSystem", "[NDK][TRANSFORMSYSTEM]")
+{
+	GIVEN("A world with a transform system and a parent entity with many childs")
+	{
+		Ndk::World world;
+		world.AddSystem<Ndk::TransformSystem>();
+
+		const Ndk::EntityHandle& parent = world.CreateEntity();
+		Ndk::NodeComponent& parentNode = parent->AddComponent<Ndk::NodeComponent>();
+
+		Ndk::World::EntityVector childs = world.CreateEntities(100);
+		for (const Ndk::EntityHandle& child : childs)
+		{
+			Ndk::NodeComponent& childNode = child->AddComponent<Ndk::NodeComponent>();
+			childNode.SetParent(parent);
+			childNode.SetPosition(Nz::Vector3f::UnitY());
+		}
+
+		unsigned int invalidationCount = 0;
+		NazaraSlot(Nz::Node, OnNodeInvalidation, invalidationSlot);
+		invalidationSlot.Connect(childs[0]->GetComponent<Ndk::NodeComponent>().OnNodeInvalidation, [&](const Nz::Node*) { invalidationCount++; });
+
+		world.Update(0.f);
+		invalidationCount = 0;
+
+		WHEN("We move the parent several times during a frame")
+		{
+			parentNode.Move(Nz::Vector3f::UnitX());
+			parentNode.Move(Nz::Vector3f::UnitX());
+			parentNode.Move(Nz::Vector3f::UnitX());
+
+			THEN("Childs should only be notified once, during the update")
+			{
+				CHECK(invalidationCount == 0);
+
+				world.Update(0.f);
+
+				CHECK(invalidationCount == 1);
+			}
+
+			THEN("Transform matrices should be computed by the update")
+			{
+				world.Update(0.f);
+
+				for (const Ndk::EntityHandle& child : childs)
+				{
+					const Nz::Matrix4f& matrix = child->GetComponent<Ndk::NodeComponent>().GetTransformMatrix();
+					CHECK(matrix.GetTranslation() == Nz::Vector3f(3.f, 1.f, 0.f));
+				}
+			}
+		}
+
+		WHEN("We remove the system")
+		{
+			childs[0]->GetComponent<Ndk::NodeComponent>().Move(Nz::Vector3f::UnitZ());
+			world.RemoveSystem<Ndk::TransformSystem>();
+
+			THEN("Deferred invalidations should be notified, then the next ones immediately")
+			{
+				CHECK(invalidationCount == 1);
+
+				childs[0]->GetComponent<Ndk::NodeComponent>().GetTransformMatrix();
+				childs[0]->GetComponent<Ndk::NodeComponent>().Move(Nz::Vector3f::UnitZ());
+
+				CHECK(invalidationCount == 2);
+			}
+		}
+	}
+
+	GIVEN("A node and a child without transform system")
+	{
+		Nz::Node parent;
+		Nz::Node child;
+		child.SetParent(parent);
+		child.EnsureTransformMatrixUpdate();
+
+		unsigned int invalidationCount = 0;
+		NazaraSlot(Nz::Node, OnNodeInvalidation, invalidationSlot);
+		invalidationSlot.Connect(child.OnNodeInvalidation, [&](const Nz::Node*) { invalidationCount++; });
+
+		WHEN("We move the parent several times before reading the child")
+		{
+			parent.Move(Nz::Vector3f::UnitX());
+			parent.Move(Nz::Vector3f::UnitX());
+
+			THEN("The child should be invalidated once, until it is up to date again")
+			{
+				CHECK(invalidationCount == 1);
+				CHECK(child.GetPosition(Nz::CoordSys_Global) == Nz::Vector3f(2.f, 0.f, 0.f));
+
+				parent.Move(Nz::Vector3f::UnitX());
+				CHECK(invalidationCount == 2);
+			}
+		}
+
+		WHEN("We move the child itself several times before reading it")
+		{
+			child.Move(Nz::Vector3f::UnitX());
+			child.Move(Nz::Vector3f::UnitX());
+
+			THEN("Every move should be notified")
+			{
+				CHECK(invalidationCount == 2);
+			}
+		}
+	}
+}
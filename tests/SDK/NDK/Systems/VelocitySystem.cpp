@@ -3,6 +3,9 @@
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
 #include <Catch/catch.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 SCENARIO("VelocitySystem", "[NDK][VELOCITYSYSTEM]")
 {
@@ -25,4 +28,87 @@ SCENARIO("VelocitySystem", "[NDK][VELOCITYSYSTEM]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("A world with many moving entities, some of them being linked")
+	{
+		Ndk::World world;
+		Ndk::World::EntityVector entities = world.CreateEntities(1000);
+
+		for (const Ndk::EntityHandle& entity : entities)
+		{
+			entity->AddComponent<Ndk::NodeComponent>();
+			entity->AddComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::UnitX();
+		}
+
+		entities[11]->GetComponent<Ndk::NodeComponent>().SetParent(entities[10]);
+
+		WHEN("We update the world")
+		{
+			world.GetSystem<Ndk::VelocitySystem>().SetUpdateRate(0.f);
+			world.Update(1.f);
+
+			THEN("Independent entities should have moved by their velocity")
+			{
+				for (std::size_t i = 0; i < entities.size(); ++i)
+				{
+					if (i == 11)
+						continue;
+
+					Nz::Vector3f position = entities[i]->GetComponent<Ndk::NodeComponent>().GetPosition(Nz::CoordSys_Global);
+					CHECK(position.SquaredDistance(Nz::Vector3f::UnitX()) < 0.001f);
+				}
+			}
+
+			THEN("Linked entities should have moved one after the other")
+			{
+				Nz::Node parent;
+				Nz::Node child;
+				child.SetParent(parent);
+
+				parent.Move(Nz::Vector3f::UnitX(), Nz::CoordSys_Global);
+				child.Move(Nz::Vector3f::UnitX(), Nz::CoordSys_Global);
+
+				Nz::Vector3f position = entities[11]->GetComponent<Ndk::NodeComponent>().GetPosition(Nz::CoordSys_Global);
+				CHECK(position.SquaredDistance(child.GetPosition(Nz::CoordSys_Global)) < 0.001f);
+			}
+		}
+	}
+
+	GIVEN("A world with many moving entities, some of them having invalidation listeners")
+	{
+		Ndk::World world;
+		Ndk::World::EntityVector entities = world.CreateEntities(1000);
+
+		std::vector<Nz::Node::OnNodeInvalidationType::ConnectionGuard> listeners;
+		std::vector<std::thread::id> listenerThreads(entities.size());
+		for (std::size_t i = 0; i < entities.size(); ++i)
+		{
+			Ndk::NodeComponent& node = entities[i]->AddComponent<Ndk::NodeComponent>();
+			entities[i]->AddComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::UnitX();
+
+			if (i % 10 == 0)
+			{
+				listeners.emplace_back(node.OnNodeInvalidation.Connect([&listenerThreads, i](const Nz::Node* /*node*/)
+				{
+					listenerThreads[i] = std::this_thread::get_id();
+
+					// Give some time to the workers to pick the remaining entities
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}));
+			}
+		}
+
+		WHEN("We update the world")
+		{
+			world.GetSystem<Ndk::VelocitySystem>().SetUpdateRate(0.f);
+			world.Update(1.f);
+
+			THEN("Listeners should have been called on the updating thread")
+			{
+				for (std::size_t i = 0; i < entities.size(); i += 10)
+					CHECK(listenerThreads[i] == std::this_thread::get_id());
+			}
+		}
+	}
+}
+
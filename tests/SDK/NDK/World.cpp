@@ -1,6 +1,10 @@
 #include <NDK/World.hpp>
 #include <NDK/Component.hpp>
+#include <Nazara/Core/Clock.hpp>
 #include <Catch/catch.hpp>
+#include <atomic>
+#include <functional>
+#include <thread>
 
 namespace
 {
@@ -49,6 +53,44 @@ namespace
 	};
 
 	Ndk::SystemIndex UpdateSystem::systemIndex;
+
+	template<int N>
+	class AccessSystem : public Ndk::System<AccessSystem<N>>
+	{
+		public:
+			AccessSystem(std::atomic<int>& updateCounter, std::initializer_list<Ndk::ComponentIndex> reads, std::initializer_list<Ndk::ComponentIndex> writes) :
+			updateIndex(-1),
+			m_updateCounter(updateCounter)
+			{
+				for (Ndk::ComponentIndex index : reads)
+					this->ReadsComponent(index);
+
+				for (Ndk::ComponentIndex index : writes)
+					this->WritesComponent(index);
+
+				this->SetUpdateRate(0.f);
+			}
+
+			std::function<void()> onUpdate;
+			std::thread::id updateThread;
+			int updateIndex;
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+				updateIndex = m_updateCounter++;
+				updateThread = std::this_thread::get_id();
+
+				if (onUpdate)
+					onUpdate();
+			}
+
+			std::atomic<int>& m_updateCounter;
+	};
+
+	template<int N> Ndk::SystemIndex AccessSystem<N>::systemIndex;
 }
 
 SCENARIO("World", "[NDK][WORLD]")
@@ -100,4 +142,134 @@ SCENARIO("World", "[NDK][WORLD]")
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+
+SCENARIO("World parallel update", "[NDK][WORLD]")
+{
+	GIVEN("A world with systems declaring their component access")
+	{
+		Ndk::InitializeSystem<AccessSystem<0>>();
+		Ndk::InitializeSystem<AccessSystem<1>>();
+		Ndk::InitializeSystem<AccessSystem<2>>();
+		Ndk::InitializeSystem<AccessSystem<3>>();
+
+		std::atomic<int> updateCounter(0);
+
+		Ndk::World world(false);
+		auto& writerA = world.AddSystem<AccessSystem<0>>(updateCounter, std::initializer_list<Ndk::ComponentIndex>{}, std::initializer_list<Ndk::ComponentIndex>{0});
+		auto& readerA = world.AddSystem<AccessSystem<1>>(updateCounter, std::initializer_list<Ndk::ComponentIndex>{0, 1}, std::initializer_list<Ndk::ComponentIndex>{});
+		auto& readerB = world.AddSystem<AccessSystem<2>>(updateCounter, std::initializer_list<Ndk::ComponentIndex>{1}, std::initializer_list<Ndk::ComponentIndex>{2});
+		auto& undeclared = world.AddSystem<AccessSystem<3>>(updateCounter, std::initializer_list<Ndk::ComponentIndex>{}, std::initializer_list<Ndk::ComponentIndex>{});
+
+		writerA.SetUpdateOrder(0);
+		readerA.SetUpdateOrder(1);
+		readerB.SetUpdateOrder(1);
+		undeclared.SetUpdateOrder(2);
+
+		THEN("Conflicts should match the declared access")
+		{
+			CHECK(writerA.ConflictsWith(readerA));
+			CHECK(!writerA.ConflictsWith(readerB));
+			CHECK(!readerA.ConflictsWith(readerB));
+			CHECK(undeclared.ConflictsWith(readerB));
+			CHECK(!undeclared.HasComponentAccess());
+		}
+
+		WHEN("We update the world in parallel")
+		{
+			world.EnableParallelUpdate();
+			REQUIRE(world.IsParallelUpdateEnabled());
+
+			for (int i = 0; i < 10; ++i)
+			{
+				updateCounter = 0;
+				world.Update(1.f);
+
+				CHECK(updateCounter == 4);
+				CHECK(writerA.updateIndex < readerA.updateIndex);
+				CHECK(undeclared.updateIndex == 3);
+				CHECK(undeclared.updateThread == std::this_thread::get_id());
+			}
+		}
+
+		WHEN("Two systems which do not conflict wait for each other during their update")
+		{
+			world.EnableParallelUpdate();
+
+			// Rendezvous, which can only succeed if both systems are updated at the same time
+			std::atomic<int> arrivedCount(0);
+			std::atomic<int> metCount(0);
+			auto Rendezvous = [&]()
+			{
+				arrivedCount++;
+
+				Nz::Clock clock;
+				while (clock.GetMilliseconds() < 1000)
+				{
+					if (arrivedCount == 2)
+					{
+						metCount++;
+						break;
+					}
+
+					std::this_thread::yield();
+				}
+			};
+
+			readerA.onUpdate = Rendezvous;
+			readerB.onUpdate = Rendezvous;
+
+			world.Update(1.f);
+
+			THEN("They are updated at the same time, on different threads")
+			{
+				CHECK(metCount == 2);
+				CHECK(readerA.updateThread != readerB.updateThread);
+			}
+		}
+	}
+}
+
+SCENARIO("World fixed update", "[NDK][WORLD]")
+{
+	GIVEN("A world with a simulation system and a presentation system")
+	{
+		Ndk::InitializeSystem<AccessSystem<4>>();
+		Ndk::InitializeSystem<AccessSystem<5>>();
+
+		std::atomic<int> fixedCounter(0);
+		std::atomic<int> frameCounter(0);
+
+		Ndk::World world(false);
+		auto& fixedSystem = world.AddSystem<AccessSystem<4>>(fixedCounter, std::initializer_list<Ndk::ComponentIndex>{}, std::initializer_list<Ndk::ComponentIndex>{});
+		auto& frameSystem = world.AddSystem<AccessSystem<5>>(frameCounter, std::initializer_list<Ndk::ComponentIndex>{}, std::initializer_list<Ndk::ComponentIndex>{});
+		frameSystem.EnableFixedUpdate(false);
+
+		CHECK(fixedSystem.IsFixedUpdateEnabled());
+		CHECK(!frameSystem.IsFixedUpdateEnabled());
+
+		WHEN("We run a few ticks and then a frame")
+		{
+			world.FixedUpdate(1.f / 60.f);
+			world.FixedUpdate(1.f / 60.f);
+			world.FrameUpdate(1.f / 30.f, 0.25f);
+
+			THEN("Each system should only be updated by its own kind of update")
+			{
+				CHECK(fixedCounter == 2);
+				CHECK(frameCounter == 1);
+				CHECK(world.GetTickCount() == 2);
+				CHECK(world.GetInterpolationFactor() == Approx(0.25f));
+			}
+
+			AND_THEN("A regular update should still update every system")
+			{
+				world.Update(1.f / 60.f);
+
+				CHECK(fixedCounter == 3);
+				CHECK(frameCounter == 2);
+				CHECK(world.GetTickCount() == 2);
+			}
+		}
+	}
+}
@@ -0,0 +1,214 @@
+#include <NDK/WorldSnapshot.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
+#include <Catch/catch.hpp>
+
+SCENARIO("WorldSnapshot", "[NDK][WORLDSNAPSHOT]")
+{
+	GIVEN("A world with moving entities and a snapshot of it")
+	{
+		Ndk::World world(false);
+
+		Ndk::World::EntityVector entities = world.CreateEntities(10);
+		for (std::size_t i = 0; i < entities.size(); ++i)
+		{
+			entities[i]->AddComponent<Ndk::NodeComponent>().SetPosition(Nz::Vector3f(float(i), 0.f, 0.f));
+			entities[i]->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitY());
+		}
+
+		world.Update();
+
+		Ndk::WorldSnapshot snapshot;
+		snapshot.Capture(world);
+
+		REQUIRE(!snapshot.IsEmpty());
+
+		WHEN("We modify the entities and restore the snapshot")
+		{
+			for (const Ndk::EntityHandle& entity : entities)
+			{
+				Ndk::NodeComponent& node = entity->GetComponent<Ndk::NodeComponent>();
+				node.Move(Nz::Vector3f::UnitZ());
+				node.SetRotation(Nz::EulerAnglesf(0.f, 90.f, 0.f));
+				node.SetScale(2.f);
+
+				entity->GetComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::Zero();
+			}
+
+			REQUIRE(snapshot.Restore(world));
+
+			THEN("Their state should be the captured one")
+			{
+				for (std::size_t i = 0; i < entities.size(); ++i)
+				{
+					const Ndk::NodeComponent& node = entities[i]->GetComponent<Ndk::NodeComponent>();
+					CHECK(node.GetPosition() == Nz::Vector3f(float(i), 0.f, 0.f));
+					CHECK(node.GetRotation() == Nz::Quaternionf::Identity());
+					CHECK(node.GetScale() == Nz::Vector3f(1.f));
+
+					CHECK(entities[i]->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitY());
+				}
+			}
+		}
+
+		WHEN("We remove a component and restore the snapshot")
+		{
+			entities[0]->RemoveComponent<Ndk::VelocityComponent>();
+			world.Update();
+
+			REQUIRE(snapshot.Restore(world));
+
+			THEN("The component should be back")
+			{
+				REQUIRE(entities[0]->HasComponent<Ndk::VelocityComponent>());
+				CHECK(entities[0]->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitY());
+			}
+		}
+
+		WHEN("We kill entities and restore the snapshot")
+		{
+			Ndk::EntityId id = entities[1]->GetId();
+			Nz::UInt32 generation = world.GetEntityGeneration(id);
+
+			entities[1]->Kill();
+			world.Update();
+
+			entities[2]->Kill();
+
+			REQUIRE(snapshot.Restore(world));
+			world.Update();
+
+			THEN("They should be alive again, with the same identifier and generation")
+			{
+				REQUIRE(world.IsEntityIdValid(id));
+				CHECK(world.GetEntityGeneration(id) == generation);
+
+				const Ndk::EntityHandle& entity = world.GetEntity(id);
+				REQUIRE(entity->HasComponent<Ndk::NodeComponent>());
+				CHECK(entity->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f(1.f, 0.f, 0.f));
+				CHECK(entity->GetComponent<Ndk::VelocityComponent>().linearVelocity == Nz::Vector3f::UnitY());
+
+				CHECK(entities[2]->IsValid());
+			}
+		}
+
+		WHEN("An entity identifier is reused before the restoration")
+		{
+			Ndk::EntityId id = entities[0]->GetId();
+			Nz::UInt32 generation = world.GetEntityGeneration(id);
+			entities[0]->Kill();
+			world.Update();
+
+			Ndk::EntityHandle entity = world.CreateEntity();
+			entity->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitX());
+
+			REQUIRE(entity->GetId() == id);
+			REQUIRE(snapshot.Restore(world));
+
+			THEN("The new entity should make way for the captured one")
+			{
+				CHECK(!entity.IsValid());
+
+				REQUIRE(world.IsEntityIdValid(id));
+				CHECK(world.GetEntityGeneration(id) == generation);
+				CHECK(world.GetEntity(id)->GetComponent<Ndk::NodeComponent>().GetPosition() == Nz::Vector3f::Zero());
+			}
+		}
+
+		WHEN("We create entities and add components after the capture")
+		{
+			entities[3]->RemoveComponent<Ndk::VelocityComponent>();
+			world.Update();
+
+			Ndk::WorldSnapshot earlierSnapshot;
+			earlierSnapshot.Capture(world);
+
+			entities[3]->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitX());
+
+			Ndk::EntityHandle entity = world.CreateEntity();
+			entity->AddComponent<Ndk::NodeComponent>();
+
+			REQUIRE(earlierSnapshot.Restore(world));
+			world.Update();
+
+			THEN("They should be removed")
+			{
+				CHECK(!entity.IsValid());
+				CHECK(!entities[3]->HasComponent<Ndk::VelocityComponent>());
+				CHECK(entities[3]->HasComponent<Ndk::NodeComponent>());
+				CHECK(world.GetEntities().size() == entities.size());
+			}
+		}
+
+		WHEN("We compute the delta with a later snapshot")
+		{
+			entities[3]->GetComponent<Ndk::VelocityComponent>().linearVelocity = Nz::Vector3f::UnitZ();
+
+			Ndk::WorldSnapshot nextSnapshot;
+			nextSnapshot.Capture(world);
+
+			Nz::ByteArray delta;
+			nextSnapshot.ComputeDelta(snapshot, &delta);
+
+			THEN("The delta should be small and rebuild the later snapshot")
+			{
+				CHECK(delta.GetSize() < nextSnapshot.GetSize() / 10);
+
+				Ndk::WorldSnapshot rebuiltSnapshot;
+				REQUIRE(rebuiltSnapshot.ApplyDelta(snapshot, delta));
+				CHECK(rebuiltSnapshot.GetData() == nextSnapshot.GetData());
+			}
+
+			THEN("A delta against an empty snapshot should rebuild it too")
+			{
+				nextSnapshot.ComputeDelta(Ndk::WorldSnapshot(), &delta);
+
+				Ndk::WorldSnapshot rebuiltSnapshot;
+				REQUIRE(rebuiltSnapshot.ApplyDelta(Ndk::WorldSnapshot(), delta));
+				CHECK(rebuiltSnapshot.GetData() == nextSnapshot.GetData());
+			}
+		}
+
+		WHEN("We apply a delta announcing a huge snapshot")
+		{
+			// Variable-length encoded size of 2^35 bytes, followed by nothing
+			const Nz::UInt8 data[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+			Nz::ByteArray delta(data, sizeof(data));
+
+			Ndk::WorldSnapshot rebuiltSnapshot(snapshot.GetData());
+
+			THEN("It should be rejected before allocating anything")
+			{
+				CHECK_FALSE(rebuiltSnapshot.ApplyDelta(snapshot, delta));
+				CHECK(rebuiltSnapshot.IsEmpty());
+			}
+		}
+
+
+		{
+			Ndk::World::EntityVector newEntities = world.CreateEntities(5);
+			for (const Ndk::EntityHandle& entity : newEntities)
+				entity->AddComponent<Ndk::VelocityComponent>();
+
+			world.Update();
+
+			Ndk::WorldSnapshot nextSnapshot;
+			nextSnapshot.Capture(world);
+
+			Nz::ByteArray delta;
+			nextSnapshot.ComputeDelta(snapshot, &delta);
+
+			THEN("Snapshots of different sizes should be rebuilt from each other")
+			{
+				Ndk::WorldSnapshot rebuiltSnapshot;
+				REQUIRE(rebuiltSnapshot.ApplyDelta(snapshot, delta));
+				CHECK(rebuiltSnapshot.GetData() == nextSnapshot.GetData());
+
+				snapshot.ComputeDelta(nextSnapshot, &delta);
+				REQUIRE(rebuiltSnapshot.ApplyDelta(nextSnapshot, delta));
+				CHECK(rebuiltSnapshot.GetData() == snapshot.GetData());
+			}
+		}
+	}
+}